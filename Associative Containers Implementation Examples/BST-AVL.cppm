@@ -6,6 +6,55 @@
 **
 **  Major differences between this example and std::map. Unlike std:map:
 **  1)  end() and rend() cannot be decremented
+**  2)  The Compare function object may return either a bool, like std::less, or a three-way comparison result, like
+**      std::compare_three_way.  The default, ThreeWayCompare<Key>, orders keys the way the tree always has, with <=> when the Key
+**      provides it and with < and == otherwise
+**
+**  Like std::map, when the Compare function object declares an is_transparent member type (ThreeWayCompare<>, std::less<>, and
+**  std::compare_three_way all do) find, contains, at, operator[], lower_bound, upper_bound, and equal_range also accept any type
+**  comparable with Key.  A BinarySearchTree<std::string, double, ThreeWayCompare<>> can then be searched with a std::string_view
+**  or a string literal without first building a temporary std::string.
+**
+**  Constructing a tree from a range of key-value pairs (including an initializer list) does not insert them one at a time.  The
+**  pairs are sorted, if they are not already, and linked directly into a perfectly balanced tree, so no rotations are needed and
+**  sorted input is loaded in O(n).  insert_range() likewise sorts a batch and then merges it with the tree's existing nodes.  When
+**  several pairs have equivalent keys, the first one wins, just as if they had been inserted one at a time.
+**
+**  Nodes are not individually allocated with new and deleted with delete.  Each tree takes its nodes from a node pool of its own
+**  (see NodePool.cppm) that gets memory from the allocator a block of nodes at a time and recycles erased nodes through a free
+**  list.  Nodes created together, as when a tree is copied or bulk loaded, sit next to each other in memory, and clearing a tree
+**  hands back whole blocks rather than one node at a time.  Over time inserts and erases scatter the nodes, so compact() moves them
+**  into fresh blocks in either in-order sequence, best for walking the tree with its iterators, or van Emde Boas order, which keeps
+**  each small subtree (a few levels of the tree) together so a search from the root touches as few cache lines as possible:
+**
+**                                    h
+**                        d                       l
+**                  b           f           j           n
+**                a   c       e   g       i   k       m   o
+**
+**     in-order:        a b c d e f g h i j k l m n o
+**     van Emde Boas:   h d l  b a c  f e g  j i k  n m o          (the top two levels, then each subtree below them, together)
+**
+**  Each node may also keep a summary of its subtree, chosen by the Augment policy, such as the subtree's size (OrderStatistics),
+**  the sum of its values (SubtreeSum), or the greatest of its values (SubtreeMax).  A node's summary is recomputed from its
+**  children's whenever its height is, so insert, erase, and every rotation keep them current in O(log n).  Then nth() and rank()
+**  find the k'th element, or count the elements before a key, and aggregate( lo, hi ) summarizes every element with a key in [lo,
+**  hi), all in O(log n) instead of walking the tree.  A value changed in place would leave the summaries above it stale, so when
+**  the summary depends on the values (SubtreeSum, SubtreeMax) the values are read-only:  iterator is a read-only iterator, at()
+**  returns a read-only value, and there is no operator[].  Change values with insert_or_assign() instead, which keeps the summaries
+**  current.
+**
+**  Whole trees can be combined without inserting or erasing one element at a time.  Two AVL primitives do the work:  join links two
+**  trees and a middle node, all of one tree's keys less than all of the other's, into a single balanced tree in time proportional to
+**  the difference in their heights, and split divides a tree at a key into the trees of lesser and greater keys in O(log n).  With
+**  them unite(), intersect(), and subtract() split the other tree at this tree's root, recurse on each side, and join the results
+**  back together, taking O(m log(n/m + 1)) for trees of m and n elements, m <= n.  Merging a small shard's index into a large one
+**  then costs about as much as inserting the small one's elements, while merging two equal sized ones is linear.  The other tree's
+**  nodes are relinked, never copied, so its node pool's blocks are merged into this tree's.
+**
+**  Construction, insert, find, and iteration are constexpr, so a tree can be built and searched at compile time.  Memory allocated
+**  during constant evaluation must also be released during constant evaluation, so to embed a tree's content in the program copy
+**  it into something like a std::array before the tree goes away.  (See the sample usage.)
 ***********************************************************************************************************************************/
 module;                                                                               // Global fragment (not part of the module)
   // Empty
@@ -25,6 +74,7 @@ module;
 export module CSUF.CPSC131.BinarySearchTree;                                          // Primary Module Interface Definition
 import std;
 import CSUF.CPSC131.exceptionString;
+import CSUF.CPSC131.NodePool;
 
 
 
@@ -34,103 +84,280 @@ import CSUF.CPSC131.exceptionString;
 *******************************************************************************/
 export namespace CSUF::CPSC131
 {
+  // Key comparison function objects.  ThreeWayCompare<T> compares two T's, ThreeWayCompare<> (aka ThreeWayCompare<void>) compares
+  // any two types that can be compared with each other and is transparent, enabling heterogeneous lookup
+  template <typename T = void>
+  struct ThreeWayCompare
+  {
+    constexpr std::weak_ordering operator()( T const & lhs, T const & rhs ) const;
+  };
+
+  template <>
+  struct ThreeWayCompare<void>
+  {
+    using is_transparent = void;
+
+    template <typename L, typename R>
+    constexpr std::weak_ordering operator()( L const & lhs, R const & rhs ) const;
+  };
+
+  template <typename Compare>                                                         // Satisfied by function objects that allow
+  concept TransparentCompare = requires { typename Compare::is_transparent; };        // lookup by keys of some type other than Key
+
+  enum class TreeLayout { IN_ORDER, VAN_EMDE_BOAS };                                  // How compact() arranges a tree's nodes in memory
+
+
+
+  // Augment policies.  Every node keeps a Summary of its subtree:  combine( combine( left subtree's, of( node's pair ) ), right
+  // subtree's ).  A default constructed Summary summarizes an empty subtree, and combine() must be associative (but need not be
+  // commutative).  READS_VALUES says whether of() looks at the pair's value, in which case the tree's values are read-only.  Other
+  // policies can be written the same way, and one that doesn't say is taken to read them.
+  template <typename KeyValue_Pair>
+  struct NoAugmentation                                                               // The default, nodes keep nothing extra and take no extra space
+  {
+    struct Summary {};
+    static constexpr bool    READS_VALUES = false;
+    static constexpr Summary of     ( KeyValue_Pair const &                     ) { return {}; }
+    static constexpr Summary combine( Summary const &,      Summary const &     ) { return {}; }
+  };
+
+  template <typename KeyValue_Pair>
+  struct OrderStatistics                                                              // The number of elements in the subtree, enough for nth() and rank()
+  {
+    struct Summary { std::size_t size = 0; };
+    static constexpr bool    READS_VALUES = false;
+    static constexpr Summary of     ( KeyValue_Pair const &                     ) { return { 1 }; }
+    static constexpr Summary combine( Summary const & lhs,  Summary const & rhs ) { return { lhs.size + rhs.size }; }
+  };
+
+  template <typename KeyValue_Pair>
+  struct SubtreeSum                                                                   // The number of elements in the subtree and the sum of their values
+  {
+    using Value = typename KeyValue_Pair::second_type;
+    struct Summary { std::size_t size = 0;  Value sum = Value{}; };
+    static constexpr bool    READS_VALUES = true;
+    static constexpr Summary of     ( KeyValue_Pair const & pair                ) { return { 1, pair.second }; }
+    static constexpr Summary combine( Summary const & lhs,  Summary const & rhs ) { return { lhs.size + rhs.size, lhs.sum + rhs.sum }; }
+  };
+
+  template <typename KeyValue_Pair>
+  struct SubtreeMax                                                                   // The number of elements in the subtree and the greatest of their values
+  {
+    using Value = typename KeyValue_Pair::second_type;
+    struct Summary { std::size_t size = 0;  Value max = Value{}; };                   // max means nothing while size is 0
+    static constexpr bool    READS_VALUES = true;
+    static constexpr Summary of     ( KeyValue_Pair const & pair                ) { return { 1, pair.second }; }
+    static constexpr Summary combine( Summary const & lhs,  Summary const & rhs )
+    {
+      if( lhs.size == 0 )   return rhs;
+      if( rhs.size == 0 )   return lhs;
+      return { lhs.size + rhs.size, std::max( lhs.max, rhs.max ) };
+    }
+  };
+
+  template <typename Summary>                                                         // Satisfied by summaries that count their subtree's
+  concept CountingSummary = requires( Summary const & summary ) { { summary.size } -> std::convertible_to<std::size_t>; };   // elements, as nth() and rank() require
+
+  template <typename Augmentation>                                                    // Satisfied by policies whose summaries don't depend on
+  concept ValueBlindAugment = std::is_empty_v<typename Augmentation::Summary>  ||  requires { requires !Augmentation::READS_VALUES; };   // the values, so values may change in place
+
+
+
+
   // Template Class Definition
-  template <typename Key, typename Value>
+  template <typename Key, typename Value, typename Compare = ThreeWayCompare<Key>, template <typename> typename Augment = NoAugmentation>
   class BinarySearchTree
   {
-    template <typename T, typename U>
-    friend void swap( BinarySearchTree<T, U> & lhs, BinarySearchTree<T, U> & rhs );   // The expected way to make a program-defined type swappable is to provide a
-                                                                                      // non-member function swap in the same namespace as the type.
-                                                                                      // (https://en.cppreference.com/w/cpp/algorithm/swap)
+    template <typename T, typename U, typename C, template <typename> typename A>
+    friend constexpr void swap( BinarySearchTree<T, U, C, A> & lhs, BinarySearchTree<T, U, C, A> & rhs );   // The expected way to make a program-defined type swappable is to provide a
+                                                                                                      // non-member function swap in the same namespace as the type.
+                                                                                                      // (https://en.cppreference.com/w/cpp/algorithm/swap)
 
     private:
       // Types
       template <typename U> class  Iterator_type;                                     // Template class for iterator and const_iterator classes
 
+      static constexpr bool MUTABLE_VALUES = ValueBlindAugment<Augment<std::pair<Key const, Value>>>;   // Values are read-only when a summary depends on them
+
 
 
     public:
       // Types
       using KeyValue_Pair  = std::pair     <Key const, Value   >;                     // An alias to the type of data held in the tree
-      using iterator       = Iterator_type <KeyValue_Pair      >;                     // A bi-directional iterator to a read-write value in the tree
+      using iterator       = Iterator_type <std::conditional_t<MUTABLE_VALUES, KeyValue_Pair, KeyValue_Pair const>>;   // A bi-directional iterator to a read-write value in the tree (read-only if the summary depends on values)
       using const_iterator = Iterator_type <KeyValue_Pair const>;                     // A bi-directional iterator to a read-only value in the tree
+      using KeyCompare     = Compare;                                                 // The function object that orders the keys
+      using Summary        = typename Augment<KeyValue_Pair>::Summary;                // What each node knows about its subtree
 
 
 
       // Constructors, destructor, and assignments
-      BinarySearchTree(                                                   );          // Default constructor, creates an empty tree
-      BinarySearchTree( BinarySearchTree const                & original  );          // Copy constructor, performs a deep copy
-      BinarySearchTree( BinarySearchTree                     && original  ) noexcept; // Move constructor, takes ownership of the other tree
-      BinarySearchTree( std::initializer_list<KeyValue_Pair>    init_list );          // initialization list constructor
-     ~BinarySearchTree(                                                   ) noexcept; // Destructor, performs a deep Key-Value pair destruction
+      constexpr  BinarySearchTree(                                                   );           // Default constructor, creates an empty tree
+      constexpr explicit BinarySearchTree( Compare const                & compare    );           // Creates an empty tree ordered by the given comparison function object
+      constexpr  BinarySearchTree( BinarySearchTree const               & original   );           // Copy constructor, performs a deep copy
+      constexpr  BinarySearchTree( BinarySearchTree                    && original   ) noexcept;  // Move constructor, takes ownership of the other tree
+      constexpr  BinarySearchTree( std::initializer_list<KeyValue_Pair>    init_list );           // initialization list constructor
+      template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+      constexpr  BinarySearchTree( InputIt first, Sentinel last, Compare const & compare = Compare{} );   // Range constructor, O(n) if [first, last) is sorted, O(n log n) otherwise
+      constexpr ~BinarySearchTree(                                                   ) noexcept;  // Destructor, performs a deep Key-Value pair destruction
 
-      BinarySearchTree & operator=( BinarySearchTree const  & rhs );                  // Copy assignment, performs a deep copy
-      BinarySearchTree & operator=( BinarySearchTree       && rhs ) noexcept;         // Move assignment, takes ownership of the other tree
+      constexpr BinarySearchTree & operator=( BinarySearchTree const  & rhs );                    // Copy assignment, performs a deep copy
+      constexpr BinarySearchTree & operator=( BinarySearchTree       && rhs ) noexcept;           // Move assignment, takes ownership of the other tree
 
 
 
       // Queries
-      std::size_t size    (                 ) const noexcept;                         // Returns the number of elements in the tree
-      bool        empty   (                 ) const noexcept;                         // Returns true if the tree contains no elements, false otherwise
-      bool        contains( Key const & key ) const;                                  // Returns true if there is such an element, false otherwise
+      constexpr std::size_t size    (                 ) const noexcept;               // Returns the number of elements in the tree
+      constexpr bool        empty   (                 ) const noexcept;               // Returns true if the tree contains no elements, false otherwise
+      constexpr bool        contains( Key const & key ) const;                        // Returns true if there is such an element, false otherwise
+      constexpr Compare     key_comp(                 ) const;                        // Returns a copy of the function object that orders the keys
+
+      template <typename K>  requires TransparentCompare<Compare>
+      constexpr bool        contains( K   const & key ) const;                        // Heterogeneous lookup, K need only be comparable with Key
 
 
 
       // Iterators
-      iterator       begin          ()       noexcept;                                // Returns a read-write iterator to the tree's first (least) element, end() if tree is empty
-      iterator       end            ()       noexcept;                                // Returns a read-write iterator beyond the tree's last (greatest) element.  Do not dereference this Iterator
+      constexpr iterator       begin          ()       noexcept;                      // Returns a read-write iterator to the tree's first (least) element, end() if tree is empty
+      constexpr iterator       end            ()       noexcept;                      // Returns a read-write iterator beyond the tree's last (greatest) element.  Do not dereference this Iterator
 
-      const_iterator begin          () const noexcept;                                // Returns a read-only iterator to the tree's first (least) element, end() if tree is empty
-      const_iterator end            () const noexcept;                                // Returns a read-only iterator beyond the tree's last (greatest) element.  Do not dereference this Iterator
+      constexpr const_iterator begin          () const noexcept;                      // Returns a read-only iterator to the tree's first (least) element, end() if tree is empty
+      constexpr const_iterator end            () const noexcept;                      // Returns a read-only iterator beyond the tree's last (greatest) element.  Do not dereference this Iterator
 
-      const_iterator cbegin         () const noexcept;                                // Returns a read-only iterator to the tree's first (least) element, end() if tree is empty
-      const_iterator cend           () const noexcept;                                // Returns a read-only iterator beyond the tree's last (greatest) element.  Do not dereference this Iterator
+      constexpr const_iterator cbegin         () const noexcept;                      // Returns a read-only iterator to the tree's first (least) element, end() if tree is empty
+      constexpr const_iterator cend           () const noexcept;                      // Returns a read-only iterator beyond the tree's last (greatest) element.  Do not dereference this Iterator
 
 
 
       // Accessors
-      Value const    & at        ( Key const & key ) const;                           // Returns the value associated with given key.  Throws std::out_of_range if key not found
-      Value          & at        ( Key const & key );                                 // Returns the value associated with given key.  Throws std::out_of_range if key not found
-      Value          & operator[]( Key const & key );                                 // Returns the value associated with given key, performing an insertion if such key does not already exist.
-      const_iterator   find      ( Key const & key ) const;                           // Returns a read-only iterator to the key/value pair associated with the key, end() if key not found
-      iterator         find      ( Key const & key );                                 // Returns a read-write iterator to the key/value pair associated with the key, end() if key not found
+      constexpr Value const    & at        ( Key const & key ) const;                 // Returns the value associated with given key.  Throws std::out_of_range if key not found
+      constexpr Value          & at        ( Key const & key )        requires MUTABLE_VALUES;   // Returns the value associated with given key.  Throws std::out_of_range if key not found
+      constexpr Value          & operator[]( Key const & key )        requires MUTABLE_VALUES;   // Returns the value associated with given key, performing an insertion if such key does not already exist.
+      constexpr const_iterator   find      ( Key const & key ) const;                 // Returns a read-only iterator to the key/value pair associated with the key, end() if key not found
+      constexpr iterator         find      ( Key const & key );                       // Returns a read-write iterator to the key/value pair associated with the key, end() if key not found
+
+      template <typename K>  requires TransparentCompare<Compare>  constexpr Value const    & at        ( K const & key ) const;   // Heterogeneous lookup versions of the above.  K need only be comparable
+      template <typename K>  requires TransparentCompare<Compare>  constexpr Value          & at        ( K const & key )        requires MUTABLE_VALUES;   // with Key, and is converted to Key only when operator[] inserts a new
+      template <typename K>  requires TransparentCompare<Compare>  constexpr Value          & operator[]( K const & key )        requires MUTABLE_VALUES;   // element
+      template <typename K>  requires TransparentCompare<Compare>  constexpr const_iterator   find      ( K const & key ) const;
+      template <typename K>  requires TransparentCompare<Compare>  constexpr iterator         find      ( K const & key );
+
+
+
+      // Range Queries - O(log n) to locate the bound, then walk the range with the iterators
+      constexpr const_iterator                                lower_bound( Key const & key ) const;   // Returns an iterator to the first element whose key is not less than key, end() if none
+      constexpr iterator                                      lower_bound( Key const & key );
+      constexpr const_iterator                                upper_bound( Key const & key ) const;   // Returns an iterator to the first element whose key is greater than key, end() if none
+      constexpr iterator                                      upper_bound( Key const & key );
+      constexpr std::pair<const_iterator, const_iterator>     equal_range( Key const & key ) const;   // Returns [lower_bound, upper_bound), which holds at most one element
+      constexpr std::pair<iterator,       iterator      >     equal_range( Key const & key );
+
+      template <typename K>  requires TransparentCompare<Compare>  constexpr const_iterator                            lower_bound( K const & key ) const;
+      template <typename K>  requires TransparentCompare<Compare>  constexpr iterator                                  lower_bound( K const & key );
+      template <typename K>  requires TransparentCompare<Compare>  constexpr const_iterator                            upper_bound( K const & key ) const;
+      template <typename K>  requires TransparentCompare<Compare>  constexpr iterator                                  upper_bound( K const & key );
+      template <typename K>  requires TransparentCompare<Compare>  constexpr std::pair<const_iterator, const_iterator> equal_range( K const & key ) const;
+      template <typename K>  requires TransparentCompare<Compare>  constexpr std::pair<iterator,       iterator      > equal_range( K const & key );
+
+
+
+      // Order Statistics and Aggregates - O(log n), using the summaries kept by the Augment policy
+      constexpr const_iterator nth      ( std::size_t k                  ) const  requires CountingSummary<Summary>;   // Returns an iterator to the k'th element (counting from 0) in key order, end() if k >= size()
+      constexpr iterator       nth      ( std::size_t k                  )        requires CountingSummary<Summary>;
+      constexpr std::size_t    rank     ( Key const & key                ) const  requires CountingSummary<Summary>;   // Returns the number of elements whose keys are less than key
+      constexpr Summary        aggregate(                                ) const;     // Returns the summary of the entire tree
+      constexpr Summary        aggregate( Key const & lo, Key const & hi ) const;     // Returns the summary of the elements whose keys are in [lo, hi)
 
 
 
       // Modifiers
-      std::pair<iterator, bool> insert( KeyValue_Pair const & pair     );             // Inserts a key-value pair into the container, if the container doesn't already contain an element with an equivalent key.
+      constexpr std::pair<iterator, bool> insert( KeyValue_Pair const & pair     );   // Inserts a key-value pair into the container, if the container doesn't already contain an element with an equivalent key.
+      template <typename M>
+      constexpr std::pair<iterator, bool> insert_or_assign( Key const & key, M && value );   // Inserts a key-value pair, or assigns value to the existing element's, keeping the summaries current
       std::size_t               erase ( Key           const & key      );             // Removes the matching node and returns the number of elements removed (0 or 1)
       iterator                  erase ( const_iterator        position );             // Removes the pointed-to node and returns the iterator following the removed element
-      void                      clear (                                );             // Returns the tree to an empty state releasing all nodes
+      constexpr void                      clear (                                );   // Returns the tree to an empty state releasing all nodes
+
+      template <std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+      constexpr void assign      ( InputIt first, Sentinel last );                    // Replaces the contents with [first, last), O(n) if the range is sorted, O(n log n) otherwise
+      template <std::ranges::input_range R>
+      constexpr void insert_range( R && range );                                      // Inserts a batch of key-value pairs, O(m log m + n) for a batch of m pairs
+
+      // Set operations relink other's nodes, never copy them, leaving other empty.  O(m log(n/m + 1)) for trees of m and n elements,
+      // m <= n.  When both trees have an element with the same key, this tree's is kept
+      constexpr void unite       ( BinarySearchTree && other   );                     // Adds other's elements with keys not already in this tree
+      constexpr void intersect   ( BinarySearchTree && other   );                     // Removes the elements whose keys are not in other
+      constexpr void subtract    ( BinarySearchTree && other   );                     // Removes the elements whose keys are in other
+      constexpr void join        ( BinarySearchTree && greater );                     // Appends greater, every key of which must be greater than this tree's, O(log n)
+
+      void compact      ( TreeLayout layout = TreeLayout::VAN_EMDE_BOAS );            // Moves the nodes into contiguous memory in the given order.  Invalidates all iterators
+      void shrink_to_fit(                                               );            // Returns the node pool's unused blocks to the allocator
 
 
 
       // Relational Operators
-      std::weak_ordering operator<=>( BinarySearchTree const & rhs ) const;
-      bool               operator== ( BinarySearchTree const & rhs ) const;
+      constexpr std::weak_ordering operator<=>( BinarySearchTree const & rhs ) const;
+      constexpr bool               operator== ( BinarySearchTree const & rhs ) const;
 
 
 
     private:
       // Private Types
       struct Node;
+      struct Pool;                                                                    // Where run time nodes come from and go back to
+      using  Height       = std::uint8_t;
+      using  Augmentation = Augment<KeyValue_Pair>;
+
+      static constexpr bool AUGMENTED = !std::is_empty_v<Summary>;                    // A stateless summary has nothing to maintain
 
 
 
       // Member instance attributes
+      std::unique_ptr<Pool> _pool;                                                    // Created with the first node (declared first, makeCopy() uses it while _root is initialized)
       Node *      _root = nullptr;
       std::size_t _size = 0;
+      [[no_unique_address]] Compare _compare = Compare{};                             // Stateless comparators (the usual case) take no space
 
 
 
       // Helper functions
-      bool   isBalanced  ( Node * current       ) const;
-      Node * predecessor ( Node * current       ) const;
-      Node * successor   ( Node * current       ) const;
-      Node * reBalance   ( Node * offendingNode );
-      Node * makeCopy    ( Node * current       );
-      void   updateHeight( Node * current       );
-      void   clear       ( Node * current       );
+      constexpr bool   isBalanced  ( Node * current       ) const;
+      constexpr Node * predecessor ( Node * current       ) const;
+      constexpr Node * successor   ( Node * current       ) const;
+      constexpr Node * reBalance   ( Node * offendingNode );
+      constexpr Node * makeCopy    ( Node * current       );
+      constexpr void   updateHeight( Node * current       );                          // and the node's summary
+      constexpr void   updateSummaries( Node * current    );                          // from current up to the root
+      static constexpr Summary summaryOf( Node * current  );
+      constexpr void   clear       ( Node * current       );
+      constexpr Node * attach      ( Node * newNode, Node * parent, std::weak_ordering comp );
+
+      template <typename... Args>  constexpr Node * makeNode   ( Args &&... args );   // A new node from the tree's node pool
+                                   constexpr void   destroyNode( Node * node ) noexcept;   // Returns the node to the tree's node pool, null is ignored
+
+      template <typename L, typename R>  constexpr std::weak_ordering compare   ( L const & lhs, R const & rhs ) const;
+      template <typename K>              constexpr Node *             findNode  ( K const & key ) const;
+      template <typename K>              constexpr Node *             lowerBound( K const & key ) const;
+      template <typename K>              constexpr Node *             upperBound( K const & key ) const;
+
+      template <typename InputIt, typename Sentinel>
+      constexpr std::vector<Node *> makeNodes    ( InputIt first, Sentinel last );
+      constexpr void                sortUnique   ( std::vector<Node *> & nodes );
+      constexpr void                flatten      ( Node * current, std::vector<Node *> & nodes ) const;
+      constexpr Node *              buildBalanced( std::span<Node * const> nodes, Node * parent );
+      constexpr void                layoutVanEmdeBoas( Node * current, std::size_t levels, std::vector<Node *> & nodes ) const;
+      constexpr void                layoutBottoms    ( Node * current, std::size_t depth, std::size_t levels, std::vector<Node *> & nodes ) const;
+
+      // Join based set operations on detached subtrees.  Each returns the root of the resulting subtree, whose parent pointer may be stale
+      static constexpr int                 heightOf ( Node * current );               // -1 for an empty subtree
+      constexpr Node *                     join     ( Node * left, Node * middle, Node * right );
+      constexpr Node *                     join     ( Node * left, Node * right );
+      constexpr std::tuple<Node *, Node *, Node *> split( Node * current, Key const & key );   // the keys less than key, the node with key (or null), the keys greater
+      constexpr std::pair <Node *, Node *> splitLast( Node * current );               // all but the greatest key, the node with the greatest key
+      constexpr Node *                     unite    ( Node * lhs, Node * rhs );
+      constexpr Node *                     intersect( Node * lhs, Node * rhs );
+      constexpr Node *                     subtract ( Node * lhs, Node * rhs );
+      constexpr void                       adopt    ( BinarySearchTree & other );     // makes other's nodes this tree's to keep or destroy
 
 
 
@@ -163,13 +390,13 @@ export namespace CSUF::CPSC131
 
 
   /*******************************************************************************
-  ** Class BinarySearchTree<Key, Value>::Iterator - A bi-directional iterator
+  ** Class BinarySearchTree<Key, Value, Compare, Augment>::Iterator - A bi-directional iterator
   **
    *******************************************************************************/
-  template<typename Key, typename Value>  template<typename U>
-  class BinarySearchTree<Key, Value>::Iterator_type
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename U>
+  class BinarySearchTree<Key, Value, Compare, Augment>::Iterator_type
   {
-    friend class BinarySearchTree<Key, Value>;
+    friend class BinarySearchTree<Key, Value, Compare, Augment>;
 
     public:
       // Iterator Type Traits - Boilerplate stuff so the iterator can be used with the rest of the standard library
@@ -184,31 +411,31 @@ export namespace CSUF::CPSC131
       // Compiler synthesized constructors and destructor are fine, just what we want (shallow copies, no ownership) but needed to
       // explicitly say that because there is also a user defined constructor
       Iterator_type(                        );                                        // Default constructed Iterator_type returns a pseudo Sentinel (null pointer in this case)
-      Iterator_type( iterator const & other ) noexcept;                               // Copy constructor when U is non-const, Conversion constructor from non-const to const iterator when U is const
+      constexpr Iterator_type( iterator const & other ) noexcept;                     // Copy constructor when U is non-const, Conversion constructor from non-const to const iterator when U is const
                                                                                       // Note parameter type is intentionally "iterator", not "Iterator_type"
 
 
       // Pre and post Increment operators move the position to the next node in the list
-      Iterator_type & operator++();                                                   // advance the iterator one node in-order (pre -increment)
-      Iterator_type   operator++( int );                                              // advance the iterator one node in-order (post-increment)
+      constexpr Iterator_type & operator++();                                         // advance the iterator one node in-order (pre -increment)
+      constexpr Iterator_type   operator++( int );                                    // advance the iterator one node in-order (post-increment)
 
 
 
       // Pre and post Decrement operators move the position to the previous node in the list
-      Iterator_type & operator--();                                                   // retreat the iterator one node in-order (pre -decrement)
-      Iterator_type   operator--( int );                                              // retreat the iterator one node in-order (post-decrement)
+      constexpr Iterator_type & operator--();                                         // retreat the iterator one node in-order (pre -decrement)
+      constexpr Iterator_type   operator--( int );                                    // retreat the iterator one node in-order (post-decrement)
 
 
 
       // Dereferencing and member access operators provide access to data. The iterator itself can be constant or non-constant, but,
       // by definition, points to a non-constant linked list.
-      reference operator* () const;
-      pointer   operator->() const;
+      constexpr reference operator* () const;
+      constexpr pointer   operator->() const;
 
 
 
       // Equality operators
-      bool operator==( Iterator_type const & rhs ) const;                             // Symmetrically compares all const & non-const iterator combinations, with the help of the Conversion constructor above
+      constexpr bool operator==( Iterator_type const & rhs ) const;                   // Symmetrically compares all const & non-const iterator combinations, with the help of the Conversion constructor above
 
 
 
@@ -219,7 +446,7 @@ export namespace CSUF::CPSC131
 
 
       // Helper functions
-      Iterator_type( Node * position ) noexcept;                                      // Implicit conversion constructor from pointer-to-Node to iterator-to-Node
+      constexpr Iterator_type( Node * position ) noexcept;                            // Implicit conversion constructor from pointer-to-Node to iterator-to-Node
   };  // BinarySearchTree<U>::Iterator_type
 
 }    // export namespace CSUF::CPSC131
@@ -295,62 +522,115 @@ export namespace CSUF::CPSC131
 
 namespace CSUF::CPSC131
 {
+  //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Key comparison function objects
+  //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // ThreeWayCompare<T>
+  template <typename T>
+  constexpr std::weak_ordering ThreeWayCompare<T>::operator()( T const & lhs, T const & rhs ) const
+  { return std::compare_weak_order_fallback( lhs, rhs ); }                            // uses operator== and operator< if operator<=> is unavailable
+
+
+
+
+  // ThreeWayCompare<void> - transparent
+  template <typename L, typename R>
+  constexpr std::weak_ordering ThreeWayCompare<void>::operator()( L const & lhs, R const & rhs ) const
+  {
+    // std::compare_weak_order_fallback requires both operands to be the same type, so keys of different types (e.g., std::string and
+    // std::string_view) are compared directly with operator<=>, or with operator== and operator< if operator<=> is unavailable
+    if      constexpr( std::is_same_v<L, R> )                                                     return std::compare_weak_order_fallback( lhs, rhs );
+    else if constexpr( requires { { lhs <=> rhs } -> std::convertible_to<std::weak_ordering>; } ) return lhs <=> rhs;
+    else                                                                                          return lhs == rhs  ?  std::weak_ordering::equivalent
+                                                                                                       : lhs <  rhs  ?  std::weak_ordering::less
+                                                                                                       :                std::weak_ordering::greater;
+  }
+
+
+
+
   //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
   // A Binary Search Tree node
   //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-  template<typename Key, typename Value>
-  struct BinarySearchTree<Key, Value>::Node
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  struct BinarySearchTree<Key, Value, Compare, Augment>::Node
   {
     // Constructors  (Compiler synthesized copy and move constructors and assignments are fine)
-    Node() = default;
-    Node( KeyValue_Pair const & pair ) : _pair{ pair } {}
+    constexpr Node() = default;
+    constexpr Node( KeyValue_Pair const  & pair ) : _pair{ pair } {}
+    constexpr Node( KeyValue_Pair       && pair ) : _pair{ std::move( pair ) } {}
 
     // Node's Payload (content)
     KeyValue_Pair _pair = { Key{}, Value{} };
 
-    // Adjacent node pointers
-    Node *      _left   = nullptr;
-    Node *      _right  = nullptr;
-    Node *      _parent = nullptr;
+    // Height of subtree rooted at this node.  An AVL tree of height h has at least Fibonacci(h+3)-1 nodes, so even a tree filling a
+    // 64-bit address space is less than 92 high and one byte is plenty.  Placed next to the payload, it can often share the padding
+    // the pointers below would otherwise need.
+    Height        _height = 0;                                                        // Added attribute used only for AVL trees
 
-    // Height of subtree rooted at this node.
-    std::size_t _height = 0;                                                          // Added attribute used only for AVL trees
+    [[no_unique_address]] Summary _summary = {};                                      // Summary of the subtree rooted at this node, see the Augment policy
+
+    // Adjacent node pointers
+    Node *        _left   = nullptr;
+    Node *        _right  = nullptr;
+    Node *        _parent = nullptr;
 
     // Convenience function used mainly as a tool to help create more readable code.  For some pointer-to-Node p, p->key() and
     // p->_pair.first can be used interchangeably but p->key() conveys more information to the reader.
-    Key const & key  () { return _pair.first;  }
-    Value     & value() { return _pair.second; }
+    constexpr Key const & key  () { return _pair.first;  }
+    constexpr Value     & value() { return _pair.second; }
   };
 
 
 
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // A Binary Search Tree's node pool - defined once Node is complete, so its slots can be sized to fit
+  //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  struct BinarySearchTree<Key, Value, Compare, Augment>::Pool : NodePool<sizeof( Node ), alignof( Node )>
+  {};
+
+
+
+
   //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
   // Constructors, destructor, and assignments
   //
   //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
   // Default constructor
-  template<typename Key, typename Value>
-  BinarySearchTree<Key, Value>::BinarySearchTree() = default;
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr BinarySearchTree<Key, Value, Compare, Augment>::BinarySearchTree() = default;
+
+
+
+
+  // Comparison function object constructor
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr BinarySearchTree<Key, Value, Compare, Augment>::BinarySearchTree( Compare const & compare )
+    : _compare{ compare }
+  {}
 
 
 
 
   // Copy constructor
-  template<typename Key, typename Value>
-  BinarySearchTree<Key, Value>::BinarySearchTree( const BinarySearchTree & original )
-    : _root( makeCopy( original._root ) ), _size{ original._size }                    // performs a deep copy, recursively
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr BinarySearchTree<Key, Value, Compare, Augment>::BinarySearchTree( const BinarySearchTree & original )
+    : _root( makeCopy( original._root ) ), _size{ original._size }, _compare{ original._compare }   // performs a deep copy, recursively
   {}
 
 
 
 
   // Move constructor
-  template<typename Key, typename Value>
-  BinarySearchTree<Key, Value>::BinarySearchTree( BinarySearchTree && original ) noexcept
-    : _root{ original._root }, _size{ original._size }                                // performs a shallow copy (takes ownership of the original tree)
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr BinarySearchTree<Key, Value, Compare, Augment>::BinarySearchTree( BinarySearchTree && original ) noexcept
+    : _pool{ std::move( original._pool ) }, _root{ original._root }, _size{ original._size }, _compare{ original._compare }   // performs a shallow copy (takes ownership of the original tree and its nodes' pool)
   {
     original._root = nullptr;                                                         // set the original to an empty tree
     original._size = 0;
@@ -360,27 +640,40 @@ namespace CSUF::CPSC131
 
 
   // Initialization list constructor
-  template<typename Key, typename Value>
-  BinarySearchTree<Key, Value>::BinarySearchTree( std::initializer_list<KeyValue_Pair> init_list )
-    : BinarySearchTree()                                                              // delegate construction of an empty tree
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr BinarySearchTree<Key, Value, Compare, Augment>::BinarySearchTree( std::initializer_list<KeyValue_Pair> init_list )
+    : BinarySearchTree( init_list.begin(), init_list.end() )                          // delegate to the range constructor
+  {}
+
+
+
+
+  // Range constructor
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+  constexpr BinarySearchTree<Key, Value, Compare, Augment>::BinarySearchTree( InputIt first, Sentinel last, Compare const & compare )
+    : _compare{ compare }
   {
-    for( auto && keyValue : init_list ) insert( keyValue );
+    // Rather than inserting the pairs one at a time, each descending O(log n) levels and retracing back up rebalancing along the
+    // way, put the nodes in key order and then link them directly into a perfectly balanced tree.
+    auto nodes = makeNodes( std::move( first ), std::move( last ) );
+    _root = buildBalanced( nodes, nullptr );
+    _size = nodes.size();
   }
 
 
 
 
   // Destructor
-  template<typename Key, typename Value>
-  BinarySearchTree<Key, Value>::~BinarySearchTree() noexcept
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr BinarySearchTree<Key, Value, Compare, Augment>::~BinarySearchTree() noexcept
   { clear(); }
 
 
 
 
   // Copy assignment
-  template<typename Key, typename Value>
-  BinarySearchTree<Key, Value> & BinarySearchTree<Key, Value>::operator=( BinarySearchTree const & rhs )
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr BinarySearchTree<Key, Value, Compare, Augment> & BinarySearchTree<Key, Value, Compare, Augment>::operator=( BinarySearchTree const & rhs )
   {
     if( this != &rhs )    // self assignment guard
     {
@@ -396,14 +689,16 @@ namespace CSUF::CPSC131
 
 
   // Move assignment
-  template<typename Key, typename Value>
-  BinarySearchTree<Key, Value> & BinarySearchTree<Key, Value>::operator=( BinarySearchTree && rhs ) noexcept
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr BinarySearchTree<Key, Value, Compare, Augment> & BinarySearchTree<Key, Value, Compare, Augment>::operator=( BinarySearchTree && rhs ) noexcept
   {
     if( this != &rhs )    // self assignment guard
     {
       clear();
+      _pool     = std::move( rhs._pool );    // the nodes go where they came from, so the pool comes along
       _root     = rhs._root;    // perform a shallow copy (takes ownership of the original tree)
       _size     = rhs._size;
+      _compare  = rhs._compare;
 
       rhs._root = nullptr;    // set the original to an empty tree
       rhs._size = 0;
@@ -420,25 +715,41 @@ namespace CSUF::CPSC131
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
   // size()
-  template<typename Key, typename Value>
-  std::size_t BinarySearchTree<Key, Value>::size() const noexcept
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr std::size_t BinarySearchTree<Key, Value, Compare, Augment>::size() const noexcept
   { return _size; }
 
 
 
 
   // empty()
-  template<typename Key, typename Value>
-  bool BinarySearchTree<Key, Value>::empty() const noexcept
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr bool BinarySearchTree<Key, Value, Compare, Augment>::empty() const noexcept
   { return size() == 0; }
 
 
 
 
   // contains()
-  template<typename Key, typename Value>
-  bool BinarySearchTree<Key, Value>::contains( const Key & key ) const
-  { return find( key ) != end(); }
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr bool BinarySearchTree<Key, Value, Compare, Augment>::contains( const Key & key ) const
+  { return findNode( key ) != nullptr; }
+
+
+
+
+  // contains() - heterogeneous lookup
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename K>  requires TransparentCompare<Compare>
+  constexpr bool BinarySearchTree<Key, Value, Compare, Augment>::contains( K const & key ) const
+  { return findNode( key ) != nullptr; }
+
+
+
+
+  // key_comp()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr Compare BinarySearchTree<Key, Value, Compare, Augment>::key_comp() const
+  { return _compare; }
 
 
 
@@ -449,8 +760,8 @@ namespace CSUF::CPSC131
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
   // begin()
-  template<typename Key, typename Value>
-  typename BinarySearchTree<Key, Value>::iterator BinarySearchTree<Key, Value>::begin() noexcept
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::iterator BinarySearchTree<Key, Value, Compare, Augment>::begin() noexcept
   {
     if( _root == nullptr ) return end();
 
@@ -463,40 +774,40 @@ namespace CSUF::CPSC131
 
 
   // end()
-  template<typename Key, typename Value>
-  typename BinarySearchTree<Key, Value>::iterator BinarySearchTree<Key, Value>::end() noexcept
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::iterator BinarySearchTree<Key, Value, Compare, Augment>::end() noexcept
   { return nullptr; }
 
 
 
 
   // begin() const
-  template<typename Key, typename Value>
-  typename BinarySearchTree<Key, Value>::const_iterator BinarySearchTree<Key, Value>::begin() const noexcept
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::const_iterator BinarySearchTree<Key, Value, Compare, Augment>::begin() const noexcept
   { return const_cast<BinarySearchTree &>( *this ).begin(); }                         // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
 
 
 
 
   // end() const
-  template<typename Key, typename Value>
-  typename BinarySearchTree<Key, Value>::const_iterator BinarySearchTree<Key, Value>::end() const noexcept
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::const_iterator BinarySearchTree<Key, Value, Compare, Augment>::end() const noexcept
   { return const_cast<BinarySearchTree &>( *this ).end(); }                           // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
 
 
 
 
   // cbegin() const
-  template<typename Key, typename Value>
-  typename BinarySearchTree<Key, Value>::const_iterator BinarySearchTree<Key, Value>::cbegin() const noexcept
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::const_iterator BinarySearchTree<Key, Value, Compare, Augment>::cbegin() const noexcept
   { return const_cast<BinarySearchTree &>( *this ).begin(); }                         // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
 
 
 
 
   // cend() const
-  template<typename Key, typename Value>
-  typename BinarySearchTree<Key, Value>::const_iterator BinarySearchTree<Key, Value>::cend() const noexcept
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::const_iterator BinarySearchTree<Key, Value, Compare, Augment>::cend() const noexcept
   { return const_cast<BinarySearchTree &>( *this ).end(); }                           // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
 
 
@@ -508,16 +819,8 @@ namespace CSUF::CPSC131
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
   // at() const
-  template<typename Key, typename Value>
-  const Value & BinarySearchTree<Key, Value>::at( const Key & key ) const
-  { return const_cast<BinarySearchTree &>( *this ).at( key ); }                       // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
-
-
-
-
-  // at()
-  template<typename Key, typename Value>
-  Value & BinarySearchTree<Key, Value>::at( const Key & key )
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr const Value & BinarySearchTree<Key, Value, Compare, Augment>::at( const Key & key ) const
   {
     auto it = find( key );
 
@@ -528,9 +831,17 @@ namespace CSUF::CPSC131
 
 
 
+  // at()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr Value & BinarySearchTree<Key, Value, Compare, Augment>::at( const Key & key )  requires MUTABLE_VALUES
+  { return const_cast<Value &>( std::as_const( *this ).at( key ) ); }                 // to ensure consistent behavior and to implement the logic in one place, delegate to const version (the only one when values are read-only)
+
+
+
+
   // operator[]
-  template<typename Key, typename Value>
-  Value & BinarySearchTree<Key, Value>::operator[]( const Key & key )
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr Value & BinarySearchTree<Key, Value, Compare, Augment>::operator[]( const Key & key )  requires MUTABLE_VALUES
   {
     // Delegate to insert().  insert() will add a new {key, value} pair to the tree with a default constructed value if the key does
     // not exist and returns an iterator pointing to this new {key, value} pair. Otherwise, insert() locates the existing {key,
@@ -545,218 +856,708 @@ namespace CSUF::CPSC131
 
 
   // find() const
-  template<typename Key, typename Value>
-  typename BinarySearchTree<Key, Value>::const_iterator    BinarySearchTree<Key, Value>::find( const Key & key ) const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::const_iterator    BinarySearchTree<Key, Value, Compare, Augment>::find( const Key & key ) const
   { return const_cast<BinarySearchTree &>( *this ).find( key ); }                     // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
 
 
 
 
   // find()
-  template<typename Key, typename Value>
-  typename BinarySearchTree<Key, Value>::iterator    BinarySearchTree<Key, Value>::find( const Key & key )
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::iterator    BinarySearchTree<Key, Value, Compare, Augment>::find( const Key & key )
+  { return findNode( key ); }                                                         // end() is a null pointer, so not found converts to end()
+
+
+
+
+  // at() const - heterogeneous lookup
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename K>  requires TransparentCompare<Compare>
+  constexpr const Value & BinarySearchTree<Key, Value, Compare, Augment>::at( K const & key ) const
   {
-    auto current = _root;
+    auto node = findNode( key );
+
+    if( node == nullptr )   throw std::out_of_range( exceptionString( "Failure:  Attempted to access nonexistent element" ) );
+    return node->value();
+  }
+
+
+
+
+  // at() - heterogeneous lookup
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename K>  requires TransparentCompare<Compare>
+  constexpr Value & BinarySearchTree<Key, Value, Compare, Augment>::at( K const & key )  requires MUTABLE_VALUES
+  { return const_cast<Value &>( std::as_const( *this ).at( key ) ); }                 // to ensure consistent behavior and to implement the logic in one place, delegate to const version (the only one when values are read-only)
+
+
+
+
+  // operator[] - heterogeneous lookup
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename K>  requires TransparentCompare<Compare>
+  constexpr Value & BinarySearchTree<Key, Value, Compare, Augment>::operator[]( K const & key )  requires MUTABLE_VALUES
+  {
+    // Same descent as insert(), but searching with K.  A Key is constructed from K only if the key is not already in the tree, so
+    // finding an existing element never creates a temporary Key.
+    Node *             current = _root;
+    Node *             parent  = nullptr;
+    std::weak_ordering comp    = std::weak_ordering::equivalent;
 
     while( current != nullptr )
     {
-      auto comp = std::compare_weak_order_fallback( key, current->key() );            // uses operator== and operator< if operator<=> is unavailable
-      if     ( comp == 0 )  return current;
-      else if( comp  < 0 )  current = current->_left;
-      else                  current = current->_right;
+      comp = compare( key, current->key() );
+      if( comp == 0 ) return current->value();                                        // found it
+
+      parent = current;
+      current = comp < 0  ?  current->_left  :  current->_right;
     }
 
-    return end();
+    return attach( makeNode( KeyValue_Pair{ Key( key ), Value{} } ), parent, comp )->value();
   }
 
 
 
 
+  // find() const - heterogeneous lookup
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename K>  requires TransparentCompare<Compare>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::const_iterator    BinarySearchTree<Key, Value, Compare, Augment>::find( K const & key ) const
+  { return const_cast<BinarySearchTree &>( *this ).find( key ); }                     // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
+
+
+
+
+  // find() - heterogeneous lookup
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename K>  requires TransparentCompare<Compare>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::iterator    BinarySearchTree<Key, Value, Compare, Augment>::find( K const & key )
+  { return findNode( key ); }
+
+
+
+
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-  // Modifiers
+  // Range Queries
   //
+  //  The bounds are found with a single descent from the root, so a scan of the k elements in [lo, hi) costs O(log n + k):
+  //     for( auto i = tree.lower_bound( lo ),  last = tree.lower_bound( hi );   i != last;   ++i ) ...
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-  // insert()
-  template<typename Key, typename Value>
-  std::pair<typename BinarySearchTree<Key, Value>::iterator, bool>   BinarySearchTree<Key, Value>::insert( const KeyValue_Pair & pair )
-  {
-    Node *             current = _root;
-    Node *             parent  = nullptr;
-    std::weak_ordering comp    = std::weak_ordering::equivalent;
+  // lower_bound() const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::const_iterator BinarySearchTree<Key, Value, Compare, Augment>::lower_bound( Key const & key ) const
+  { return lowerBound( key ); }
 
 
-    // Work your way to the bottom of the tree ...
-    while( current != nullptr )
-    {                                                                                 // perform the comparison and remember the results.  if operator<=>() is not defined
-      comp = std::compare_weak_order_fallback( pair.first, current->key() );          // for type Key, then fall back to using operator<() and operator==()
 
-      if( comp == 0 ) return { current, false };                                      // duplicate key found;  return the node found and indicate nothing was added to the tree
 
-      parent = current;                                                               // remember who my daddy is and then descend down to the child
-      if( comp  < 0 ) current = current->_left ;                                      // if key to insert is less than the current key, go left
-      else            current = current->_right;                                      //   otherwise, go right
-    }
+  // lower_bound()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::iterator BinarySearchTree<Key, Value, Compare, Augment>::lower_bound( Key const & key )
+  { return lowerBound( key ); }
 
-    // Insert the new node in place (i.e., as the root node, or the left or right child node)
-    Node * newNode   = new Node( pair );                                              // construction of node initializes all its pointers to null (programming note: smart pointer opportunity here)
-    newNode->_parent = parent;                                                        // let the child know who's its daddy
 
-    if     ( parent == nullptr ) _root          = newNode;                            // let daddy (the parent) adopt the child
-    else if( comp   <  0       ) parent->_left  = newNode;
-    else                         parent->_right = newNode;
 
-    ++_size;                                                                          // and of course increment the tree's size
 
-    /************** AVL Tree Unique ************************************************************************************************
-    ** Self balancing BSTs, like this AVL tree, balances the left and right subtrees as part of insertion.  Work your way from the
-    ** node just inserted (which is at the bottom of the tree) all the way up to the tree's root updating height and looking for
-    ** unbalanced subtrees
-    **
-    ** Balance Factor at this node calculated as Height(Left) - Height(Right)
-    ** Note:  WikiBooks defines the balance factor to be Height(Right) - Height(Left)   https://en.wikipedia.org/wiki/AVL_tree
-    **        VisuAlgo  defines the balance factor to be Height(Left)  - Height(Right)  https://visualgo.net/en/bst
-    **        I tend to use Height(Left) - Height(Right) in classroom lectures, but it really doesn't matter. If abs( Height(Left) -
-    **        Height(Right) ) >= 2, then it needs to be rebalanced
-    *******************************************************************************************************************************/
-    for( current = parent;  current != nullptr;  current = current->_parent)          // we know the node just inserted has no children, has height of 0, and is
-    {                                                                                 // balanced, so we can start with it's parent and save looking at one node
-      auto previousHeight = current->_height;
-      updateHeight( current );
+  // upper_bound() const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::const_iterator BinarySearchTree<Key, Value, Compare, Augment>::upper_bound( Key const & key ) const
+  { return upperBound( key ); }
 
-      if( !isBalanced( current ) )   current = reBalance( current );                  // if offending node found, let's fix it
 
-      if( previousHeight == current->_height ) break;                                 // height has not changed, node insertion has been absorbed, and we can stop back tracing
-    }
-    /************** End AVL Tree Unique *******************************************************************************************/
 
 
-    // return the added node and indicate something was added to the tree
-    return { newNode, true };
-  }
+  // upper_bound()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::iterator BinarySearchTree<Key, Value, Compare, Augment>::upper_bound( Key const & key )
+  { return upperBound( key ); }
 
 
 
 
-  // erase( key )
-  template<typename Key, typename Value>
-  std::size_t BinarySearchTree<Key, Value>::erase( const Key & key )                  // returns the number of nodes removed (0 or 1)
-  {
-    auto position = find( key );
+  // equal_range() const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr std::pair<typename BinarySearchTree<Key, Value, Compare, Augment>::const_iterator, typename BinarySearchTree<Key, Value, Compare, Augment>::const_iterator>
+  BinarySearchTree<Key, Value, Compare, Augment>::equal_range( Key const & key ) const
+  { return const_cast<BinarySearchTree &>( *this ).equal_range( key ); }              // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
 
-    if( position == end() ) return 0;                                                 // if the key wasn't found, no nodes have been deleted
 
-    erase( position );
-    return 1;                                                                         // otherwise, one node (remember, no duplicates) has been removed
+
+
+  // equal_range()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr std::pair<typename BinarySearchTree<Key, Value, Compare, Augment>::iterator, typename BinarySearchTree<Key, Value, Compare, Augment>::iterator>
+  BinarySearchTree<Key, Value, Compare, Augment>::equal_range( Key const & key )
+  {
+    iterator first = lowerBound( key );                                               // Keys are unique, so the range is either empty or holds
+    iterator last  = first;                                                           // just the lower bound.  Either way, it takes only one descent
+    if( first != end()  &&  compare( key, first->first ) == 0 )   ++last;
+    return { first, last };
   }
 
 
 
 
-  // erase( iterator )
-  template<typename Key, typename Value>
-  typename BinarySearchTree<Key, Value>::iterator   BinarySearchTree<Key, Value>::erase( const_iterator position )
-  {
-    if( position == cend() ) return end();                                            // empty tree, do nothing
+  // lower_bound() const - heterogeneous lookup
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename K>  requires TransparentCompare<Compare>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::const_iterator BinarySearchTree<Key, Value, Compare, Augment>::lower_bound( K const & key ) const
+  { return lowerBound( key ); }
 
-    Node * to_be_erased = position._nodePtr;                                          // convert the iterator to a pointer-to-Node for convenience
 
-    if( to_be_erased->_left != nullptr  &&  to_be_erased->_right != nullptr )         // two children (programming note: a non-null pointer is "true")
-    {
-      Node * succ_ptr = successor( to_be_erased );
-      // Move (don't copy) {key, value} pair from succ_ptr to to_be_erased
-      //
-      // Programming note:  The {key, value} pair's Key is constant to protect from (unintentionally ?) altering it and thus
-      //   breaking the tree's key ordering invariant.  But in this specific case, we really do need to overwrite the key's content.
-      //   So let's temporarily cast away its const-ness and assign the new content
-      const_cast<Key &>( to_be_erased->key  () ) =  const_cast<Key &&>( succ_ptr->key  () );  // Programming note:  casting to a non-constant R-Value reference causes the move assignment operator to be called
-                         to_be_erased->value()   =  std::move         ( succ_ptr->value() );
-      erase( succ_ptr );
-      return to_be_erased;                                                            // return the same node, but with updated content
-    }
 
-    else                                                                              // zero or one child
-    {
-      Node ** parent = to_be_erased->_parent        == nullptr      ? & _root         // "parent" is a pointer-to-pointer-to-Node; tells us what pointer to update
-                   :   to_be_erased->_parent->_left == to_be_erased ? & to_be_erased->_parent->_left
-                   :                                                  & to_be_erased->_parent->_right;
 
-      Node * child = to_be_erased->_left != nullptr  ?  to_be_erased->_left  :  to_be_erased->_right;
+  // lower_bound() - heterogeneous lookup
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename K>  requires TransparentCompare<Compare>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::iterator BinarySearchTree<Key, Value, Compare, Augment>::lower_bound( K const & key )
+  { return lowerBound( key ); }
 
-      *parent = child;                                                                // remove me from the tree by making my parent point to my child
-      if( child != nullptr )  child->_parent = to_be_erased->_parent;                 // and my child point to my parent
 
 
-      /************** AVL Tree Unique **********************************************************************************************
-      ** Self balancing BSTs, like this AVL tree, balances the left and right subtrees as part of erase.  Work your way from the
-      ** node just erased (which is at the bottom of the tree) all the way up to the tree's root updating height and looking for
-      ** unbalanced subtrees
-      **
-      ** Balance Factor at this node calculated as Height(Left) - Height(Right)
-      ** Note:  WikiBooks defines the balance factor to be Height(Right) - Height(Left)   https://en.wikipedia.org/wiki/AVL_tree
-      **        VisuAlgo  defines the balance factor to be Height(Left)  - Height(Right)  https://visualgo.net/en/bst
-      **        I tend to use Height(Left) - Height(Right) in classroom lectures, but it really doesn't matter. If abs( Height(Left) -
-      **        Height(Right) ) >= 2, then it needs to be rebalanced
-      *****************************************************************************************************************************/
-      for( auto current = to_be_erased->_parent;  current != nullptr;  current = current->_parent )
-      {
-        auto previousHeight = current->_height;
-        updateHeight( current );
 
-        if( !isBalanced( current ) )   current = reBalance( current );                // if offending node found, let's fix it
+  // upper_bound() const - heterogeneous lookup
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename K>  requires TransparentCompare<Compare>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::const_iterator BinarySearchTree<Key, Value, Compare, Augment>::upper_bound( K const & key ) const
+  { return upperBound( key ); }
 
-        if( previousHeight == current->_height ) break;                               // height has not changed, node removal has been absorbed, and we can stop back tracing
-      }
-      /************** End AVL Tree Unique ******************************************************************************************/
 
-      iterator temp = std::next( position )._nodePtr;                                 // converts const_iterator to iterator
-      delete to_be_erased;
-      --_size;
-      return temp;                                                                    // return the node after the one removed
-    }
-  }
 
 
+  // upper_bound() - heterogeneous lookup
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename K>  requires TransparentCompare<Compare>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::iterator BinarySearchTree<Key, Value, Compare, Augment>::upper_bound( K const & key )
+  { return upperBound( key ); }
 
 
-  // clear() - public
-  template<typename Key, typename Value>
-  void BinarySearchTree<Key, Value>::clear()
+
+
+  // equal_range() const - heterogeneous lookup
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename K>  requires TransparentCompare<Compare>
+  constexpr std::pair<typename BinarySearchTree<Key, Value, Compare, Augment>::const_iterator, typename BinarySearchTree<Key, Value, Compare, Augment>::const_iterator>
+  BinarySearchTree<Key, Value, Compare, Augment>::equal_range( K const & key ) const
+  { return const_cast<BinarySearchTree &>( *this ).equal_range( key ); }              // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
+
+
+
+
+  // equal_range() - heterogeneous lookup
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename K>  requires TransparentCompare<Compare>
+  constexpr std::pair<typename BinarySearchTree<Key, Value, Compare, Augment>::iterator, typename BinarySearchTree<Key, Value, Compare, Augment>::iterator>
+  BinarySearchTree<Key, Value, Compare, Augment>::equal_range( K const & key )
   {
-    clear( _root );
-    _root = nullptr;
-    _size = 0;
+    iterator first = lowerBound( key );
+    iterator last  = first;
+    if( first != end()  &&  compare( key, first->first ) == 0 )   ++last;
+    return { first, last };
   }
 
 
 
 
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-  // Relational Operators
+  // Order Statistics and Aggregates
   //
+  //  Every node's summary covers its whole subtree, so a single descent from the root can add up whole subtrees at a time instead
+  //  of visiting their nodes.  For example, with OrderStatistics, the tree's median is *tree.nth( tree.size() / 2 ), and with
+  //  SubtreeSum, the total of the values with keys in [lo, hi) is tree.aggregate( lo, hi ).sum
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-  // operator<=>
-  template<typename Key, typename Value>
-  std::weak_ordering BinarySearchTree<Key, Value>::operator<=>( BinarySearchTree const & rhs ) const
+  // nth() const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::const_iterator BinarySearchTree<Key, Value, Compare, Augment>::nth( std::size_t k ) const  requires CountingSummary<Summary>
+  { return const_cast<BinarySearchTree &>( *this ).nth( k ); }                        // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
+
+
+
+
+  // nth()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::iterator BinarySearchTree<Key, Value, Compare, Augment>::nth( std::size_t k )  requires CountingSummary<Summary>
   {
-    std::size_t i      = 0;
-    std::size_t extent = size() < rhs.size()  ?  size()  :  rhs.size();               // min(size, rhs.size)
+    auto current = _root;
 
-    for (auto p = begin(), q = rhs.begin();   i < extent;   ++i, ++p, ++q)
+    while( current != nullptr )
     {
-      auto result = std::compare_weak_order_fallback( *p, *q );                       // uses operator== and operator< if operator<=> is unavailable
-      if( result != 0 )   return result;                                              // compares both key and value
+      std::size_t lesser = summaryOf( current->_left ).size;                         // the number of elements ahead of current in its subtree
+
+      if     ( k <  lesser )  current = current->_left;
+      else if( k == lesser )  return current;
+      else                  { k -= lesser + 1;  current = current->_right; }         // skip past the left subtree and current itself
     }
-    return size() <=> rhs.size();
+
+    return end();                                                                     // k >= size()
+  }
+
+
+
+
+  // rank()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr std::size_t BinarySearchTree<Key, Value, Compare, Augment>::rank( Key const & key ) const  requires CountingSummary<Summary>
+  {
+    std::size_t count = 0;
+
+    for( auto current = _root;  current != nullptr;  )
+    {
+      if( compare( key, current->key() ) <= 0 )   current = current->_left;
+      else                                      { count  += summaryOf( current->_left ).size + 1;  current = current->_right; }   // current and its left subtree are all less than key
+    }
+
+    return count;
+  }
+
+
+
+
+  // aggregate()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Summary BinarySearchTree<Key, Value, Compare, Augment>::aggregate() const
+  { return summaryOf( _root ); }
+
+
+
+
+  // aggregate( lo, hi )
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Summary BinarySearchTree<Key, Value, Compare, Augment>::aggregate( Key const & lo, Key const & hi ) const
+  {
+    if( compare( lo, hi ) >= 0 )   return Summary{};                                  // an empty range
+
+    // Descend to the first node in range.  It's where the paths down to lo and to hi part ways, everything in range is in its subtree
+    auto split = _root;
+    while( split != nullptr )
+    {
+      if     ( compare( split->key(), lo ) <  0 )   split = split->_right;
+      else if( compare( split->key(), hi ) >= 0 )   split = split->_left;
+      else                                          break;
+    }
+    if( split == nullptr )   return Summary{};
+
+    // Then follow the path toward lo.  Each node on it at or above lo is in range, and so is its entire right subtree.  They are
+    // found from greatest to least, so each is combined in front of what's been gathered so far
+    Summary lesser{};
+    for( auto current = split->_left;  current != nullptr;  )
+    {
+      if( compare( current->key(), lo ) >= 0 )
+      {
+        lesser  = Augmentation::combine( Augmentation::combine( Augmentation::of( current->_pair ), summaryOf( current->_right ) ), lesser );
+        current = current->_left;
+      }
+      else current = current->_right;
+    }
+
+    // And the path toward hi, where each node below hi is in range along with its entire left subtree, found from least to greatest
+    Summary greater{};
+    for( auto current = split->_right;  current != nullptr;  )
+    {
+      if( compare( current->key(), hi ) < 0 )
+      {
+        greater = Augmentation::combine( greater, Augmentation::combine( summaryOf( current->_left ), Augmentation::of( current->_pair ) ) );
+        current = current->_right;
+      }
+      else current = current->_left;
+    }
+
+    return Augmentation::combine( Augmentation::combine( lesser, Augmentation::of( split->_pair ) ), greater );
+  }
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Modifiers
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // insert()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr std::pair<typename BinarySearchTree<Key, Value, Compare, Augment>::iterator, bool>   BinarySearchTree<Key, Value, Compare, Augment>::insert( const KeyValue_Pair & pair )
+  {
+    Node *             current = _root;
+    Node *             parent  = nullptr;
+    std::weak_ordering comp    = std::weak_ordering::equivalent;
+
+
+    // Work your way to the bottom of the tree ...
+    while( current != nullptr )
+    {                                                                                 // perform the comparison and remember the results.  The default Compare falls back to
+      comp = compare( pair.first, current->key() );                                   // using operator<() and operator==() if operator<=>() is not defined for type Key
+
+      if( comp == 0 ) return { current, false };                                      // duplicate key found;  return the node found and indicate nothing was added to the tree
+
+      parent = current;                                                               // remember who my daddy is and then descend down to the child
+      if( comp  < 0 ) current = current->_left ;                                      // if key to insert is less than the current key, go left
+      else            current = current->_right;                                      //   otherwise, go right
+    }
+
+    // return the added node and indicate something was added to the tree
+    return { attach( makeNode( pair ), parent, comp ), true };                        // construction of node initializes all its pointers to null
+  }
+
+
+
+
+  // insert_or_assign()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename M>
+  constexpr std::pair<typename BinarySearchTree<Key, Value, Compare, Augment>::iterator, bool>   BinarySearchTree<Key, Value, Compare, Augment>::insert_or_assign( Key const & key, M && value )
+  {
+    if( auto node = findNode( key );  node != nullptr )
+    {
+      node->value() = std::forward<M>( value );
+      updateSummaries( node );                                                        // the summaries from here up to the root included the old value
+      return { node, false };
+    }
+
+    return insert( { key, std::forward<M>( value ) } );
+  }
+
+
+
+
+  // assign()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+  constexpr void BinarySearchTree<Key, Value, Compare, Augment>::assign( InputIt first, Sentinel last )
+  {
+    *this = BinarySearchTree( std::move( first ), std::move( last ), _compare );      // build the new tree completely before letting the current one go
+  }
+
+
+
+
+  // insert_range()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<std::ranges::input_range R>
+  constexpr void BinarySearchTree<Key, Value, Compare, Augment>::insert_range( R && range )
+  {
+    auto        batch = makeNodes( std::ranges::begin( range ), std::ranges::end( range ) );   // the new pairs, sorted and without duplicate keys
+    std::size_t next  = 0;                                                            // batch[next] onward is not yet part of the tree
+
+    try
+    {
+      // A small batch is cheaper to insert one node at a time, O(m log n), than to merge with every node in the tree, O(n + m)
+      if( batch.size() * std::bit_width( _size )  <  _size )
+      {
+        for( ; next < batch.size(); ++next )
+        {
+          Node *             current = _root;
+          Node *             parent  = nullptr;
+          std::weak_ordering comp    = std::weak_ordering::equivalent;
+
+          while( current != nullptr  &&  ( comp = compare( batch[next]->key(), current->key() ) ) != 0 )
+          {
+            parent  = current;
+            current = comp < 0  ?  current->_left  :  current->_right;
+          }
+
+          if( current != nullptr )   destroyNode( batch[next] );                      // key already in the tree, the existing pair wins
+          else                       attach( batch[next], parent, comp );
+        }
+        return;
+      }
+
+      // Otherwise, merge the batch with the tree's nodes (both already in key order) and relink them all into a balanced tree.  The
+      // tree is not touched until the merge is complete.
+      std::vector<Node *> existing;
+      std::vector<Node *> merged;
+      std::vector<Node *> duplicates;
+      existing.reserve( _size );
+      merged  .reserve( _size + batch.size() );
+      flatten( _root, existing );
+
+      auto i = existing.begin();
+      auto j = batch   .begin();
+      while( i != existing.end()  &&  j != batch.end() )
+      {
+        auto comp = compare( ( *j )->key(), ( *i )->key() );
+        if     ( comp  < 0 )   merged.push_back( *j++ );
+        else if( comp  > 0 )   merged.push_back( *i++ );
+        else                 { merged.push_back( *i++ );   duplicates.push_back( *j++ ); }   // key already in the tree, the existing pair wins
+      }
+      merged.insert( merged.end(), i, existing.end() );
+      merged.insert( merged.end(), j, batch   .end() );
+
+      _root = buildBalanced( merged, nullptr );
+      _size = merged.size();
+      next  = batch.size();
+
+      for( auto node : duplicates ) destroyNode( node );
+    }
+    catch( ... )
+    {
+      for( ; next < batch.size(); ++next ) destroyNode( batch[next] );                // release the nodes the tree never took
+      throw;
+    }
+  }
+
+
+
+
+  // unite()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr void BinarySearchTree<Key, Value, Compare, Augment>::unite( BinarySearchTree && other )
+  {
+    if( this == &other ) return;
+
+    adopt( other );                                                                   // other's nodes become this tree's, and so do any duplicates destroyed along the way
+    _size += std::exchange( other._size, 0 );
+    _root  = unite( std::exchange( _root, nullptr ), std::exchange( other._root, nullptr ) );
+    if( _root != nullptr )   _root->_parent = nullptr;
+  }
+
+
+
+
+  // intersect()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr void BinarySearchTree<Key, Value, Compare, Augment>::intersect( BinarySearchTree && other )
+  {
+    if( this == &other ) return;
+
+    adopt( other );
+    _size += std::exchange( other._size, 0 );
+    _root  = intersect( std::exchange( _root, nullptr ), std::exchange( other._root, nullptr ) );
+    if( _root != nullptr )   _root->_parent = nullptr;
+  }
+
+
+
+
+  // subtract()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr void BinarySearchTree<Key, Value, Compare, Augment>::subtract( BinarySearchTree && other )
+  {
+    if( this == &other ) { clear();  return; }
+
+    adopt( other );
+    _size += std::exchange( other._size, 0 );
+    _root  = subtract( std::exchange( _root, nullptr ), std::exchange( other._root, nullptr ) );
+    if( _root != nullptr )   _root->_parent = nullptr;
+  }
+
+
+
+
+  // join()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr void BinarySearchTree<Key, Value, Compare, Augment>::join( BinarySearchTree && greater )
+  {
+    if( greater._root == nullptr ) return;
+
+    if( _root != nullptr )
+    {
+      Node * last  = _root;          while( last ->_right != nullptr )   last  = last ->_right;
+      Node * first = greater._root;  while( first->_left  != nullptr )   first = first->_left;
+
+      if( compare( last->key(), first->key() ) >= 0 )   throw std::invalid_argument( exceptionString( "Failure:  Attempted to join a tree whose keys are not all greater" ) );
+    }
+
+    adopt( greater );
+    _size += std::exchange( greater._size, 0 );
+    _root  = join( std::exchange( _root, nullptr ), std::exchange( greater._root, nullptr ) );
+    _root->_parent = nullptr;
+  }
+
+
+
+
+  // erase( key )
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  std::size_t BinarySearchTree<Key, Value, Compare, Augment>::erase( const Key & key )                  // returns the number of nodes removed (0 or 1)
+  {
+    auto position = find( key );
+
+    if( position == end() ) return 0;                                                 // if the key wasn't found, no nodes have been deleted
+
+    erase( position );
+    return 1;                                                                         // otherwise, one node (remember, no duplicates) has been removed
+  }
+
+
+
+
+  // erase( iterator )
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  typename BinarySearchTree<Key, Value, Compare, Augment>::iterator   BinarySearchTree<Key, Value, Compare, Augment>::erase( const_iterator position )
+  {
+    if( position == cend() ) return end();                                            // empty tree, do nothing
+
+    Node * to_be_erased = position._nodePtr;                                          // convert the iterator to a pointer-to-Node for convenience
+
+    if( to_be_erased->_left != nullptr  &&  to_be_erased->_right != nullptr )         // two children (programming note: a non-null pointer is "true")
+    {
+      Node * succ_ptr = successor( to_be_erased );
+      // Move (don't copy) {key, value} pair from succ_ptr to to_be_erased
+      //
+      // Programming note:  The {key, value} pair's Key is constant to protect from (unintentionally ?) altering it and thus
+      //   breaking the tree's key ordering invariant.  But in this specific case, we really do need to overwrite the key's content.
+      //   So let's temporarily cast away its const-ness and assign the new content
+      const_cast<Key &>( to_be_erased->key  () ) =  const_cast<Key &&>( succ_ptr->key  () );  // Programming note:  casting to a non-constant R-Value reference causes the move assignment operator to be called
+                         to_be_erased->value()   =  std::move         ( succ_ptr->value() );
+      erase( succ_ptr );
+      return to_be_erased;                                                            // return the same node, but with updated content
+    }
+
+    else                                                                              // zero or one child
+    {
+      Node ** parent = to_be_erased->_parent        == nullptr      ? & _root         // "parent" is a pointer-to-pointer-to-Node; tells us what pointer to update
+                   :   to_be_erased->_parent->_left == to_be_erased ? & to_be_erased->_parent->_left
+                   :                                                  & to_be_erased->_parent->_right;
+
+      Node * child = to_be_erased->_left != nullptr  ?  to_be_erased->_left  :  to_be_erased->_right;
+
+      *parent = child;                                                                // remove me from the tree by making my parent point to my child
+      if( child != nullptr )  child->_parent = to_be_erased->_parent;                 // and my child point to my parent
+
+
+      /************** AVL Tree Unique **********************************************************************************************
+      ** Self balancing BSTs, like this AVL tree, balances the left and right subtrees as part of erase.  Work your way from the
+      ** node just erased (which is at the bottom of the tree) all the way up to the tree's root updating height and looking for
+      ** unbalanced subtrees
+      **
+      ** Balance Factor at this node calculated as Height(Left) - Height(Right)
+      ** Note:  WikiBooks defines the balance factor to be Height(Right) - Height(Left)   https://en.wikipedia.org/wiki/AVL_tree
+      **        VisuAlgo  defines the balance factor to be Height(Left)  - Height(Right)  https://visualgo.net/en/bst
+      **        I tend to use Height(Left) - Height(Right) in classroom lectures, but it really doesn't matter. If abs( Height(Left) -
+      **        Height(Right) ) >= 2, then it needs to be rebalanced
+      *****************************************************************************************************************************/
+      Node * current = to_be_erased->_parent;
+      for( ;  current != nullptr;  current = current->_parent )
+      {
+        auto previousHeight = current->_height;
+        updateHeight( current );
+
+        if( !isBalanced( current ) )   current = reBalance( current );                // if offending node found, let's fix it
+
+        if( previousHeight == current->_height ) break;                               // height has not changed, node removal has been absorbed, and we can stop back tracing
+      }
+      /************** End AVL Tree Unique ******************************************************************************************/
+
+      if( current != nullptr )   updateSummaries( current->_parent );                 // every ancestor's subtree lost a pair
+
+      iterator temp = std::next( position )._nodePtr;                                 // converts const_iterator to iterator
+      destroyNode( to_be_erased );
+      --_size;
+      return temp;                                                                    // return the node after the one removed
+    }
+  }
+
+
+
+
+  // clear() - public
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr void BinarySearchTree<Key, Value, Compare, Augment>::clear()
+  {
+    // Returning the nodes to the pool one at a time only to then release the whole pool is wasted effort.  Visit each node only if
+    // it has a destructor that must run, and then hand back all the blocks together.
+    if consteval { clear( _root ); }
+    else
+    {
+      if constexpr( !std::is_trivially_destructible_v<Node> )   clear( _root );
+      _pool.reset();
+    }
+
+    _root = nullptr;
+    _size = 0;
+  }
+
+
+
+
+  // compact()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  void BinarySearchTree<Key, Value, Compare, Augment>::compact( TreeLayout layout )
+  {
+    if( _root == nullptr ) return;
+
+    // List the nodes in the order they are to be placed in memory
+    std::vector<Node *> order;
+    order.reserve( _size );
+    if( layout == TreeLayout::IN_ORDER )   flatten          ( _root,                  order );
+    else                                   layoutVanEmdeBoas( _root, _root->_height + 1u, order );
+
+    // Copy (or move, if that can't fail) each pair into a new node from a new pool.  The pool hands out slots in address order, so
+    // the new nodes land in memory in the listed order.  Until every new node exists, the tree's links are untouched.  Should a
+    // copy or the pool's allocation fail part way through, the pairs moved so far are moved back (which can't fail either) before
+    // the new nodes are let go.
+    auto                pool = std::make_unique<Pool>();
+    std::vector<Node *> moved;
+    moved.reserve( _size );
+    try
+    {
+      for( auto node : order )   moved.push_back( pool->template make<Node>( std::move_if_noexcept( node->_pair ) ) );
+    }
+    catch( ... )
+    {
+      for( std::size_t i = 0;  i < moved.size();  ++i )
+      {
+        if constexpr( std::is_nothrow_move_constructible_v<KeyValue_Pair> )
+        {
+          std::destroy_at  ( &order[i]->_pair );
+          std::construct_at( &order[i]->_pair, std::move( moved[i]->_pair ) );
+        }
+        pool->destroy( moved[i] );
+      }
+      throw;
+    }
+
+    // Relink.  Each new node first takes its old node's links (which still point to old nodes) and the old node's parent pointer
+    // is then reused to point forward to its replacement.  A second pass follows those forwarding pointers to the new nodes.
+    for( std::size_t i = 0;  i < order.size();  ++i )
+    {
+      moved[i]->_left    = order[i]->_left;
+      moved[i]->_right   = order[i]->_right;
+      moved[i]->_parent  = order[i]->_parent;
+      moved[i]->_height  = order[i]->_height;
+      moved[i]->_summary = order[i]->_summary;
+      order[i]->_parent  = moved[i];                                                  // forwarding address
+    }
+
+    for( auto node : moved )
+    {
+      if( node->_left   != nullptr )   node->_left   = node->_left  ->_parent;
+      if( node->_right  != nullptr )   node->_right  = node->_right ->_parent;
+      if( node->_parent != nullptr )   node->_parent = node->_parent->_parent;
+    }
+    _root = _root->_parent;
+
+    // Finally, let the old nodes go along with their pool
+    for( auto node : order )   _pool->destroy( node );
+    _pool = std::move( pool );
+  }
+
+
+
+
+  // shrink_to_fit()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  void BinarySearchTree<Key, Value, Compare, Augment>::shrink_to_fit()
+  { if( _pool != nullptr )   _pool->shrink(); }
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Relational Operators
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // operator<=>
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr std::weak_ordering BinarySearchTree<Key, Value, Compare, Augment>::operator<=>( BinarySearchTree const & rhs ) const
+  {
+    std::size_t i      = 0;
+    std::size_t extent = size() < rhs.size()  ?  size()  :  rhs.size();               // min(size, rhs.size)
+
+    for (auto p = begin(), q = rhs.begin();   i < extent;   ++i, ++p, ++q)
+    {
+      auto result = std::compare_weak_order_fallback( *p, *q );                       // uses operator== and operator< if operator<=> is unavailable
+      if( result != 0 )   return result;                                              // compares both key and value
+    }
+    return size() <=> rhs.size();
   }
 
 
 
 
   // operator==
-  template<typename Key, typename Value>
-  bool BinarySearchTree<Key, Value>::operator==( BinarySearchTree const & rhs ) const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr bool BinarySearchTree<Key, Value, Compare, Augment>::operator==( BinarySearchTree const & rhs ) const
   {
     if( size() != rhs.size() ) return false;
 
@@ -775,8 +1576,8 @@ namespace CSUF::CPSC131
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
   // isBalanced()
-  template<typename Key, typename Value>
-  bool BinarySearchTree<Key, Value>::isBalanced( Node * p ) const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr bool BinarySearchTree<Key, Value, Compare, Augment>::isBalanced( Node * p ) const
   {
     // Returns "true" if the tree rooted at "p" is balanced.  Calculate the balance factor of a node as
     //    balance factor = abs(height_left - height_right)
@@ -810,8 +1611,8 @@ namespace CSUF::CPSC131
 
 
   // predecessor()
-  template<typename Key, typename Value>
-  typename BinarySearchTree<Key, Value>::Node * BinarySearchTree<Key, Value>::predecessor( Node * current ) const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Node * BinarySearchTree<Key, Value, Compare, Augment>::predecessor( Node * current ) const
   {
     if( current == nullptr ) return nullptr;
 
@@ -825,8 +1626,8 @@ namespace CSUF::CPSC131
 
 
   // successor()
-  template<typename Key, typename Value>
-  typename BinarySearchTree<Key, Value>::Node * BinarySearchTree<Key, Value>::successor( Node * current ) const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Node * BinarySearchTree<Key, Value, Compare, Augment>::successor( Node * current ) const
   {
     if( current == nullptr ) return nullptr;
 
@@ -840,8 +1641,8 @@ namespace CSUF::CPSC131
 
 
   // reBalance()
-  template<typename Key, typename Value>
-  typename BinarySearchTree<Key, Value>::Node * BinarySearchTree<Key, Value>::reBalance( Node * offendingNode )
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Node * BinarySearchTree<Key, Value, Compare, Augment>::reBalance( Node * offendingNode )
   {
     /***********************************************************************************************************************************
     **  Trinode Restructuring Each of the four patterns of out-of-balance nodes can be restructured to form the balanced pattern in the
@@ -899,10 +1700,12 @@ namespace CSUF::CPSC131
     else if ( z->_right == nullptr )   y = z->_left;
     else                               y = (z->_left->_height < z->_right->_height)  ?  z->_right  :  z->_left;     // select the tallest
 
-    // Identify the grandchild with the tallest subtree
-    if      ( y->_left  == nullptr )   x = y->_right;
-    else if ( y->_right == nullptr )   x = y->_left;
-    else                               x = (y->_left->_height < y->_right->_height)  ?  y->_right  :  y->_left;     // select the tallest
+    // Identify the grandchild with the tallest subtree.  After an erase both grandchildren may be equally tall, and then the one on
+    // the same side as y must be chosen:  a single rotation (right-right or left-left) rebalances that shape, a double rotation does not
+    if      ( y->_left  == nullptr                      )   x = y->_right;
+    else if ( y->_right == nullptr                      )   x = y->_left;
+    else if ( y->_left->_height == y->_right->_height   )   x = (z->_right == y)  ?  y->_right  :  y->_left;              // a tie, stay on y's side
+    else                                                    x = (y->_left->_height < y->_right->_height)  ?  y->_right  :  y->_left;     // select the tallest
 
 
 
@@ -971,7 +1774,7 @@ namespace CSUF::CPSC131
     b->_right  = c;
     b->_parent = offendingNode->_parent;
 
-    if     ( b->_parent        == nullptr       )   _root              = b;           // the offending node won't have a parent if it's the tree's root
+    if     ( b->_parent        == nullptr       ) { if( _root == offendingNode )   _root = b; }   // the offending node won't have a parent if it's the tree's root (or a subtree being joined)
     else if( b->_parent->_left == offendingNode )   b->_parent->_left  = b;
     else                                            b->_parent->_right = b;
 
@@ -1002,14 +1805,41 @@ namespace CSUF::CPSC131
 
 
 
+  // makeNode()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename... Args>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Node * BinarySearchTree<Key, Value, Compare, Augment>::makeNode( Args &&... args )
+  {
+    if consteval { return new Node( std::forward<Args>( args )... ); }               // The pool is for run time only, constant evaluation has no raw memory to carve up
+    else
+    {
+      if( _pool == nullptr )   _pool = std::make_unique<Pool>();
+      return _pool->template make<Node>( std::forward<Args>( args )... );
+    }
+  }
+
+
+
+
+  // destroyNode()
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr void BinarySearchTree<Key, Value, Compare, Augment>::destroyNode( Node * node ) noexcept
+  {
+    if consteval { delete node; }
+    else         { if( node != nullptr )   _pool->destroy( node ); }
+  }
+
+
+
+
   // makeCopy() - private recursive helper
-  template<typename Key, typename Value>
-  typename BinarySearchTree<Key, Value>::Node * BinarySearchTree<Key, Value>::makeCopy( Node * current )
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Node * BinarySearchTree<Key, Value, Compare, Augment>::makeCopy( Node * current )
   {
     if( current == nullptr ) return nullptr;                                          // base case
 
-    auto node     = new Node{ current->_pair };                                       // visit
-    node->_height = current->_height;                                                 // topology is maintained, so copy vice recalculate height
+    auto node     = makeNode( current->_pair );                                       // visit
+    node->_height  = current->_height;                                                // topology is maintained, so copy vice recalculate height
+    node->_summary = current->_summary;                                               // and summary
 
     node->_left  = makeCopy( current->_left );                                        // recurse left
     node->_right = makeCopy( current->_right );                                       // recurse right
@@ -1024,8 +1854,8 @@ namespace CSUF::CPSC131
 
 
   // updateHeight()
-  template<typename Key, typename Value>
-  void BinarySearchTree<Key, Value>::updateHeight( Node * p )
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr void BinarySearchTree<Key, Value, Compare, Augment>::updateHeight( Node * p )
   {
     // Assumptions:
     //   1) The left and right subtrees already have an accurate height
@@ -1035,26 +1865,493 @@ namespace CSUF::CPSC131
     // Set this node's height to one more than its tallest subtree
     if( p->_left != nullptr )
     {
-      if( p->_right != nullptr )      p->_height = 1 + std::max( p->_left->_height, p->_right->_height );   // has two children
-      else                            p->_height = 1 + p->_left->_height;                                   // has only left child
+      if( p->_right != nullptr )      p->_height = static_cast<Height>( 1 + std::max( p->_left->_height, p->_right->_height ) );   // has two children
+      else                            p->_height = static_cast<Height>( 1 + p->_left->_height );                                   // has only left child
+    }
+    else if( p->_right != nullptr )   p->_height = static_cast<Height>( 1 + p->_right->_height );                                  // has only right child
+    else                              p->_height = 0;                                                                              // no children
+
+    // Anything that changes a node's height (a new or removed descendant, or a rotation) may also change its summary, and both are
+    // calculated from the node's children the same way
+    if constexpr( AUGMENTED )   p->_summary = Augmentation::combine( Augmentation::combine( summaryOf( p->_left ), Augmentation::of( p->_pair ) ), summaryOf( p->_right ) );
+  }
+
+
+
+
+  // updateSummaries() - the retrace after an insert or erase stops once heights stop changing, but every ancestor's summary changes
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr void BinarySearchTree<Key, Value, Compare, Augment>::updateSummaries( Node * current )
+  {
+    if constexpr( AUGMENTED )
+    {
+      for( ;  current != nullptr;  current = current->_parent )   updateHeight( current );   // heights above the retrace are already accurate and don't change
+    }
+  }
+
+
+
+
+  // summaryOf() - an empty subtree's summary is a default constructed Summary
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Summary BinarySearchTree<Key, Value, Compare, Augment>::summaryOf( Node * current )
+  { return current == nullptr  ?  Summary{}  :  current->_summary; }
+
+
+
+
+  // attach() - links a new leaf into the tree below parent, on the side given by the comparison that led there, then rebalances
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Node * BinarySearchTree<Key, Value, Compare, Augment>::attach( Node * newNode, Node * parent, std::weak_ordering comp )
+  {
+    // Insert the new node in place (i.e., as the root node, or the left or right child node)
+    newNode->_parent = parent;                                                        // let the child know who's its daddy
+    updateHeight( newNode );                                                          // a leaf, so height 0 and a summary of just its own pair
+
+    if     ( parent == nullptr ) _root          = newNode;                            // let daddy (the parent) adopt the child
+    else if( comp   <  0       ) parent->_left  = newNode;
+    else                         parent->_right = newNode;
+
+    ++_size;                                                                          // and of course increment the tree's size
+
+    /************** AVL Tree Unique ************************************************************************************************
+    ** Self balancing BSTs, like this AVL tree, balances the left and right subtrees as part of insertion.  Work your way from the
+    ** node just inserted (which is at the bottom of the tree) all the way up to the tree's root updating height and looking for
+    ** unbalanced subtrees
+    **
+    ** Balance Factor at this node calculated as Height(Left) - Height(Right)
+    ** Note:  WikiBooks defines the balance factor to be Height(Right) - Height(Left)   https://en.wikipedia.org/wiki/AVL_tree
+    **        VisuAlgo  defines the balance factor to be Height(Left)  - Height(Right)  https://visualgo.net/en/bst
+    **        I tend to use Height(Left) - Height(Right) in classroom lectures, but it really doesn't matter. If abs( Height(Left) -
+    **        Height(Right) ) >= 2, then it needs to be rebalanced
+    *******************************************************************************************************************************/
+    Node * current = parent;
+    for( ;  current != nullptr;  current = current->_parent)                          // we know the node just inserted has no children, has height of 0, and is
+    {                                                                                 // balanced, so we can start with it's parent and save looking at one node
+      auto previousHeight = current->_height;
+      updateHeight( current );
+
+      if( !isBalanced( current ) )   current = reBalance( current );                  // if offending node found, let's fix it
+
+      if( previousHeight == current->_height ) break;                                 // height has not changed, node insertion has been absorbed, and we can stop back tracing
+    }
+    /************** End AVL Tree Unique *******************************************************************************************/
+
+    if( current != nullptr )   updateSummaries( current->_parent );                   // every ancestor's subtree gained a pair
+
+    return newNode;
+  }
+
+
+
+
+  // compare() - orders two keys with the tree's comparison function object
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename L, typename R>
+  constexpr std::weak_ordering BinarySearchTree<Key, Value, Compare, Augment>::compare( L const & lhs, R const & rhs ) const
+  {
+    if constexpr( std::is_convertible_v<std::invoke_result_t<Compare const &, L const &, R const &>, std::weak_ordering> )
+    {
+      return _compare( lhs, rhs );                                                    // a three-way comparison, like ThreeWayCompare or std::compare_three_way
+    }
+    else
+    {
+      if( _compare( lhs, rhs ) )   return std::weak_ordering::less;                   // a "less than" predicate, like std::less or std::greater
+      if( _compare( rhs, lhs ) )   return std::weak_ordering::greater;
+      return std::weak_ordering::equivalent;
+    }
+  }
+
+
+
+
+  // findNode() - the node with a key equivalent to key, nullptr if there is no such node
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename K>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Node * BinarySearchTree<Key, Value, Compare, Augment>::findNode( K const & key ) const
+  {
+    auto current = _root;
+
+    while( current != nullptr )
+    {
+      auto comp = compare( key, current->key() );
+      if     ( comp == 0 )  return current;
+      else if( comp  < 0 )  current = current->_left;
+      else                  current = current->_right;
+    }
+
+    return nullptr;
+  }
+
+
+
+
+  // lowerBound() - the first node whose key is not less than key, nullptr if there is no such node
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename K>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Node * BinarySearchTree<Key, Value, Compare, Augment>::lowerBound( K const & key ) const
+  {
+    Node * bound = nullptr;
+
+    for( auto current = _root;  current != nullptr;  )
+    {
+      if( compare( key, current->key() ) <= 0 )  { bound = current;  current = current->_left; }  // current is a candidate, but there may be a smaller one to the left
+      else                                                            current = current->_right;
+    }
+
+    return bound;
+  }
+
+
+
+
+  // upperBound() - the first node whose key is greater than key, nullptr if there is no such node
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename K>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Node * BinarySearchTree<Key, Value, Compare, Augment>::upperBound( K const & key ) const
+  {
+    Node * bound = nullptr;
+
+    for( auto current = _root;  current != nullptr;  )
+    {
+      if( compare( key, current->key() ) < 0 )   { bound = current;  current = current->_left; }  // current is a candidate, but there may be a smaller one to the left
+      else                                                            current = current->_right;
+    }
+
+    return bound;
+  }
+
+
+
+
+  // makeNodes() - a node for each pair in [first, last), sorted by key without duplicates
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename InputIt, typename Sentinel>
+  constexpr std::vector<typename BinarySearchTree<Key, Value, Compare, Augment>::Node *> BinarySearchTree<Key, Value, Compare, Augment>::makeNodes( InputIt first, Sentinel last )
+  {
+    std::vector<Node *> nodes;
+
+    try
+    {
+      if constexpr( std::sized_sentinel_for<Sentinel, InputIt> )   nodes.reserve( static_cast<std::size_t>( last - first ) );
+
+      for( ; first != last; ++first )
+      {
+        nodes.push_back( nullptr );                                                   // make room first so the new node can't be lost if push_back throws
+        nodes.back() = makeNode( *first );
+      }
+
+      sortUnique( nodes );
+    }
+    catch( ... )
+    {
+      for( auto node : nodes ) destroyNode( node );                                   // destroying a null pointer is harmless
+      throw;
+    }
+
+    return nodes;
+  }
+
+
+
+
+  // sortUnique() - puts the nodes in key order and deletes all but the first of nodes with equivalent keys
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr void BinarySearchTree<Key, Value, Compare, Augment>::sortUnique( std::vector<Node *> & nodes )
+  {
+    auto inOrder = [this]( Node * lhs, Node * rhs ) { return compare( lhs->key(), rhs->key() ) < 0; };
+
+    if( std::ranges::adjacent_find( nodes, std::not_fn( inOrder ) ) == nodes.end() )   return;   // already strictly increasing, an O(n) check
+
+    // std::ranges::sort is not stable, and the first of several equivalent keys must win, so sort the nodes' positions breaking ties
+    // by position
+    std::vector<std::size_t> order( nodes.size() );
+    std::iota( order.begin(), order.end(), std::size_t{ 0 } );
+    std::ranges::sort( order, [&]( std::size_t i, std::size_t j )
+                              {
+                                auto comp = compare( nodes[i]->key(), nodes[j]->key() );
+                                return comp < 0  ||  ( comp == 0  &&  i < j );
+                              } );
+
+    std::vector<Node *> sorted;
+    std::vector<Node *> duplicates;
+    sorted.reserve( nodes.size() );
+    for( auto i : order )
+    {
+      if( !sorted.empty()  &&  compare( sorted.back()->key(), nodes[i]->key() ) == 0 )   duplicates.push_back( nodes[i] );
+      else                                                                             sorted    .push_back( nodes[i] );
+    }
+
+    for( auto node : duplicates ) destroyNode( node );                                // nothing is deleted until nothing else can throw
+    nodes = std::move( sorted );
+  }
+
+
+
+
+  // flatten() - appends the subtree's nodes to nodes, in order
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr void BinarySearchTree<Key, Value, Compare, Augment>::flatten( Node * current, std::vector<Node *> & nodes ) const
+  {
+    if( current == nullptr ) return;                                                  // base case
+
+    flatten( current->_left, nodes );                                                 // recurse left
+    nodes.push_back( current );                                                       // visit
+    flatten( current->_right, nodes );                                                // recurse right
+  }
+
+
+
+
+  // buildBalanced() - links nodes, already in key order, into a perfectly balanced subtree and returns its root
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Node * BinarySearchTree<Key, Value, Compare, Augment>::buildBalanced( std::span<Node * const> nodes, Node * parent )
+  {
+    // The middle node becomes the root with the nodes before it in the left subtree and those after it in the right.  The two halves
+    // differ in size by at most one, so their heights differ by at most one and no node ever needs rebalancing.
+    if( nodes.empty() ) return nullptr;                                               // base case
+
+    auto   middle = nodes.size() / 2;
+    Node * root   = nodes[middle];
+
+    root->_parent = parent;
+    root->_left   = buildBalanced( nodes.first( middle ),      root );                // recurse left
+    root->_right  = buildBalanced( nodes.subspan( middle + 1 ), root );                // recurse right
+    updateHeight( root );                                                             // both subtrees' heights are already accurate
+
+    return root;
+  }
+
+
+
+
+  // layoutVanEmdeBoas() - appends the top "levels" levels of the subtree rooted at current to nodes, in van Emde Boas order
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr void BinarySearchTree<Key, Value, Compare, Augment>::layoutVanEmdeBoas( Node * current, std::size_t levels, std::vector<Node *> & nodes ) const
+  {
+    // Cut the levels in half.  The top half is a small tree laid out first (recursively, the same way), followed by each of the
+    // small trees hanging below it, left to right.  However big a cache line or page is, at some depth of the recursion the small
+    // trees fit in one, so a root to leaf search crosses only O(log n / log B) of them for blocks of B nodes.
+    if( current == nullptr  ||  levels == 0 ) return;                                 // base case
+    if( levels == 1 ) { nodes.push_back( current );  return; }                        // base case
+
+    auto top = levels / 2;
+    layoutVanEmdeBoas( current, top,          nodes );                                // the top half
+    layoutBottoms    ( current, top, levels - top, nodes );                           // then the bottom halves
+  }
+
+
+
+
+  // layoutBottoms() - lays out, in van Emde Boas order, "levels" levels of each subtree rooted "depth" levels below current
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr void BinarySearchTree<Key, Value, Compare, Augment>::layoutBottoms( Node * current, std::size_t depth, std::size_t levels, std::vector<Node *> & nodes ) const
+  {
+    if( current == nullptr ) return;                                                  // base case
+    if( depth   == 0       ) { layoutVanEmdeBoas( current, levels, nodes );  return; }
+
+    layoutBottoms( current->_left,  depth - 1, levels, nodes );                       // recurse left
+    layoutBottoms( current->_right, depth - 1, levels, nodes );                       // recurse right
+  }
+
+
+
+
+  // heightOf() - a subtree's height, where an empty subtree is one level shorter than a leaf
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr int BinarySearchTree<Key, Value, Compare, Augment>::heightOf( Node * current )
+  { return current == nullptr  ?  -1  :  current->_height; }
+
+
+
+
+  // join() - links left, middle, and right, every key in left less than middle's and every key in right greater, into one balanced
+  // subtree and returns its root.  O(1 + the difference in left's and right's heights)
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Node * BinarySearchTree<Key, Value, Compare, Augment>::join( Node * left, Node * middle, Node * right )
+  {
+    if( left  != nullptr )   left ->_parent = nullptr;                                // both are roots now, whatever they were before
+    if( right != nullptr )   right->_parent = nullptr;
+
+    /***********************************************************************************************************************************
+    **  If neither side is more than one level taller than the other, middle simply becomes their parent.  Otherwise walk down the
+    **  taller side's inner edge (left's right edge, or right's left edge) to the first subtree no more than one level taller than the
+    **  shorter side and put middle there, with that subtree on one side and the shorter side on the other.  Middle's new subtree is
+    **  one level taller than the subtree it replaced, just as if a node had been inserted there, so retrace the same way insert does.
+    **
+    **               left                                                     left
+    **              /    \                                                   /    \
+    **            ..      p                                                ..      p
+    **                   / \         middle      right                            / \
+    **                 ..   c                    /   \        =====>>           ..   middle
+    **                     / \                  /_____\                              /    \
+    **                    /___\                                                     c      right
+    ***********************************************************************************************************************************/
+    Node * root   = middle;
+    Node * parent = nullptr;                                                          // where middle goes, null if middle is the new root
+
+    if( heightOf( left ) > heightOf( right ) + 1 )
+    {
+      for( parent = left;  heightOf( parent->_right ) > heightOf( right ) + 1;  parent = parent->_right ) {}
+      root           = left;
+      left           = parent->_right;
+      parent->_right = middle;
+    }
+    else if( heightOf( right ) > heightOf( left ) + 1 )
+    {
+      for( parent = right;  heightOf( parent->_left ) > heightOf( left ) + 1;  parent = parent->_left ) {}
+      root           = right;
+      right          = parent->_left;
+      parent->_left  = middle;
+    }
+
+    middle->_parent = parent;
+    middle->_left   = left;
+    middle->_right  = right;
+    if( left  != nullptr )   left ->_parent = middle;
+    if( right != nullptr )   right->_parent = middle;
+    updateHeight( middle );
+
+    for( Node * current = parent;  current != nullptr;  current = current->_parent )  // every height (and summary) on the way up changes, so don't stop early
+    {
+      updateHeight( current );
+      if( !isBalanced( current ) )   current = reBalance( current );
+      if( current->_parent == nullptr )   root = current;
+    }
+
+    return root;
+  }
+
+
+
+
+  // join() - links left and right, every key in left less than every key in right, into one balanced subtree and returns its root
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Node * BinarySearchTree<Key, Value, Compare, Augment>::join( Node * left, Node * right )
+  {
+    if( left == nullptr ) return right;
+
+    auto [rest, last] = splitLast( left );                                            // left's greatest becomes the middle
+    return join( rest, last, right );
+  }
+
+
+
+
+  // split() - divides the subtree at key.  O(log n), each join along the way costs the difference in heights, and they telescope
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr std::tuple<typename BinarySearchTree<Key, Value, Compare, Augment>::Node *, typename BinarySearchTree<Key, Value, Compare, Augment>::Node *, typename BinarySearchTree<Key, Value, Compare, Augment>::Node *> BinarySearchTree<Key, Value, Compare, Augment>::split( Node * current, Key const & key )
+  {
+    if( current == nullptr ) return { nullptr, nullptr, nullptr };                    // base case
+
+    auto comp = compare( key, current->key() );
+    if( comp < 0 )                                                                    // key is to the left, so current and its right subtree are greater
+    {
+      auto [less, equivalent, greater] = split( current->_left, key );
+      return { less, equivalent, join( greater, current, current->_right ) };
+    }
+    if( comp > 0 )                                                                    // key is to the right, so current and its left subtree are less
+    {
+      auto [less, equivalent, greater] = split( current->_right, key );
+      return { join( current->_left, current, less ), equivalent, greater };
+    }
+    return { current->_left, current, current->_right };
+  }
+
+
+
+
+  // splitLast() - removes the subtree's greatest key
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr std::pair<typename BinarySearchTree<Key, Value, Compare, Augment>::Node *, typename BinarySearchTree<Key, Value, Compare, Augment>::Node *> BinarySearchTree<Key, Value, Compare, Augment>::splitLast( Node * current )
+  {
+    if( current->_right == nullptr ) return { current->_left, current };             // base case
+
+    auto [rest, last] = splitLast( current->_right );
+    return { join( current->_left, current, rest ), last };
+  }
+
+
+
+
+  // unite() - private recursive helper.  Split rhs at lhs's root, unite the lesser and greater halves, and join them back together
+  // with lhs's root in the middle.  When both have a key, lhs's node is kept and rhs's destroyed
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Node * BinarySearchTree<Key, Value, Compare, Augment>::unite( Node * lhs, Node * rhs )
+  {
+    if( lhs == nullptr ) return rhs;                                                  // base cases
+    if( rhs == nullptr ) return lhs;
+
+    auto [less, duplicate, greater] = split( rhs, lhs->key() );
+    if( duplicate != nullptr )  { destroyNode( duplicate );  --_size; }
+
+    Node * left  = unite( lhs->_left,  less    );                                     // recurse left
+    Node * right = unite( lhs->_right, greater );                                     // recurse right
+    return join( left, lhs, right );
+  }
+
+
+
+
+  // intersect() - private recursive helper.  As unite(), but lhs's root is kept only if rhs has its key, and rhs's nodes never are
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Node * BinarySearchTree<Key, Value, Compare, Augment>::intersect( Node * lhs, Node * rhs )
+  {
+    if( lhs == nullptr ) { clear( rhs );  return nullptr; }                           // base cases
+    if( rhs == nullptr ) { clear( lhs );  return nullptr; }
+
+    auto [less, match, greater] = split( rhs, lhs->key() );
+    Node * left  = intersect( lhs->_left,  less    );                                 // recurse left
+    Node * right = intersect( lhs->_right, greater );                                 // recurse right
+
+    if( match != nullptr ) { destroyNode( match );  --_size;  return join( left, lhs, right ); }
+    destroyNode( lhs );  --_size;
+    return join( left, right );
+  }
+
+
+
+
+  // subtract() - private recursive helper.  As unite(), but lhs's root is kept only if rhs doesn't have its key, and rhs's nodes never are
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::Node * BinarySearchTree<Key, Value, Compare, Augment>::subtract( Node * lhs, Node * rhs )
+  {
+    if( lhs == nullptr ) { clear( rhs );  return nullptr; }                           // base cases
+    if( rhs == nullptr ) return lhs;
+
+    auto [less, match, greater] = split( rhs, lhs->key() );
+    Node * left  = subtract( lhs->_left,  less    );                                  // recurse left
+    Node * right = subtract( lhs->_right, greater );                                  // recurse right
+
+    if( match == nullptr ) return join( left, lhs, right );
+    destroyNode( match );  --_size;
+    destroyNode( lhs   );  --_size;
+    return join( left, right );
+  }
+
+
+
+
+  // adopt() - other's nodes can be relinked into this tree only if this tree's pool will be the one to destroy them
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr void BinarySearchTree<Key, Value, Compare, Augment>::adopt( BinarySearchTree & other )
+  {
+    if !consteval                                                                     // during constant evaluation nodes are individually allocated, there are no pools
+    {
+      if     ( other._pool == nullptr )   return;                                     // other has never had a node
+      else if( _pool       == nullptr )   _pool = std::move( other._pool );
+      else                              { _pool->merge( *other._pool );  other._pool.reset(); }
     }
-    else if( p->_right != nullptr )   p->_height = 1 + p->_right->_height;                                  // has only right child
-    else                              p->_height = 0;                                                       // no children
   }
 
 
 
 
   // clear() - private recursive helper
-  template<typename Key, typename Value>
-  void BinarySearchTree<Key, Value>::clear( Node * current )
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr void BinarySearchTree<Key, Value, Compare, Augment>::clear( Node * current )
   {
     if( current == nullptr ) return;                                                  // base case
 
     clear( current->_left );                                                          // recurse left
     clear( current->_right );                                                         // recurse right
 
-    delete current;                                                                   // visit
+    destroyNode( current );                                                           // visit
     --_size;
   }
 
@@ -1067,12 +2364,14 @@ namespace CSUF::CPSC131
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
   // swap()
-  template<typename Key, typename Value>
-  void swap( BinarySearchTree<Key, Value> & lhs, BinarySearchTree<Key, Value> & rhs )
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  constexpr void swap( BinarySearchTree<Key, Value, Compare, Augment> & lhs, BinarySearchTree<Key, Value, Compare, Augment> & rhs )
   {
     using std::swap;
+    swap( lhs._pool, rhs._pool );
     swap( lhs._root, rhs._root );
     swap( lhs._size, rhs._size );
+    swap( lhs._compare, rhs._compare );
   }
 
 
@@ -1107,8 +2406,8 @@ namespace CSUF::CPSC131
 
   // Copy constructor when U is non-const iterator, Conversion constructor from non-const to const iterator when U is a const
   // iterator Type of parameter is intentionally a non-constant iterator
-  template<typename Key, typename Value>  template<typename U>
-  BinarySearchTree<Key, Value>::Iterator_type<U>::Iterator_type( iterator const & other ) noexcept    // Notice the parameter type is "iterator", not "Iterator_type"
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename U>
+  constexpr BinarySearchTree<Key, Value, Compare, Augment>::Iterator_type<U>::Iterator_type( iterator const & other ) noexcept    // Notice the parameter type is "iterator", not "Iterator_type"
     : _nodePtr{ other._nodePtr }
   {}
 
@@ -1116,8 +2415,8 @@ namespace CSUF::CPSC131
 
 
   // Conversion constructor
-  template<typename Key, typename Value>  template<typename U>
-  BinarySearchTree<Key, Value>::Iterator_type<U>::Iterator_type( Node * p ) noexcept
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename U>
+  constexpr BinarySearchTree<Key, Value, Compare, Augment>::Iterator_type<U>::Iterator_type( Node * p ) noexcept
     : _nodePtr( p )
   {}
 
@@ -1125,8 +2424,8 @@ namespace CSUF::CPSC131
 
 
   // operator++ (pre-increment)
-  template<typename Key, typename Value>  template<typename U>
-  typename BinarySearchTree<Key, Value>::template Iterator_type<U> & BinarySearchTree<Key, Value>::Iterator_type<U>::operator++()    // pre-increment
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename U>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::template Iterator_type<U> & BinarySearchTree<Key, Value, Compare, Augment>::Iterator_type<U>::operator++()    // pre-increment
   {
     if( _nodePtr == nullptr ) return *this;                                             // cannot increment past end(), should this be an error?
 
@@ -1152,8 +2451,8 @@ namespace CSUF::CPSC131
 
 
   // operator++   (post-increment)
-  template<typename Key, typename Value>  template<typename U>
-  typename BinarySearchTree<Key, Value>::template Iterator_type<U> BinarySearchTree<Key, Value>::Iterator_type<U>::operator++( int )    // post-increment
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename U>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::template Iterator_type<U> BinarySearchTree<Key, Value, Compare, Augment>::Iterator_type<U>::operator++( int )    // post-increment
   {
     auto temp{ *this };                                                               // make a copy of the original iterator
     operator++();                                                                     // Delegate to pre-increment leveraging error checking
@@ -1164,8 +2463,8 @@ namespace CSUF::CPSC131
 
 
   // operator--  (pre-decrement)
-  template<typename Key, typename Value>  template<typename U>
-  typename BinarySearchTree<Key, Value>::template Iterator_type<U> & BinarySearchTree<Key, Value>::Iterator_type<U>::operator--()    // pre-decrement
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename U>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::template Iterator_type<U> & BinarySearchTree<Key, Value, Compare, Augment>::Iterator_type<U>::operator--()    // pre-decrement
   {
     if( _nodePtr == nullptr ) return *this;                                             // decrement from end():  could return the right-most node, but the iterator, nor
                                                                                         // the underlying node, knows nothing about the tree or what the root of the tree is
@@ -1190,8 +2489,8 @@ namespace CSUF::CPSC131
 
 
   // operator--  (post-decrement)
-  template<typename Key, typename Value>  template<typename U>
-  typename BinarySearchTree<Key, Value>::template Iterator_type<U> BinarySearchTree<Key, Value>::Iterator_type<U>::operator--( int )    // post-decrement
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename U>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::template Iterator_type<U> BinarySearchTree<Key, Value, Compare, Augment>::Iterator_type<U>::operator--( int )    // post-decrement
   {
     auto temp{ *this };                                                               // make a copy of the original iterator
     operator--();                                                                     // Delegate to pre-decrement leveraging error checking
@@ -1202,24 +2501,24 @@ namespace CSUF::CPSC131
 
 
   // operator*
-  template<typename Key, typename Value>  template<typename U>
-  typename BinarySearchTree<Key, Value>::template Iterator_type<U>::reference  BinarySearchTree<Key, Value>::Iterator_type<U>::operator*() const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename U>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::template Iterator_type<U>::reference  BinarySearchTree<Key, Value, Compare, Augment>::Iterator_type<U>::operator*() const
   { return _nodePtr->_pair; }
 
 
 
 
   // operator->
-  template<typename Key, typename Value>  template<typename U>
-  typename BinarySearchTree<Key, Value>::template Iterator_type<U>::pointer  BinarySearchTree<Key, Value>::Iterator_type<U>::operator->() const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename U>
+  constexpr typename BinarySearchTree<Key, Value, Compare, Augment>::template Iterator_type<U>::pointer  BinarySearchTree<Key, Value, Compare, Augment>::Iterator_type<U>::operator->() const
   { return &( _nodePtr->_pair ); }
 
 
 
 
   // operator==
-  template<typename Key, typename Value>  template<typename U>
-  bool BinarySearchTree<Key, Value>::Iterator_type<U>::operator==( const Iterator_type & rhs ) const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>  template<typename U>
+  constexpr bool BinarySearchTree<Key, Value, Compare, Augment>::Iterator_type<U>::operator==( const Iterator_type & rhs ) const
   { return _nodePtr == rhs._nodePtr; }
 
 
@@ -1239,16 +2538,16 @@ namespace CSUF::CPSC131
 
   ///////////////////  Get Height  ///////////////////////
   // Client facing public function
-  template<typename Key, typename Value>
-  long long int BinarySearchTree<Key, Value>::getHeight() const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  long long int BinarySearchTree<Key, Value, Compare, Augment>::getHeight() const
   { return getHeight( _root ); }
 
 
 
 
   // The private helper function
-  template<typename Key, typename Value>
-  long long int BinarySearchTree<Key, Value>::getHeight( Node * current ) const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  long long int BinarySearchTree<Key, Value, Compare, Augment>::getHeight( Node * current ) const
   {
     if( current == nullptr ) return -1;                                               // Base case
 
@@ -1267,16 +2566,16 @@ namespace CSUF::CPSC131
 
   ///////////////////  Print Inorder  ///////////////////////
   // Client facing public function
-  template<typename Key, typename Value>
-  void BinarySearchTree<Key, Value>::printInorder( std::ostream & ostm ) const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  void BinarySearchTree<Key, Value, Compare, Augment>::printInorder( std::ostream & ostm ) const
   { printInorder( _root, ostm ); }
 
 
 
 
   // The private helper function
-  template<typename Key, typename Value>
-  void BinarySearchTree<Key, Value>::printInorder( Node * current, std::ostream & ostm ) const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  void BinarySearchTree<Key, Value, Compare, Augment>::printInorder( Node * current, std::ostream & ostm ) const
   {
     if( current == nullptr ) return;                                                             // Base case
 
@@ -1299,8 +2598,8 @@ namespace CSUF::CPSC131
   // cannot consider this as a potential max value.  The solution is to identify the base case as a null left or null right subtree,
   // instead of a null tree as above. If the tree is empty, we must not return a value (whatever is returned may be interpreted by
   // the caller as "the" max value).
-  template<typename Key, typename Value>
-  Value BinarySearchTree<Key, Value>::getMaxValue() const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  Value BinarySearchTree<Key, Value, Compare, Augment>::getMaxValue() const
   {
     if( _root == nullptr ) throw std::length_error( exceptionString( "Oops!  Can't determine the maximum value of an empty tree" ) );
     return getMaxValue( _root );
@@ -1310,8 +2609,8 @@ namespace CSUF::CPSC131
 
 
   // The private helper function
-  template<typename Key, typename Value>
-  Value BinarySearchTree<Key, Value>::getMaxValue( Node * current ) const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  Value BinarySearchTree<Key, Value, Compare, Augment>::getMaxValue( Node * current ) const
   {
     // can assume current is not null - it's already been checked
     auto currentMaximum = current->value();
@@ -1365,14 +2664,14 @@ namespace CSUF::CPSC131
 
   ///////////////////  Get Sum  ///////////////////////
   // Client facing public function
-  template<typename Key, typename Value>
-  Value BinarySearchTree<Key, Value>::getSum() const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  Value BinarySearchTree<Key, Value, Compare, Augment>::getSum() const
   { return getSum( _root ); }
 
 
   // The private helper function
-  template<typename Key, typename Value>
-  Value BinarySearchTree<Key, Value>::getSum( Node * current ) const
+  template<typename Key, typename Value, typename Compare, template <typename> typename Augment>
+  Value BinarySearchTree<Key, Value, Compare, Augment>::getSum( Node * current ) const
   {
     if( current == nullptr ) return Value();                                          // Base case
     return getSum( current->_left )                                                   // recurse left
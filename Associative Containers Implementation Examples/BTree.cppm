@@ -0,0 +1,1657 @@
+/***********************************************************************************************************************************
+** Class BTree - an example implementation of an ordered map as a cache friendly B-Tree (specifically, a B+ Tree)
+**
+**  The public interface is the same as class BinarySearchTree's (see BST-AVL.cppm):  insert, find, at, operator[], erase,
+**  lower_bound, upper_bound, equal_range, bi-directional iterators, three-way comparison, and formatting as a range.  A program
+**  using a BinarySearchTree<Key, Value> can use a BTree<Key, Value> instead by changing nothing but the type.
+**
+**  A binary search tree node holds one key, so a search visits about log2(n) nodes scattered about memory, and nearly every one of
+**  them is a cache miss.  A B-Tree node holds many keys, up to FANOUT - 1 of them, side by side in an array, so a search visits
+**  only about log(n) / log(FANOUT) nodes.  Once a node's first cache line has arrived, the rest of the node is read sequentially
+**  and the hardware prefetcher sees it coming.  FANOUT is a compile time constant defaulting to a node of keys spanning about four
+**  64-byte cache lines (64 children for 4-byte keys, 32 for 8-byte keys), but never fewer than 8 children.
+**
+**  Within a node, integral keys are not binary searched.  The SIMD kernels (see SimdKernels.cppm) count how many of the node's keys
+**  are less than the one sought, comparing 4 to 32 keys per instruction without a single unpredictable branch, and that count is
+**  the key's position.  Other keys, including floating point keys, are binary searched.  (Keys are ordered the same way
+**  BinarySearchTree orders them, and its total ordering of NaNs is something the vector less-than comparison doesn't do.)
+**
+**  In a B+ Tree, the key-value pairs live only in the leaves, and the inner nodes hold nothing but copies of keys (separators) that
+**  guide the search.  The leaves are linked together in key order, so iterating is a walk along an array and a hop to the next
+**  leaf, never a climb back up the tree:
+**
+**                                                  +----+----+
+**                                                  | 30 | 60 |
+**                                                  +----+----+
+**                                                 /     |     \
+**                                                v      v      v
+**    _first -> +----+----+----+  <->  +----+----+----+  <->  +----+----+----+ <- _last
+**              | 10 | 20 |    |       | 30 | 40 | 50 |       | 60 | 70 |    |
+**              +----+----+----+       +----+----+----+       +----+----+----+
+**
+**  Every leaf is at the same depth, and every node other than the root is at least half full.  A full node is split in two and a
+**  separator is pushed up into its parent.  A node that falls below half full borrows from a sibling or is merged with it, pulling
+**  a separator down.  The tree grows and shrinks in height only at the root.
+**
+**  Major differences between this example and class BinarySearchTree:
+**  1)  Pairs move between and within nodes as others are inserted and erased, so insert and erase invalidate all iterators, and
+**      references to the tree's pairs.  Iterators remain valid as long as the tree is not modified.
+**  2)  end() can be decremented (but not for an empty tree)
+**  3)  Keys are always ordered by std::compare_weak_order_fallback, the ordering of BinarySearchTree's default comparator.  There is
+**      no Compare parameter, heterogeneous lookup, or extended interface.
+**  4)  Keys and values must be default constructible, as they are for BinarySearchTree
+**  5)  Nothing is constexpr.  A leaf's pairs are constructed one at a time in raw storage, which constant evaluation doesn't allow.
+***********************************************************************************************************************************/
+module;                                                                               // Global fragment (not part of the module)
+  // Empty
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+**  Module CSUF.CPSC131.BTree Interface
+**
+***********************************************************************************************************************************/
+export module CSUF.CPSC131.BTree;                                                     // Primary Module Interface Definition
+import std;
+import CSUF.CPSC131.exceptionString;
+import CSUF.CPSC131.SimdKernels;
+
+
+
+/*******************************************************************************
+**  Module CSUF.CPSC131.BTree Interface (Duplicate keys not allowed)
+**
+*******************************************************************************/
+export namespace CSUF::CPSC131
+{
+  // Template Class Definition
+  template <typename Key, typename Value, std::size_t FANOUT = std::max<std::size_t>( 8, 256 / sizeof( Key ) )>   // FANOUT is the most children a node may have
+  class BTree
+  {
+    static_assert( FANOUT >= 4, "A B-Tree node must be allowed at least 4 children, otherwise it can't be split into two half full nodes" );
+
+    template <typename T, typename U, std::size_t N>
+    friend void swap( BTree<T, U, N> & lhs, BTree<T, U, N> & rhs );                   // The expected way to make a program-defined type swappable is to provide a
+                                                                                      // non-member function swap in the same namespace as the type.
+                                                                                      // (https://en.cppreference.com/w/cpp/algorithm/swap)
+
+    private:
+      // Types
+      template <typename U> class  Iterator_type;                                     // Template class for iterator and const_iterator classes
+
+
+
+    public:
+      // Types
+      using KeyValue_Pair  = std::pair     <Key const, Value   >;                     // An alias to the type of data held in the tree
+      using iterator       = Iterator_type <KeyValue_Pair      >;                     // A bi-directional iterator to a read-write value in the tree
+      using const_iterator = Iterator_type <KeyValue_Pair const>;                     // A bi-directional iterator to a read-only value in the tree
+
+
+
+      // Constructors, destructor, and assignments
+      BTree(                                                   );                     // Default constructor, creates an empty tree
+      BTree( BTree const                          & original   );                     // Copy constructor, performs a deep copy
+      BTree( BTree                               && original   ) noexcept;            // Move constructor, takes ownership of the other tree
+      BTree( std::initializer_list<KeyValue_Pair>    init_list );                     // initialization list constructor
+     ~BTree(                                                   ) noexcept;            // Destructor, performs a deep Key-Value pair destruction
+
+      BTree & operator=( BTree const  & rhs );                                        // Copy assignment, performs a deep copy
+      BTree & operator=( BTree       && rhs ) noexcept;                               // Move assignment, takes ownership of the other tree
+
+
+
+      // Queries
+      std::size_t size    (                 ) const noexcept;                         // Returns the number of elements in the tree
+      bool        empty   (                 ) const noexcept;                         // Returns true if the tree contains no elements, false otherwise
+      bool        contains( Key const & key ) const;                                  // Returns true if there is such an element, false otherwise
+
+
+
+      // Iterators
+      iterator       begin          ()       noexcept;                                // Returns a read-write iterator to the tree's first (least) element, end() if tree is empty
+      iterator       end            ()       noexcept;                                // Returns a read-write iterator beyond the tree's last (greatest) element.  Do not dereference this Iterator
+
+      const_iterator begin          () const noexcept;                                // Returns a read-only iterator to the tree's first (least) element, end() if tree is empty
+      const_iterator end            () const noexcept;                                // Returns a read-only iterator beyond the tree's last (greatest) element.  Do not dereference this Iterator
+
+      const_iterator cbegin         () const noexcept;                                // Returns a read-only iterator to the tree's first (least) element, end() if tree is empty
+      const_iterator cend           () const noexcept;                                // Returns a read-only iterator beyond the tree's last (greatest) element.  Do not dereference this Iterator
+
+
+
+      // Accessors
+      Value const    & at        ( Key const & key ) const;                           // Returns the value associated with given key.  Throws std::out_of_range if key not found
+      Value          & at        ( Key const & key );                                 // Returns the value associated with given key.  Throws std::out_of_range if key not found
+      Value          & operator[]( Key const & key );                                 // Returns the value associated with given key, performing an insertion if such key does not already exist.
+      const_iterator   find      ( Key const & key ) const;                           // Returns a read-only iterator to the key/value pair associated with the key, end() if key not found
+      iterator         find      ( Key const & key );                                 // Returns a read-write iterator to the key/value pair associated with the key, end() if key not found
+
+
+
+      // Range Queries - O(log n) to locate the bound, then walk the range with the iterators
+      const_iterator                                lower_bound( Key const & key ) const;   // Returns an iterator to the first element whose key is not less than key, end() if none
+      iterator                                      lower_bound( Key const & key );
+      const_iterator                                upper_bound( Key const & key ) const;   // Returns an iterator to the first element whose key is greater than key, end() if none
+      iterator                                      upper_bound( Key const & key );
+      std::pair<const_iterator, const_iterator>     equal_range( Key const & key ) const;   // Returns [lower_bound, upper_bound), which holds at most one element
+      std::pair<iterator,       iterator      >     equal_range( Key const & key );
+
+
+
+      // Modifiers - all invalidate every iterator
+      std::pair<iterator, bool> insert( KeyValue_Pair const & pair     );             // Inserts a key-value pair into the container, if the container doesn't already contain an element with an equivalent key.
+      std::size_t               erase ( Key           const & key      );             // Removes the matching pair and returns the number of elements removed (0 or 1)
+      iterator                  erase ( const_iterator        position );             // Removes the pointed-to pair and returns the iterator following the removed element
+      void                      clear (                                );             // Returns the tree to an empty state releasing all nodes
+
+
+
+      // Relational Operators
+      std::weak_ordering operator<=>( BTree const & rhs ) const;
+      bool               operator== ( BTree const & rhs ) const;
+
+
+
+    private:
+      // Private Types
+      struct Node;                                                                    // What leaves and inner nodes have in common
+      struct Leaf;                                                                    // Holds the key-value pairs
+      struct Inner;                                                                   // Holds separator keys and children
+      struct NoKeys {};                                                               // Stands in for a leaf's copy of its keys when there's no need for one
+      using  Path = std::array<std::pair<Inner *, std::size_t>, 64>;                  // The inner nodes, and which child of each, passed on the way down to a leaf.
+                                                                                      // Every inner node has at least 2 children, so 64 levels is more than a 64-bit address space can fill
+
+      static constexpr std::size_t MAX_KEYS  = FANOUT - 1;                            // A node holds at most MAX_KEYS keys ...
+      static constexpr std::size_t MIN_KEYS  = MAX_KEYS / 2;                          // ... and, unless it's the root, at least MIN_KEYS
+      static constexpr bool        VECTORIZE = simd::Vectorizable<Key>  &&  !std::floating_point<Key>;   // Nodes are searched with the SIMD kernels
+
+
+
+      // Member instance attributes
+      Node *      _root   = nullptr;
+      Leaf *      _first  = nullptr;                                                  // The leaves are linked in key order, from the one holding the least key ...
+      Leaf *      _last   = nullptr;                                                  // ... to the one holding the greatest
+      std::size_t _size   = 0;
+      std::size_t _height = 0;                                                        // Levels of inner nodes above the leaves, 0 when the root is a leaf
+
+
+
+      // Helper functions
+      static std::weak_ordering compare( Key const & lhs, Key const & rhs );
+
+      template <bool UPPER>  static std::size_t rank( Key  const * keys, std::size_t count, Key const & key );   // Number of keys less than key, or less than or equal to key if UPPER
+      template <bool UPPER>  static std::size_t rank( Leaf const * leaf,                    Key const & key );
+
+      Leaf *   descend      ( Key const & key, Path * path = nullptr ) const;         // Returns the leaf whose range of keys includes key
+      iterator position     ( Leaf * leaf, std::size_t index ) const;                 // Returns an iterator to a leaf's index'th pair, or to the next leaf's first if there's no such pair
+      Inner *  split        ( Inner * node, std::size_t slot, Key & separator, Node * child, Inner * right );
+      Node * & leafLink     ( Path & path );                                          // The pointer to the leaf path leads to:  the last inner node's child, or the root
+      template <typename... Args>
+      Leaf *   insertPair   ( Node * & link, std::size_t i, Args &&... args );        // Inserts a pair at i into the leaf link points to, returns the leaf now holding it
+      Leaf *   erasePair    ( Node * & link, std::size_t i );                         // Removes the pair at i from the leaf link points to, returns the leaf now holding the rest
+      void     replace      ( Node * & link, Leaf * replacement ) noexcept;           // Puts replacement in the place of the leaf link points to, and deletes that leaf
+      bool     rebalanceLeaf ( Inner * parent, std::size_t slot, std::size_t index ); // Erases the leaf's pair at index and rebalances.  Returns true if the parent lost a separator
+      bool     rebalanceInner( Inner * parent, std::size_t slot );                    // Returns true if the parent lost a separator
+      void     unlink       ( Leaf * leaf );
+      Node *   makeCopy     ( Node const * current, std::size_t levels, Leaf * & previous );
+      void     clear        ( Node * current, std::size_t levels );
+  };  // class BTree
+
+
+
+
+
+
+  /*******************************************************************************
+  ** Class BTree<Key, Value, FANOUT>::Iterator - A bi-directional iterator
+  **
+   *******************************************************************************/
+  template<typename Key, typename Value, std::size_t FANOUT>  template<typename U>
+  class BTree<Key, Value, FANOUT>::Iterator_type
+  {
+    friend class BTree<Key, Value, FANOUT>;
+    friend class Iterator_type<KeyValue_Pair const>;
+
+    public:
+      // Iterator Type Traits - Boilerplate stuff so the iterator can be used with the rest of the standard library
+      using iterator_category = std::bidirectional_iterator_tag;
+      using value_type        = U;
+      using difference_type   = std::ptrdiff_t;
+      using pointer           = value_type *;
+      using reference         = value_type &;
+
+
+
+      // Compiler synthesized constructors and destructor are fine, just what we want (shallow copies, no ownership) but needed to
+      // explicitly say that because there is also a user defined constructor
+      Iterator_type(                        ) = default;                              // Default constructed Iterator_type refers to no tree at all
+      Iterator_type( iterator const & other ) noexcept;                               // Copy constructor when U is non-const, Conversion constructor from non-const to const iterator when U is const
+                                                                                      // Note parameter type is intentionally "iterator", not "Iterator_type"
+
+
+      // Pre and post Increment operators move the position to the next pair, hopping to the next leaf after a leaf's last pair
+      Iterator_type & operator++();                                                   // advance the iterator one pair in-order (pre -increment)
+      Iterator_type   operator++( int );                                              // advance the iterator one pair in-order (post-increment)
+
+
+
+      // Pre and post Decrement operators move the position to the previous pair, hopping to the previous leaf before a leaf's first
+      Iterator_type & operator--();                                                   // retreat the iterator one pair in-order (pre -decrement)
+      Iterator_type   operator--( int );                                              // retreat the iterator one pair in-order (post-decrement)
+
+
+
+      // Dereferencing and member access operators provide access to data. The iterator itself can be constant or non-constant, but,
+      // by definition, points to a non-constant tree.
+      reference operator* () const;
+      pointer   operator->() const;
+
+
+
+      // Equality operators
+      bool operator==( Iterator_type const & rhs ) const;                             // Symmetrically compares all const & non-const iterator combinations, with the help of the Conversion constructor above
+
+
+
+    private:
+      // Member attributes
+      Leaf *      _leaf  = nullptr;
+      std::size_t _index = 0;                                                         // end() is one past the last leaf's last pair
+
+
+
+      // Helper functions
+      Iterator_type( Leaf * leaf, std::size_t index ) noexcept;
+  };  // BTree<U>::Iterator_type
+
+}    // export namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// Not exported but reachable
+/***********************************************************************************************************************************
+************************************************************************************************************************************
+** Template Implementation
+*
+** Separating Interface from Implementation is an extremely important concept I hope students will come to appreciate.
+************************************************************************************************************************************
+***********************************************************************************************************************************/
+
+/***********************************************************************************************************************************
+** Class BTree - an example implementation of an ordered map as a B+ Tree
+**
+**  Empty (size = 0):
+**
+**                   nullptr    nullptr     nullptr     nullptr
+**                      ^          ^           ^           ^
+**                      |          |           |           |
+**                    root      _first       _last    begin(), end()
+**
+**  . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . . .
+**
+**  Height 1, FANOUT = 4 (at most 3 keys per node, at least 1 unless it's the root):
+**
+**                                          root -> +----+----+----+
+**                                                  | 30 | 60 |    |   <- separators
+**                                                  +----+----+----+
+**                                                  |    |    |    |   <- children (one more than the separators)
+**                                                  +----+----+----+
+**                                                  /     |     \
+**                                                 v      v      v
+**                      +----+----+----+    +----+----+----+    +----+----+----+
+**           _first ->  | 10 | 20 |    |<-->| 30 | 40 | 50 |<-->| 60 | 70 |    |  <- _last
+**                      +----+----+----+    +----+----+----+    +----+----+----+
+**                        ^                                                   ^
+**                        |                                                   |
+**                     begin()                                 end() (_last, index 2)
+**
+**  Each separator is no greater than every key to its right, and greater than every key to its left.  A separator is a copy of a
+**  key that was the least key of its right hand subtree when it was created, but it need not still be one of the tree's keys.
+***********************************************************************************************************************************/
+
+namespace CSUF::CPSC131
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // B-Tree nodes
+  //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  template<typename Key, typename Value, std::size_t FANOUT>
+  struct BTree<Key, Value, FANOUT>::Node
+  {
+    std::size_t _count = 0;                                                           // Number of keys in the node
+  };
+
+
+
+
+  // A leaf holds the key-value pairs in key order.  The pairs are constructed in place, one at a time, as they're added, so a leaf
+  // doesn't default construct FANOUT - 1 pairs it's not yet using.  When the keys can be searched by the SIMD kernels, the leaf also
+  // keeps a copy of its keys packed together, since the pairs' keys are strided by the size of the values.
+  template<typename Key, typename Value, std::size_t FANOUT>
+  struct BTree<Key, Value, FANOUT>::Leaf : Node
+  {
+    // Constructors and destructor
+    Leaf() {}
+    Leaf( Leaf const & ) = delete;
+   ~Leaf() { std::destroy_n( _pairs, this->_count ); }
+
+    // Convenience function used mainly as a tool to help create more readable code
+    Key const & key( std::size_t i ) const { return _pairs[i].first; }
+
+    // Shifting pairs over to open or close a gap moves them one at a time.  A move that throws part way through would leave a
+    // hole among the pairs, so pairs are only shifted in place if they can be moved without throwing.  (A pair's key is const, so
+    // moving a pair copies its key.  Pairs with std::string keys, for example, can throw.)  Other leaves are changed by building a
+    // new leaf alongside instead, see BTree::insertPair() and BTree::erasePair().
+    static constexpr bool NOTHROW_SHIFT = std::is_nothrow_move_constructible_v<KeyValue_Pair>;
+
+    // Constructs a pair after the last.  Nothing shifts, so if constructing the pair throws the leaf is as it was
+    template <typename... Args>
+    void push_back( Args &&... args )
+    {
+      std::construct_at( &_pairs[this->_count], std::forward<Args>( args )... );
+      if constexpr( VECTORIZE )   _keys[this->_count] = _pairs[this->_count].first;
+      ++this->_count;
+    }
+
+    // Appends the source leaf's pairs [first, last), moved if that can't throw and copied otherwise.  Should a copy throw, the pairs
+    // appended so far are destroyed again, and both leaves are as they were
+    void append( Leaf & source, std::size_t first, std::size_t last )
+    {
+      auto const count = this->_count;
+      try
+      {
+        for( auto i = first;  i < last;  ++i )   push_back( std::move_if_noexcept( source._pairs[i] ) );
+      }
+      catch( ... )
+      {
+        truncate( count );
+        throw;
+      }
+    }
+
+    // Destroys the pairs from i to the end
+    void truncate( std::size_t i ) noexcept
+    {
+      std::destroy( _pairs + i, _pairs + this->_count );
+      this->_count = i;
+    }
+
+    // Moves the pairs from i to the end of this leaf onto the end of the destination leaf, in one pass
+    void moveTail( std::size_t i, Leaf & destination )
+    {
+      destination.append( *this, i, this->_count );
+      truncate( i );
+    }
+
+    // Moves pair into place at i, shifting the pairs at and after i one place to the right
+    void insert( std::size_t i, KeyValue_Pair && pair ) noexcept requires NOTHROW_SHIFT
+    {
+      for( auto j = this->_count;  j > i;  --j )
+      {
+        std::construct_at( &_pairs[j], std::move( _pairs[j - 1] ) );
+        std::destroy_at  ( &_pairs[j - 1] );
+      }
+      std::construct_at( &_pairs[i], std::move( pair ) );
+
+      if constexpr( VECTORIZE )
+      {
+        std::copy_backward( _keys.data() + i, _keys.data() + this->_count, _keys.data() + this->_count + 1 );
+        _keys[i] = _pairs[i].first;
+      }
+      ++this->_count;
+    }
+
+    // Destroys the pair at i, shifting the pairs after i one place to the left
+    void erase( std::size_t i ) noexcept requires NOTHROW_SHIFT
+    {
+      std::destroy_at( &_pairs[i] );
+      for( auto j = i + 1;  j < this->_count;  ++j )
+      {
+        std::construct_at( &_pairs[j - 1], std::move( _pairs[j] ) );
+        std::destroy_at  ( &_pairs[j] );
+      }
+
+      if constexpr( VECTORIZE )   std::copy( _keys.data() + i + 1, _keys.data() + this->_count, _keys.data() + i );
+      --this->_count;
+    }
+
+    union { KeyValue_Pair _pairs[MAX_KEYS]; };                                        // Only the first _count of these have been constructed
+    [[no_unique_address]] std::conditional_t<VECTORIZE, std::array<Key, MAX_KEYS>, NoKeys> _keys;   // A packed copy of the pairs' keys, only when vectorizing
+
+    Leaf * _prev = nullptr;                                                           // The leaf holding the next lesser keys
+    Leaf * _next = nullptr;                                                           // The leaf holding the next greater keys
+  };
+
+
+
+
+  // An inner node holds _count separators and _count + 1 children.  Every key in _children[i] is less than _keys[i], and every key
+  // in _children[i + 1] is greater than or equal to _keys[i].
+  template<typename Key, typename Value, std::size_t FANOUT>
+  struct BTree<Key, Value, FANOUT>::Inner : Node
+  {
+    // Inserts a separator at i, and the child to its right at i + 1
+    void insert( std::size_t i, Key && separator, Node * child )
+    {
+      std::move_backward( _keys.begin()     + i,     _keys.begin()     + this->_count,     _keys.begin()     + this->_count + 1 );
+      std::copy_backward( _children.begin() + i + 1, _children.begin() + this->_count + 1, _children.begin() + this->_count + 2 );
+      _keys    [i]     = std::move( separator );
+      _children[i + 1] = child;
+      ++this->_count;
+    }
+
+    // Removes the separator at i and the child to its right at i + 1
+    void erase( std::size_t i )
+    {
+      std::move( _keys.begin()     + i + 1, _keys.begin()     + this->_count,     _keys.begin()     + i     );
+      std::copy( _children.begin() + i + 2, _children.begin() + this->_count + 1, _children.begin() + i + 1 );
+      --this->_count;
+    }
+
+    std::array<Key,    MAX_KEYS> _keys     = {};
+    std::array<Node *, FANOUT  > _children = {};
+  };
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Constructors, destructor, and assignments
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // Default constructor
+  template<typename Key, typename Value, std::size_t FANOUT>
+  BTree<Key, Value, FANOUT>::BTree() = default;
+
+
+
+
+  // Copy constructor
+  template<typename Key, typename Value, std::size_t FANOUT>
+  BTree<Key, Value, FANOUT>::BTree( BTree const & original )
+    : _size{ original._size }, _height{ original._height }
+  {
+    if( original._root == nullptr )   return;
+
+    Leaf * previous = nullptr;                                                        // The leaves are copied in order, each linked to the one copied before it
+    _root = makeCopy( original._root, _height, previous );                            // performs a deep copy, recursively
+    _last = previous;
+  }
+
+
+
+
+  // Move constructor
+  template<typename Key, typename Value, std::size_t FANOUT>
+  BTree<Key, Value, FANOUT>::BTree( BTree && original ) noexcept
+    : _root{ original._root }, _first{ original._first }, _last{ original._last }, _size{ original._size }, _height{ original._height }   // performs a shallow copy (takes ownership of the original tree)
+  {
+    original._root   = nullptr;                                                       // set the original to an empty tree
+    original._first  = nullptr;
+    original._last   = nullptr;
+    original._size   = 0;
+    original._height = 0;
+  }
+
+
+
+
+  // Initialization list constructor
+  template<typename Key, typename Value, std::size_t FANOUT>
+  BTree<Key, Value, FANOUT>::BTree( std::initializer_list<KeyValue_Pair> init_list )
+  { for( auto && pair : init_list )   insert( pair ); }
+
+
+
+
+  // Destructor
+  template<typename Key, typename Value, std::size_t FANOUT>
+  BTree<Key, Value, FANOUT>::~BTree() noexcept
+  { clear(); }
+
+
+
+
+  // Copy assignment
+  template<typename Key, typename Value, std::size_t FANOUT>
+  BTree<Key, Value, FANOUT> & BTree<Key, Value, FANOUT>::operator=( BTree const & rhs )
+  {
+    if( this != &rhs )    // self assignment guard
+    {
+      // to ensure consistent behavior and to implement the logic in one place, delegate to the copy constructor and then the move
+      // assignment operator
+      *this = BTree{ rhs };                                                           // Don't break this into two statements, or you may lose
+    }                                                                                 // the rvalue and get into an infinite recursive loop
+
+    return *this;
+  }
+
+
+
+
+  // Move assignment
+  template<typename Key, typename Value, std::size_t FANOUT>
+  BTree<Key, Value, FANOUT> & BTree<Key, Value, FANOUT>::operator=( BTree && rhs ) noexcept
+  {
+    if( this != &rhs )    // self assignment guard
+    {
+      clear();
+      _root   = rhs._root;    // perform a shallow copy (takes ownership of the original tree)
+      _first  = rhs._first;
+      _last   = rhs._last;
+      _size   = rhs._size;
+      _height = rhs._height;
+
+      rhs._root   = nullptr;    // set the original to an empty tree
+      rhs._first  = nullptr;
+      rhs._last   = nullptr;
+      rhs._size   = 0;
+      rhs._height = 0;
+    }
+    return *this;
+  }
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Queries
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // size()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  std::size_t BTree<Key, Value, FANOUT>::size() const noexcept
+  { return _size; }
+
+
+
+
+  // empty()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  bool BTree<Key, Value, FANOUT>::empty() const noexcept
+  { return size() == 0; }
+
+
+
+
+  // contains()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  bool BTree<Key, Value, FANOUT>::contains( Key const & key ) const
+  { return find( key ) != end(); }
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Iterators - In-order traversal along the linked leaves
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // begin()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::iterator BTree<Key, Value, FANOUT>::begin() noexcept
+  { return { _first, 0 }; }                                                           // An empty tree's _first is null, making begin() == end()
+
+
+
+
+  // end()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::iterator BTree<Key, Value, FANOUT>::end() noexcept
+  { return { _last, _last == nullptr  ?  0  :  _last->_count }; }                    // One past the last pair, so end() can be decremented
+
+
+
+
+  // begin() const
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::const_iterator BTree<Key, Value, FANOUT>::begin() const noexcept
+  { return const_cast<BTree &>( *this ).begin(); }                                    // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
+
+
+
+
+  // end() const
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::const_iterator BTree<Key, Value, FANOUT>::end() const noexcept
+  { return const_cast<BTree &>( *this ).end(); }                                      // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
+
+
+
+
+  // cbegin() const
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::const_iterator BTree<Key, Value, FANOUT>::cbegin() const noexcept
+  { return const_cast<BTree &>( *this ).begin(); }                                    // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
+
+
+
+
+  // cend() const
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::const_iterator BTree<Key, Value, FANOUT>::cend() const noexcept
+  { return const_cast<BTree &>( *this ).end(); }                                      // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Accessors
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // at() const
+  template<typename Key, typename Value, std::size_t FANOUT>
+  Value const & BTree<Key, Value, FANOUT>::at( Key const & key ) const
+  { return const_cast<BTree &>( *this ).at( key ); }                                  // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
+
+
+
+
+  // at()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  Value & BTree<Key, Value, FANOUT>::at( Key const & key )
+  {
+    auto it = find( key );
+
+    if( it == end() )   throw std::out_of_range( exceptionString( "Failure:  Attempted to access nonexistent element" ) );
+    return it->second;
+  }
+
+
+
+
+  // operator[]
+  template<typename Key, typename Value, std::size_t FANOUT>
+  Value & BTree<Key, Value, FANOUT>::operator[]( Key const & key )
+  { return insert( { key, Value{} } ).first->second; }                                // find the existing or insert a new {key, value} pair with a default constructed value
+
+
+
+
+  // find() const
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::const_iterator BTree<Key, Value, FANOUT>::find( Key const & key ) const
+  { return const_cast<BTree &>( *this ).find( key ); }                                // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
+
+
+
+
+  // find()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::iterator BTree<Key, Value, FANOUT>::find( Key const & key )
+  {
+    auto it = lower_bound( key );
+    if( it != end()  &&  compare( it->first, key ) == 0 )   return it;
+    return end();
+  }
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Range Queries
+  //
+  //  A single descent from the root to a leaf, then a search within the leaf.  If the bound is past the leaf's last pair, it's the
+  //  next leaf's first.
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // lower_bound() const
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::const_iterator BTree<Key, Value, FANOUT>::lower_bound( Key const & key ) const
+  { return const_cast<BTree &>( *this ).lower_bound( key ); }                         // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
+
+
+
+
+  // lower_bound()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::iterator BTree<Key, Value, FANOUT>::lower_bound( Key const & key )
+  {
+    if( _root == nullptr )   return end();
+
+    auto leaf = descend( key );
+    return position( leaf, rank<false>( leaf, key ) );
+  }
+
+
+
+
+  // upper_bound() const
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::const_iterator BTree<Key, Value, FANOUT>::upper_bound( Key const & key ) const
+  { return const_cast<BTree &>( *this ).upper_bound( key ); }                         // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
+
+
+
+
+  // upper_bound()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::iterator BTree<Key, Value, FANOUT>::upper_bound( Key const & key )
+  {
+    if( _root == nullptr )   return end();
+
+    auto leaf = descend( key );
+    return position( leaf, rank<true>( leaf, key ) );
+  }
+
+
+
+
+  // equal_range() const
+  template<typename Key, typename Value, std::size_t FANOUT>
+  std::pair<typename BTree<Key, Value, FANOUT>::const_iterator, typename BTree<Key, Value, FANOUT>::const_iterator>
+  BTree<Key, Value, FANOUT>::equal_range( Key const & key ) const
+  {
+    auto [first, last] = const_cast<BTree &>( *this ).equal_range( key );             // to ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
+    return { first, last };
+  }
+
+
+
+
+  // equal_range()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  std::pair<typename BTree<Key, Value, FANOUT>::iterator, typename BTree<Key, Value, FANOUT>::iterator>
+  BTree<Key, Value, FANOUT>::equal_range( Key const & key )
+  {
+    auto first = lower_bound( key );
+    auto last  = first;
+    if( last != end()  &&  compare( last->first, key ) == 0 )   ++last;               // Keys are unique, so the range holds at most one pair
+    return { first, last };
+  }
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Modifiers
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // insert()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  std::pair<typename BTree<Key, Value, FANOUT>::iterator, bool> BTree<Key, Value, FANOUT>::insert( KeyValue_Pair const & pair )
+  {
+    if( _root == nullptr )
+    {
+      auto leaf = std::make_unique<Leaf>();
+      leaf->push_back( pair );
+
+      _root = _first = _last = leaf.release();
+      _size = 1;
+      return { begin(), true };
+    }
+
+    Path   path;
+    Leaf * leaf  = descend( pair.first, &path );
+    auto   index = rank<false>( leaf, pair.first );
+
+    if( index < leaf->_count  &&  compare( leaf->key( index ), pair.first ) == 0 )   return { iterator( leaf, index ), false };
+
+    if( leaf->_count < MAX_KEYS )                                                     // Room in the leaf, nothing else changes
+    {
+      leaf = insertPair( leafLink( path ), index, pair );
+      ++_size;
+      return { iterator( leaf, index ), true };
+    }
+
+
+    // The leaf is full, so split it in two, each taking half of the pairs (counting the new one), and link the new right half
+    // into the list of leaves.  Everything that can throw is done first, while the tree is still as it was:  allocating the inner
+    // nodes the split needs on its way up, copying the new pair, building the halves, and copying the separator.
+    constexpr auto HALF  = ( MAX_KEYS + 1 ) / 2;                                      // Pairs staying in the left half
+    bool const     lower = index < HALF;                                              // Does the new pair go into the left half?
+
+    std::size_t splits = 0;                                                           // Full inner nodes, from the leaf's parent up, split too
+    while( splits < _height  &&  path[_height - 1 - splits].first->_count == MAX_KEYS )   ++splits;
+
+    std::array<std::unique_ptr<Inner>, std::tuple_size_v<Path> + 1> spares;          // The right halves of those, and a new root if every one splits
+    for( std::size_t i = 0;  i < splits + ( splits == _height  ?  1  :  0 );  ++i )   spares[i] = std::make_unique<Inner>();
+
+    KeyValue_Pair         newPair( pair );                                            // Copied before any pair moves out of the leaf
+    auto                  right = std::make_unique<Leaf>();
+    std::unique_ptr<Leaf> left;                                                       // A new left half, when the pair goes there but can't be shifted into place
+    if( lower )
+    {
+      right->append( *leaf, HALF - 1, leaf->_count );
+      if constexpr( !Leaf::NOTHROW_SHIFT )
+      {
+        left = std::make_unique<Leaf>();
+        left->append   ( *leaf, 0, index );
+        left->push_back( std::move( newPair ) );
+        left->append   ( *leaf, index, HALF - 1 );
+      }
+    }
+    else
+    {
+      right->append   ( *leaf, HALF, index );
+      right->push_back( std::move( newPair ) );
+      right->append   ( *leaf, index, leaf->_count );
+    }
+    Key separator = right->key( 0 );                                                  // The right half's least key separates the halves in their parent
+
+
+    // Nothing from here on throws
+    if( !lower )                                  leaf->truncate( HALF );
+    else if constexpr( Leaf::NOTHROW_SHIFT )    { leaf->truncate( HALF - 1 );  leaf->insert( index, std::move( newPair ) ); }
+    else                                        { replace( leafLink( path ), left.get() );  leaf = left.release(); }
+
+    iterator const result = lower  ?  iterator( leaf, index )  :  iterator( right.get(), index - HALF );
+    ++_size;
+
+    right->_prev = leaf;
+    right->_next = leaf->_next;
+    ( leaf->_next == nullptr  ?  _last  :  leaf->_next->_prev ) = right.get();
+    leaf->_next  = right.get();
+
+
+    // The separator goes into the parent.  If the parent is full too, it splits as well and pushes its middle separator up to its
+    // parent, and so on
+    Node *      child = right.release();
+    std::size_t spare = 0;
+
+    for( auto level = _height;  level-- > 0;  )
+    {
+      auto [parent, slot] = path[level];
+      if( parent->_count < MAX_KEYS )
+      {
+        parent->insert( slot, std::move( separator ), child );
+        return { result, true };
+      }
+      child = split( parent, slot, separator, child, spares[spare++].release() );
+    }
+
+
+    // The root split, so the tree grows one level taller
+    auto root = spares[spare].release();
+    root->_count        = 1;
+    root->_keys    [0]  = std::move( separator );
+    root->_children[0]  = _root;
+    root->_children[1]  = child;
+
+    _root = root;
+    ++_height;
+    return { result, true };
+  }
+
+
+
+
+  // erase( key )
+  template<typename Key, typename Value, std::size_t FANOUT>
+  std::size_t BTree<Key, Value, FANOUT>::erase( Key const & key )
+  {
+    if( _root == nullptr )   return 0;
+
+    Path   path;
+    Leaf * leaf  = descend( key, &path );
+    auto   index = rank<false>( leaf, key );
+
+    if( index == leaf->_count  ||  compare( leaf->key( index ), key ) != 0 )   return 0;   // not found
+
+    // Keep every node at least half full, from the leaf up.  A leaf that would drop below half full borrows from or merges with a
+    // sibling as the pair is removed.  Borrowing finishes the job, but merging takes a separator away from the parent, which may
+    // then be the one less than half full.  Inner nodes hold only separators and pointers, which are moved, so once the leaf is
+    // done nothing else can throw.
+    if( _height == 0  ||  leaf->_count > MIN_KEYS )   erasePair( leafLink( path ), index );
+    else if( rebalanceLeaf( path[_height - 1].first, path[_height - 1].second, index ) )
+    {
+      for( auto level = _height - 1;  level > 0;  --level )
+      {
+        auto [parent, slot] = path[level - 1];
+        if( parent->_children[slot]->_count >= MIN_KEYS )   break;
+        if( !rebalanceInner( parent, slot ) )               break;
+      }
+    }
+    --_size;
+
+
+    // The root is allowed to be less than half full, but an inner root left with a single child is replaced by that child, and the
+    // tree shrinks one level shorter
+    if( _height > 0  &&  _root->_count == 0 )
+    {
+      auto root = static_cast<Inner *>( _root );
+      _root = root->_children[0];
+      delete root;
+      --_height;
+    }
+    else if( _height == 0  &&  _root->_count == 0 )
+    {
+      delete static_cast<Leaf *>( _root );
+      _root = _first = _last = nullptr;
+    }
+
+    return 1;
+  }
+
+
+
+
+  // erase( iterator )
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::iterator BTree<Key, Value, FANOUT>::erase( const_iterator position )
+  {
+    // The nodes don't know their parents, so the way down to the pair's leaf is found again by key.  The key is copied first as the
+    // pair it belongs to is about to be destroyed
+    Key const key = position->first;
+    erase( key );
+    return upper_bound( key );
+  }
+
+
+
+
+  // clear() - public
+  template<typename Key, typename Value, std::size_t FANOUT>
+  void BTree<Key, Value, FANOUT>::clear()
+  {
+    if( _root != nullptr )   clear( _root, _height );
+
+    _root   = _first = _last = nullptr;
+    _size   = 0;
+    _height = 0;
+  }
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Relational Operators
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // operator<=>
+  template<typename Key, typename Value, std::size_t FANOUT>
+  std::weak_ordering BTree<Key, Value, FANOUT>::operator<=>( BTree const & rhs ) const
+  {
+    std::size_t i      = 0;
+    std::size_t extent = size() < rhs.size()  ?  size()  :  rhs.size();               // min(size, rhs.size)
+
+    for (auto p = begin(), q = rhs.begin();   i < extent;   ++i, ++p, ++q)
+    {
+      auto result = std::compare_weak_order_fallback( *p, *q );                       // uses operator== and operator< if operator<=> is unavailable
+      if( result != 0 )   return result;                                              // compares both key and value
+    }
+    return size() <=> rhs.size();
+  }
+
+
+
+
+  // operator==
+  template<typename Key, typename Value, std::size_t FANOUT>
+  bool BTree<Key, Value, FANOUT>::operator==( BTree const & rhs ) const
+  {
+    if( size() != rhs.size() ) return false;
+
+    for (auto p = begin(), end = this->end(), q = rhs.begin();   p != end;   ++p, ++q)
+    { if( *p != *q )   return false; }                                                // compares the pair (both key and value)
+
+    return true;
+  }
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Private member functions
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // compare()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  std::weak_ordering BTree<Key, Value, FANOUT>::compare( Key const & lhs, Key const & rhs )
+  { return std::compare_weak_order_fallback( lhs, rhs ); }                            // uses operator== and operator< if operator<=> is unavailable
+
+
+
+
+  // rank() - within an array of sorted keys
+  //
+  //  How many keys are less than (or, if UPPER, less than or equal to) key is both the position key belongs at, and the child
+  //  to descend into.  The SIMD kernels simply count them all.  With a node's keys in a few cache lines that costs less than a
+  //  binary search's mispredicted branches.
+  template<typename Key, typename Value, std::size_t FANOUT>  template<bool UPPER>
+  std::size_t BTree<Key, Value, FANOUT>::rank( Key const * keys, std::size_t count, Key const & key )
+  {
+    if constexpr( VECTORIZE )
+    {
+      if constexpr( UPPER )   return simd::count_less_equal( keys, keys + count, key );
+      else                    return simd::count_less      ( keys, keys + count, key );
+    }
+    else
+    {
+      auto const less = []( Key const & lhs, Key const & rhs ) { return compare( lhs, rhs ) < 0; };
+
+      if constexpr( UPPER )   return static_cast<std::size_t>( std::upper_bound( keys, keys + count, key, less ) - keys );
+      else                    return static_cast<std::size_t>( std::lower_bound( keys, keys + count, key, less ) - keys );
+    }
+  }
+
+
+
+
+  // rank() - within a leaf
+  template<typename Key, typename Value, std::size_t FANOUT>  template<bool UPPER>
+  std::size_t BTree<Key, Value, FANOUT>::rank( Leaf const * leaf, Key const & key )
+  {
+    if constexpr( VECTORIZE )   return rank<UPPER>( leaf->_keys.data(), leaf->_count, key );
+    else
+    {
+      auto const less  = []( Key const & lhs, Key const & rhs ) { return compare( lhs, rhs ) < 0; };
+      auto const pairs = std::span( leaf->_pairs, leaf->_count );
+
+      if constexpr( UPPER )   return static_cast<std::size_t>( std::ranges::upper_bound( pairs, key, less, &KeyValue_Pair::first ) - pairs.begin() );
+      else                    return static_cast<std::size_t>( std::ranges::lower_bound( pairs, key, less, &KeyValue_Pair::first ) - pairs.begin() );
+    }
+  }
+
+
+
+
+  // descend()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::Leaf * BTree<Key, Value, FANOUT>::descend( Key const & key, Path * path ) const
+  {
+    Node * current = _root;
+
+    for( std::size_t level = 0;  level < _height;  ++level )
+    {
+      auto inner = static_cast<Inner *>( current );
+      auto slot  = rank<true>( inner->_keys.data(), inner->_count, key );            // A key equal to a separator is found to its right
+
+      if( path != nullptr )   ( *path )[level] = { inner, slot };
+      current = inner->_children[slot];
+    }
+
+    return static_cast<Leaf *>( current );
+  }
+
+
+
+
+  // position()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::iterator BTree<Key, Value, FANOUT>::position( Leaf * leaf, std::size_t index ) const
+  {
+    if( index == leaf->_count  &&  leaf->_next != nullptr )   return { leaf->_next, 0 };
+    return { leaf, index };                                                           // One past the last leaf's last pair is end()
+  }
+
+
+
+
+  // split()
+  //
+  //  Splits a full inner node that must also take on a new separator at slot, and the child to its right.  Of the MAX_KEYS + 1
+  //  separators, the lesser half stay in node, the greater half move to the new (empty) node right, and the one between them is
+  //  returned through separator to be pushed up into the parent, with right returned as the child to its right.  right is
+  //  allocated by the caller, before the tree starts changing.
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::Inner * BTree<Key, Value, FANOUT>::split( Inner * node, std::size_t slot, Key & separator, Node * child, Inner * right )
+  {
+    std::array<Key,    MAX_KEYS + 1> keys;
+    std::array<Node *, FANOUT   + 1> children;
+
+    std::move( node->_keys.begin(),            node->_keys.begin() + slot,          keys.begin()            );
+    std::move( node->_keys.begin() + slot,     node->_keys.end(),                   keys.begin() + slot + 1 );
+    keys[slot] = std::move( separator );
+
+    std::copy( node->_children.begin(),            node->_children.begin() + slot + 1, children.begin()            );
+    std::copy( node->_children.begin() + slot + 1, node->_children.end(),              children.begin() + slot + 2 );
+    children[slot + 1] = child;
+
+
+    constexpr auto MIDDLE = ( MAX_KEYS + 1 ) / 2;                                     // The separator pushed up
+
+    std::move( keys.begin(),              keys.begin() + MIDDLE,         node->_keys.begin()      );
+    std::copy( children.begin(),          children.begin() + MIDDLE + 1, node->_children.begin()  );
+    node->_count = MIDDLE;
+
+    std::move( keys.begin() + MIDDLE + 1, keys.end(),                    right->_keys.begin()     );
+    std::copy( children.begin() + MIDDLE + 1, children.end(),            right->_children.begin() );
+    right->_count = MAX_KEYS - MIDDLE;
+
+    separator = std::move( keys[MIDDLE] );
+    return right;
+  }
+
+
+
+
+  // rebalanceLeaf()
+  //
+  //  The leaf at parent->_children[slot] is to lose its pair at index, which would leave it with one pair fewer than MIN_KEYS.  If a
+  //  neighboring sibling can spare a pair, take it and update the separator between them.  Otherwise, neither sibling has more than
+  //  MIN_KEYS pairs, so there's room to merge with one, and the separator between them is removed from the parent.
+  //
+  //  The pair is removed in the same step, so that everything that can throw, copying the new separator and copying pairs that
+  //  can't be moved without throwing into new leaves, is done before the tree changes.  Should anything throw, the tree is as it
+  //  was.
+  template<typename Key, typename Value, std::size_t FANOUT>
+  bool BTree<Key, Value, FANOUT>::rebalanceLeaf( Inner * parent, std::size_t slot, std::size_t index )
+  {
+    auto node  =                               static_cast<Leaf *>( parent->_children[slot    ] );
+    auto left  = slot > 0               ?  static_cast<Leaf *>( parent->_children[slot - 1] )  :  nullptr;
+    auto right = slot < parent->_count  ?  static_cast<Leaf *>( parent->_children[slot + 1] )  :  nullptr;
+
+    if( left != nullptr  &&  left->_count > MIN_KEYS )                                // Borrow the left sibling's greatest pair
+    {
+      Key separator = left->key( left->_count - 1 );
+
+      if constexpr( Leaf::NOTHROW_SHIFT )
+      {
+        node->erase ( index );
+        node->insert( 0, std::move( left->_pairs[left->_count - 1] ) );
+      }
+      else
+      {
+        auto copy = std::make_unique<Leaf>();
+        copy->append( *left, left->_count - 1, left->_count );
+        copy->append( *node, 0,                index        );
+        copy->append( *node, index + 1,        node->_count );
+        replace( parent->_children[slot], copy.release() );
+      }
+
+      left->truncate( left->_count - 1 );
+      parent->_keys[slot - 1] = std::move( separator );
+      return false;
+    }
+
+    if( right != nullptr  &&  right->_count > MIN_KEYS )                              // Borrow the right sibling's least pair
+    {
+      Key separator = right->key( 1 );
+
+      if constexpr( Leaf::NOTHROW_SHIFT )
+      {
+        node ->erase    ( index );
+        node ->push_back( std::move( right->_pairs[0] ) );
+        right->erase    ( 0 );
+      }
+      else
+      {
+        auto copy = std::make_unique<Leaf>();
+        copy->append( *node,  0,         index        );
+        copy->append( *node,  index + 1, node->_count );
+        copy->append( *right, 0,         1            );
+
+        auto rest = std::make_unique<Leaf>();
+        rest->append( *right, 1, right->_count );
+
+        replace( parent->_children[slot],     copy.release() );
+        replace( parent->_children[slot + 1], rest.release() );
+      }
+
+      parent->_keys[slot] = std::move( separator );
+      return false;
+    }
+
+    if( left != nullptr )                                                             // Merge into the left sibling
+    {
+      auto const count = left->_count;
+      try
+      {
+        left->append( *node, 0,         index        );
+        left->append( *node, index + 1, node->_count );
+      }
+      catch( ... )
+      {
+        left->truncate( count );
+        throw;
+      }
+      unlink( node );
+      parent->erase( slot - 1 );
+    }
+    else                                                                              // Merge the right sibling into this one
+    {
+      if constexpr( Leaf::NOTHROW_SHIFT )
+      {
+        node ->erase   ( index );
+        right->moveTail( 0, *node );
+      }
+      else
+      {
+        auto copy = std::make_unique<Leaf>();
+        copy->append( *node,  0,         index         );
+        copy->append( *node,  index + 1, node->_count  );
+        copy->append( *right, 0,         right->_count );
+        replace( parent->_children[slot], copy.release() );
+      }
+      unlink( right );
+      parent->erase( slot );
+    }
+    return true;
+  }
+
+
+
+
+  // rebalanceInner()
+  //
+  //  Just like rebalanceLeaf(), except a separator and child borrowed from a sibling rotate through the parent:  the parent's
+  //  separator comes down into the node, and the sibling's separator goes up to replace it.  Merging pulls the parent's
+  //  separator down between the two nodes' separators.
+  template<typename Key, typename Value, std::size_t FANOUT>
+  bool BTree<Key, Value, FANOUT>::rebalanceInner( Inner * parent, std::size_t slot )
+  {
+    auto node  =                               static_cast<Inner *>( parent->_children[slot    ] );
+    auto left  = slot > 0               ?  static_cast<Inner *>( parent->_children[slot - 1] )  :  nullptr;
+    auto right = slot < parent->_count  ?  static_cast<Inner *>( parent->_children[slot + 1] )  :  nullptr;
+
+    if( left != nullptr  &&  left->_count > MIN_KEYS )                                // Borrow the left sibling's greatest child
+    {
+      std::move_backward( node->_keys.begin(),     node->_keys.begin()     + node->_count,     node->_keys.begin()     + node->_count + 1 );
+      std::copy_backward( node->_children.begin(), node->_children.begin() + node->_count + 1, node->_children.begin() + node->_count + 2 );
+
+      node->_keys    [0]      = std::move( parent->_keys[slot - 1] );
+      node->_children[0]      = left->_children[left->_count];
+      parent->_keys[slot - 1] = std::move( left->_keys[left->_count - 1] );
+
+      ++node->_count;
+      --left->_count;
+      return false;
+    }
+
+    if( right != nullptr  &&  right->_count > MIN_KEYS )                              // Borrow the right sibling's least child
+    {
+      node->_keys    [node->_count]     = std::move( parent->_keys[slot] );
+      node->_children[node->_count + 1] = right->_children[0];
+      parent->_keys[slot]               = std::move( right->_keys[0] );
+
+      std::move( right->_keys.begin()     + 1, right->_keys.begin()     + right->_count,     right->_keys.begin()     );
+      std::copy( right->_children.begin() + 1, right->_children.begin() + right->_count + 1, right->_children.begin() );
+
+      ++node->_count;
+      --right->_count;
+      return false;
+    }
+
+    // Merge: into's separators, the parent's separator between them, then from's separators
+    auto merge = [parent]( Inner * into, std::size_t separator, Inner * from )
+    {
+      into->_keys[into->_count] = std::move( parent->_keys[separator] );
+      std::move( from->_keys.begin(),     from->_keys.begin()     + from->_count,     into->_keys.begin()     + into->_count + 1 );
+      std::copy( from->_children.begin(), from->_children.begin() + from->_count + 1, into->_children.begin() + into->_count + 1 );
+      into->_count += from->_count + 1;
+
+      delete from;
+      parent->erase( separator );
+    };
+
+    if( left != nullptr )   merge( left, slot - 1, node  );
+    else                    merge( node, slot,     right );
+    return true;
+  }
+
+
+
+
+  // unlink()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  void BTree<Key, Value, FANOUT>::unlink( Leaf * leaf )
+  {
+    ( leaf->_prev == nullptr  ?  _first  :  leaf->_prev->_next ) = leaf->_next;
+    ( leaf->_next == nullptr  ?  _last   :  leaf->_next->_prev ) = leaf->_prev;
+    delete leaf;
+  }
+
+
+
+
+  // leafLink()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::Node * & BTree<Key, Value, FANOUT>::leafLink( Path & path )
+  {
+    if( _height == 0 )   return _root;
+
+    auto [parent, slot] = path[_height - 1];
+    return parent->_children[slot];
+  }
+
+
+
+
+  // insertPair()
+  //
+  //  Pairs that can be moved without throwing are shifted over in place.  Otherwise the leaf is copied into a new one with the new
+  //  pair in place, and the new leaf replaces the old.  That copies every pair rather than only those after i, but a pair that
+  //  can throw when moved is copied when shifted anyway (its key is const).
+  template<typename Key, typename Value, std::size_t FANOUT>  template <typename... Args>
+  typename BTree<Key, Value, FANOUT>::Leaf * BTree<Key, Value, FANOUT>::insertPair( Node * & link, std::size_t i, Args &&... args )
+  {
+    auto leaf = static_cast<Leaf *>( link );
+
+    if( i == leaf->_count )                                                           // Nothing to shift
+    {
+      leaf->push_back( std::forward<Args>( args )... );
+      return leaf;
+    }
+
+    if constexpr( Leaf::NOTHROW_SHIFT )
+    {
+      leaf->insert( i, KeyValue_Pair( std::forward<Args>( args )... ) );              // Only constructing the pair can throw
+      return leaf;
+    }
+    else
+    {
+      auto copy = std::make_unique<Leaf>();
+      copy->append   ( *leaf, 0, i );
+      copy->push_back( std::forward<Args>( args )... );
+      copy->append   ( *leaf, i, leaf->_count );
+
+      replace( link, copy.get() );
+      return copy.release();
+    }
+  }
+
+
+
+
+  // erasePair()
+  //
+  //  As insertPair(), pairs are shifted in place only if they can be moved without throwing
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::Leaf * BTree<Key, Value, FANOUT>::erasePair( Node * & link, std::size_t i )
+  {
+    auto leaf = static_cast<Leaf *>( link );
+
+    if( i + 1 == leaf->_count )                                                       // Nothing to shift
+    {
+      leaf->truncate( i );
+      return leaf;
+    }
+
+    if constexpr( Leaf::NOTHROW_SHIFT )
+    {
+      leaf->erase( i );
+      return leaf;
+    }
+    else
+    {
+      auto copy = std::make_unique<Leaf>();
+      copy->append( *leaf, 0,     i            );
+      copy->append( *leaf, i + 1, leaf->_count );
+
+      replace( link, copy.get() );
+      return copy.release();
+    }
+  }
+
+
+
+
+  // replace()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  void BTree<Key, Value, FANOUT>::replace( Node * & link, Leaf * replacement ) noexcept
+  {
+    auto leaf = static_cast<Leaf *>( link );
+
+    replacement->_prev = leaf->_prev;
+    replacement->_next = leaf->_next;
+    ( leaf->_prev == nullptr  ?  _first  :  leaf->_prev->_next ) = replacement;
+    ( leaf->_next == nullptr  ?  _last   :  leaf->_next->_prev ) = replacement;
+
+    link = replacement;
+    delete leaf;
+  }
+
+
+
+
+  // makeCopy()
+  //
+  //  levels is the number of levels of inner nodes below and including current, so current is a leaf when it reaches zero
+  //
+  //  The copy isn't part of any tree until the whole of it is returned, so should copying a key or pair throw, nothing would ever
+  //  delete what was copied so far.  Each node is owned by a std::unique_ptr until it's complete, and an inner node that fails
+  //  releases the subtrees it has already copied.  (The leaves copied so far may be linked to each other, and _first to one of
+  //  them, but they all go together and the copy is abandoned.)
+  template<typename Key, typename Value, std::size_t FANOUT>
+  typename BTree<Key, Value, FANOUT>::Node * BTree<Key, Value, FANOUT>::makeCopy( Node const * current, std::size_t levels, Leaf * & previous )
+  {
+    if( levels == 0 )
+    {
+      auto original = static_cast<Leaf const *>( current );
+      auto leaf     = std::make_unique<Leaf>();                                       // The leaf's destructor destroys the pairs copied so far
+      for( std::size_t i = 0;  i < original->_count;  ++i )   leaf->push_back( original->_pairs[i] );
+
+      leaf->_prev = previous;
+      ( previous == nullptr  ?  _first  :  previous->_next ) = leaf.get();
+      previous = leaf.get();
+      return leaf.release();
+    }
+
+    auto original = static_cast<Inner const *>( current );
+    auto inner    = std::make_unique<Inner>();
+    inner->_keys  = original->_keys;
+
+    std::size_t copied = 0;                                                           // Children copied so far
+    try
+    {
+      for( ;  copied <= original->_count;  ++copied )   inner->_children[copied] = makeCopy( original->_children[copied], levels - 1, previous );
+    }
+    catch( ... )
+    {
+      for( std::size_t i = 0;  i < copied;  ++i )   clear( inner->_children[i], levels - 1 );
+      throw;
+    }
+
+    inner->_count = original->_count;
+    return inner.release();
+  }
+
+
+
+
+  // clear() - private
+  template<typename Key, typename Value, std::size_t FANOUT>
+  void BTree<Key, Value, FANOUT>::clear( Node * current, std::size_t levels )
+  {
+    if( levels == 0 )
+    {
+      delete static_cast<Leaf *>( current );                                          // The leaf's destructor destroys its pairs
+      return;
+    }
+
+    auto inner = static_cast<Inner *>( current );
+    for( std::size_t i = 0;  i <= inner->_count;  ++i )   clear( inner->_children[i], levels - 1 );
+    delete inner;
+  }
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Non-member functions
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // swap()
+  template<typename Key, typename Value, std::size_t FANOUT>
+  void swap( BTree<Key, Value, FANOUT> & lhs, BTree<Key, Value, FANOUT> & rhs )
+  {
+    using std::swap;
+    swap( lhs._root,   rhs._root   );
+    swap( lhs._first,  rhs._first  );
+    swap( lhs._last,   rhs._last   );
+    swap( lhs._size,   rhs._size   );
+    swap( lhs._height, rhs._height );
+  }
+
+
+
+
+
+
+
+
+
+
+
+
+  /*********************************************************************************************************************************
+  **********************************************************************************************************************************
+  ** BTree<>::iterator Member Function Definitions
+  **
+  *********************************************************************************************************************************/
+
+  // Copy constructor when U is non-const iterator, Conversion constructor from non-const to const iterator when U is a const
+  // iterator Type of parameter is intentionally a non-constant iterator
+  template<typename Key, typename Value, std::size_t FANOUT>  template<typename U>
+  BTree<Key, Value, FANOUT>::Iterator_type<U>::Iterator_type( iterator const & other ) noexcept    // Notice the parameter type is "iterator", not "Iterator_type"
+    : _leaf{ other._leaf }, _index{ other._index }
+  {}
+
+
+
+
+  // Conversion constructor
+  template<typename Key, typename Value, std::size_t FANOUT>  template<typename U>
+  BTree<Key, Value, FANOUT>::Iterator_type<U>::Iterator_type( Leaf * leaf, std::size_t index ) noexcept
+    : _leaf{ leaf }, _index{ index }
+  {}
+
+
+
+
+  // operator++ (pre-increment)
+  template<typename Key, typename Value, std::size_t FANOUT>  template<typename U>
+  typename BTree<Key, Value, FANOUT>::template Iterator_type<U> & BTree<Key, Value, FANOUT>::Iterator_type<U>::operator++()    // pre-increment
+  {
+    if( _leaf == nullptr  ||  _index == _leaf->_count )   return *this;               // cannot increment past end(), should this be an error?
+
+    if( ++_index == _leaf->_count  &&  _leaf->_next != nullptr )                      // Past this leaf's last pair, on to the next leaf's first
+    {
+      _leaf  = _leaf->_next;
+      _index = 0;
+    }
+    return *this;
+  }
+
+
+
+
+  // operator++   (post-increment)
+  template<typename Key, typename Value, std::size_t FANOUT>  template<typename U>
+  typename BTree<Key, Value, FANOUT>::template Iterator_type<U> BTree<Key, Value, FANOUT>::Iterator_type<U>::operator++( int )    // post-increment
+  {
+    auto temp{ *this };                                                               // make a copy of the original iterator
+    operator++();                                                                     // Delegate to pre-increment leveraging error checking
+    return temp;                                                                      // return the copy
+  }
+
+
+
+
+  // operator--  (pre-decrement)
+  template<typename Key, typename Value, std::size_t FANOUT>  template<typename U>
+  typename BTree<Key, Value, FANOUT>::template Iterator_type<U> & BTree<Key, Value, FANOUT>::Iterator_type<U>::operator--()    // pre-decrement
+  {
+    if( _leaf == nullptr )   return *this;                                            // an empty tree has nothing to retreat to
+
+    if( _index == 0 )                                                                 // Before this leaf's first pair, back to the previous leaf's last
+    {
+      if( _leaf->_prev == nullptr )   return *this;                                   // cannot decrement before begin()
+      _leaf  = _leaf->_prev;
+      _index = _leaf->_count;
+    }
+    --_index;
+    return *this;
+  }
+
+
+
+
+  // operator--  (post-decrement)
+  template<typename Key, typename Value, std::size_t FANOUT>  template<typename U>
+  typename BTree<Key, Value, FANOUT>::template Iterator_type<U> BTree<Key, Value, FANOUT>::Iterator_type<U>::operator--( int )    // post-decrement
+  {
+    auto temp{ *this };                                                               // make a copy of the original iterator
+    operator--();                                                                     // Delegate to pre-decrement leveraging error checking
+    return temp;                                                                      // return the copy
+  }
+
+
+
+
+  // operator*
+  template<typename Key, typename Value, std::size_t FANOUT>  template<typename U>
+  typename BTree<Key, Value, FANOUT>::template Iterator_type<U>::reference  BTree<Key, Value, FANOUT>::Iterator_type<U>::operator*() const
+  { return _leaf->_pairs[_index]; }
+
+
+
+
+  // operator->
+  template<typename Key, typename Value, std::size_t FANOUT>  template<typename U>
+  typename BTree<Key, Value, FANOUT>::template Iterator_type<U>::pointer  BTree<Key, Value, FANOUT>::Iterator_type<U>::operator->() const
+  { return &( _leaf->_pairs[_index] ); }
+
+
+
+
+  // operator==
+  template<typename Key, typename Value, std::size_t FANOUT>  template<typename U>
+  bool BTree<Key, Value, FANOUT>::Iterator_type<U>::operator==( Iterator_type const & rhs ) const
+  { return _leaf == rhs._leaf  &&  _index == rhs._index; }
+}    // namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+** (C) Copyright 2022 by Thomas Bettens. All Rights Reserved.
+**
+** DISCLAIMER: The participating authors at California State University's Computer Science Department have used their best efforts
+** in preparing this code. These efforts include the development, research, and testing of the theories and programs to determine
+** their effectiveness. The authors make no warranty of any kind, expressed or implied, with regard to these programs or to the
+** documentation contained within. The authors shall not be liable in any event for incidental or consequential damages in
+** connection with, or arising out of, the furnishing, performance, or use of these libraries and programs.  Distribution without
+** written consent from the authors is prohibited.
+***********************************************************************************************************************************/
+
+/**************************************************
+** Last modified:  27-JUL-2025 (Converted to C++ Modules)
+** Last Verified:  27-JUL-2025
+** Verified with:  MS Visual Studio 2022 Version 17.14.9,  Compiler Version 19.44.35213 (/std:c++latest)
+**                 GCC version 15.1.0 (-std=c++23 )
+**                 Clang version 21.0.0 (-std=c++23 -stdlib=libc++)
+***************************************************/
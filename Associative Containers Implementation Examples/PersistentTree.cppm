@@ -0,0 +1,1148 @@
+/***********************************************************************************************************************************
+** Class PersistentTree - an AVL tree that many threads can read without locking while one thread keeps changing it
+**
+**  Sharing a BinarySearchTree between threads takes a reader-writer lock around every use.  A writer rebalancing the tree moves
+**  nodes about, and a reader walking down the tree at the same time could follow a link into the middle of a half finished
+**  rotation.  Every reader then waits while the writer works, and under load the lock itself, a shared counter every reader has to
+**  change, becomes the bottleneck.
+**
+**  A PersistentTree never changes a node once readers may have seen it.  Inserting or erasing instead copies the nodes on the path
+**  from the root down to where the change is made, O(log n) of them, and links the copies to the untouched subtrees of the
+**  original.  Rebalancing rotates only copies.  The new root then describes a complete new version of the tree, and publishing it
+**  is a single atomic store.  Inserting 35:
+**
+**        version 1 -->  40                       40' <-- version 2          40', 20', and 30' are copies.  The rest of version
+**                     /    \                   /    \                       2, 10 and 60 here, are version 1's own nodes, shared
+**                   20      60               20'     60                     by both versions
+**                  /  \                     /   \
+**                10    30                 10     30'
+**                                                  \
+**                                                   35
+**
+**  A reader asks for a Snapshot, which holds whichever root was published last.  Nothing reachable from that root ever changes, so
+**  the reader searches and iterates with ordinary loads, never blocking on and never seeing a writer mid-update, and the more cores
+**  there are the more readers run at once.  Taking a snapshot is lock-free, searching one is wait-free.
+**
+**  Old versions' nodes can't be released the moment they're replaced, a reader may still be walking them.  Instead they're
+**  reclaimed by epoch:  each version published is numbered, and each snapshot announces the number of the version it started from
+**  in a reader record of its own.  A node replaced while building version e is put aside until every snapshot still alive has
+**  announced e or later, since none of those can reach it.  The writer then returns it to the node pool.  A snapshot held a long
+**  time holds back the reclamation of everything replaced since it was taken, but never blocks the writer.
+**
+**  Thread safety:
+**    o  snapshot(), and everything a Snapshot does, may be used by any number of threads concurrently with each other and the writer
+**    o  insert(), insert_or_assign(), erase(), clear(), reclaim(), size(), and empty() may be used by only one thread at a time, the
+**       writer.  All node allocation and release happens in that thread, so the (not thread safe) node pool needs no lock
+**    o  Construction and destruction may not be concurrent with anything, and no snapshot may outlive its tree
+**
+**  Major differences between this example and class BinarySearchTree:
+**  1)  The tree itself has no iterators, searches, or accessors.  Everything is read through a Snapshot, whose forward iterators
+**      stay valid as long as the snapshot does, however the tree changes meanwhile.
+**  2)  Keys and values must be copyable (path copying copies them).  Values are read-only, change one with insert_or_assign()
+**  3)  Keys are always ordered by std::compare_weak_order_fallback, the ordering of BinarySearchTree's default comparator.  There is
+**      no Compare parameter, heterogeneous lookup, or extended interface.
+**  4)  Nodes have no parent pointers, a node shared by many versions has a different parent in each.  Iterators instead keep the
+**      path of ancestors still to be visited.
+**  5)  Nothing is constexpr
+***********************************************************************************************************************************/
+module;                                                                               // Global fragment (not part of the module)
+  // Empty
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+**  Module CSUF.CPSC131.PersistentTree Interface
+**
+***********************************************************************************************************************************/
+export module CSUF.CPSC131.PersistentTree;                                            // Primary Module Interface Definition
+import std;
+import CSUF.CPSC131.exceptionString;
+import CSUF.CPSC131.NodePool;
+
+
+
+/*******************************************************************************
+**  Module CSUF.CPSC131.PersistentTree Interface (Duplicate keys not allowed)
+**
+*******************************************************************************/
+export namespace CSUF::CPSC131
+{
+  // Template Class Definition
+  template <typename Key, typename Value>
+  class PersistentTree
+  {
+    private:
+      // Types
+      struct Node;
+      class  Iterator;                                                                // Forward iterator over a snapshot
+
+
+
+    public:
+      // Types
+      using KeyValue_Pair = std::pair<Key const, Value>;                              // An alias to the type of data held in the tree
+      class Snapshot;                                                                 // One immutable version of the tree, the way readers see it
+
+
+
+      // Constructors, destructor, and assignments
+      PersistentTree(                                                   );            // Default constructor, creates an empty tree
+      PersistentTree( std::initializer_list<KeyValue_Pair>    init_list );            // initialization list constructor
+      PersistentTree( PersistentTree const                  & original  ) = delete;   // Snapshots hold on to their tree's reader records and nodes, so a tree
+      PersistentTree & operator=( PersistentTree const      & rhs       ) = delete;   // can be neither copied nor moved
+     ~PersistentTree(                                                   ) noexcept;   // Destructor, no snapshot may still be alive
+
+
+
+      // Readers - any thread, any time
+      Snapshot snapshot() const;                                                      // Returns the latest version, which never changes no matter what the writer does next
+
+
+
+      // Writer - one thread at a time.  Each change is published as a new version, and is all or nothing should a copy throw
+      std::size_t size            (                                ) const noexcept;  // Returns the number of elements in the latest version
+      bool        empty           (                                ) const noexcept;  // Returns true if the latest version contains no elements, false otherwise
+
+      bool        insert          ( KeyValue_Pair const & pair     );                 // Inserts a key-value pair if there's no element with an equivalent key.  Returns true if inserted
+      template <typename M>
+      bool        insert_or_assign( Key const & key, M && value    );                 // Inserts a key-value pair, or replaces the value of the existing element.  Returns true if inserted
+      std::size_t erase           ( Key const & key                );                 // Removes the matching element and returns the number of elements removed (0 or 1)
+      void        clear           (                                );                 // Publishes an empty version
+
+      std::size_t reclaim         (                                );                 // Releases the replaced nodes no snapshot can reach anymore, returns how many.
+                                                                                      // Called automatically once RECLAIM_BATCH nodes are waiting
+
+
+
+    private:
+      // Private Types
+      struct Pool;                                                                    // Where nodes come from and go back to
+      struct Reader;                                                                  // A snapshot's announcement of the version it started from
+      struct Retired                                                                  // A node replaced while building version epoch
+      {
+        std::uint64_t epoch;
+        Node *        node;
+      };
+      using  Height = std::uint8_t;
+
+      static constexpr std::uint64_t IDLE          = 0;                               // A reader record not in use by any snapshot.  Versions are numbered from 1
+      static constexpr std::size_t   RECLAIM_BATCH = 64;                              // Retired nodes to collect before looking for ones to release
+      static constexpr std::size_t   MAX_LEVELS    = 64;                              // An AVL tree 65 levels tall needs at least F(67) - 1, over 4 x 10^13, nodes
+
+
+
+      // Member instance attributes - shared with readers
+              std::atomic<Node *>        _root    = nullptr;                          // The latest published version
+              std::atomic<std::uint64_t> _epoch   = 1;                                // and its number.  The writer publishes _root first
+      mutable std::atomic<Reader *>      _readers = nullptr;                          // Every reader record ever created, each reused as snapshots come and go
+
+      // Member instance attributes - writer only
+              std::unique_ptr<Pool>      _pool;
+              std::vector<Retired>       _retired;                                    // In the order replaced, so oldest epoch first
+              std::vector<Node *>        _created;                                    // The nodes made for the version being built, released should building it fail
+
+
+
+      // Helper functions
+      static std::weak_ordering compare ( Key const & lhs, Key const & rhs );
+      static int                heightOf( Node const * current );                     // -1 for an empty subtree
+      static std::size_t        sizeOf  ( Node const * current );
+
+      template <typename Change>
+      void          commit  ( Change change );                                        // Builds a new version from the latest with change( root ), and publishes it
+      std::uint64_t building(               ) const noexcept;                         // The number the version being built will be published as
+
+      template <typename... Args>
+      Node * makeNode   ( Args &&... args );                                          // A node of the version being built
+      Node * writable   ( Node * current );                                           // current if it's part of the version being built, otherwise a copy that is
+      void   retire     ( Node * current );                                           // current is not part of the version being built
+      void   retire     ( Node * current, bool wholeSubtree );
+      void   updateHeight( Node * current );                                          // and the node's size
+      Node * reBalance  ( Node * current );                                           // Returns the subtree's new root.  current must be writable
+      Node * rotateLeft ( Node * current );
+      Node * rotateRight( Node * current );
+
+      template <typename M>
+      Node * insert     ( Node * current, Key const & key, M && value, bool assign ); // Each returns the root of the changed subtree, or current if nothing changed
+      Node * erase      ( Node * current, Key const & key );
+      std::pair<Node *, Node *> eraseFirst( Node * current );                         // the subtree without its least element, and that element's node
+
+      void   destroy    ( Node * current ) noexcept;                                  // Releases every node of the subtree immediately
+  };  // class PersistentTree
+
+
+
+
+  /*******************************************************************************
+  ** Class PersistentTree<Key, Value>::Snapshot - One version of the tree, read-only
+  **
+   *******************************************************************************/
+  template <typename Key, typename Value>
+  class PersistentTree<Key, Value>::Snapshot
+  {
+    friend class PersistentTree<Key, Value>;
+
+    public:
+      // Types
+      using const_iterator = PersistentTree<Key, Value>::Iterator;                    // A forward iterator to a read-only value in the snapshot
+      using iterator       = const_iterator;                                          // Nothing in a snapshot can be changed
+
+
+
+      // Constructors, destructor, and assignments
+      Snapshot(                          ) noexcept = default;                        // An empty snapshot of no tree at all
+      Snapshot( Snapshot const   & other ) = delete;                                  // Each snapshot has a reader record of its own, take another snapshot instead
+      Snapshot( Snapshot        && other ) noexcept;
+      Snapshot & operator=( Snapshot const  & rhs ) = delete;
+      Snapshot & operator=( Snapshot       && rhs ) noexcept;
+     ~Snapshot(                          ) noexcept;                                  // Lets the writer reclaim what only this snapshot could still reach
+
+
+
+      // Queries
+      std::size_t size    (                 ) const noexcept;                         // Returns the number of elements in the snapshot
+      bool        empty   (                 ) const noexcept;                         // Returns true if the snapshot contains no elements, false otherwise
+      bool        contains( Key const & key ) const;                                  // Returns true if there is such an element, false otherwise
+
+
+
+      // Iterators
+      const_iterator begin () const;                                                  // Returns an iterator to the snapshot's first (least) element, end() if empty
+      const_iterator end   () const noexcept;                                         // Returns an iterator beyond the snapshot's last (greatest) element.  Do not dereference this Iterator
+      const_iterator cbegin() const;
+      const_iterator cend  () const noexcept;
+
+
+
+      // Accessors
+      Value const &  at         ( Key const & key ) const;                            // Returns the value associated with given key.  Throws std::out_of_range if key not found
+      const_iterator find       ( Key const & key ) const;                            // Returns an iterator to the key/value pair associated with the key, end() if key not found
+      const_iterator lower_bound( Key const & key ) const;                            // Returns an iterator to the first element whose key is not less than key, end() if none
+      const_iterator upper_bound( Key const & key ) const;                            // Returns an iterator to the first element whose key is greater than key, end() if none
+
+
+
+    private:
+      Snapshot( Reader * reader, Node const * root ) noexcept;
+
+      template <bool UPPER>
+      const_iterator bound( Key const & key ) const;                                  // lower_bound(), or upper_bound() if UPPER
+
+      Reader *     _reader = nullptr;                                                 // null for an empty snapshot of no tree
+      Node const * _root   = nullptr;
+  };  // class PersistentTree<Key, Value>::Snapshot
+
+
+
+
+  /*******************************************************************************
+  ** Class PersistentTree<Key, Value>::Iterator - A forward iterator
+  **
+   *******************************************************************************/
+  template <typename Key, typename Value>
+  class PersistentTree<Key, Value>::Iterator
+  {
+    friend class PersistentTree<Key, Value>::Snapshot;
+
+    public:
+      // Iterator Type Traits - Boilerplate stuff so the iterator can be used with the rest of the standard library
+      using iterator_category = std::forward_iterator_tag;
+      using value_type        = KeyValue_Pair;
+      using difference_type   = std::ptrdiff_t;
+      using pointer           = KeyValue_Pair const *;
+      using reference         = KeyValue_Pair const &;
+
+
+
+      Iterator() = default;                                                           // Default constructed Iterator is an end() iterator
+
+
+
+      // Pre and post Increment operators move the position to the next node in-order
+      Iterator & operator++();                                                        // advance the iterator one node in-order (pre -increment)
+      Iterator   operator++( int );                                                   // advance the iterator one node in-order (post-increment)
+
+
+
+      // Dereferencing and member access operators provide read-only access to data
+      reference operator* () const;
+      pointer   operator->() const;
+
+
+
+      // Equality operators
+      bool operator==( Iterator const & rhs ) const;
+
+
+
+    private:
+      // Member attributes.  Without parent pointers, the way back up is kept here:  the current node on top, and beneath it each
+      // ancestor whose left subtree the current node is in, the ones still to be visited
+      std::array<Node const *, MAX_LEVELS> _path  = {};
+      std::size_t                          _depth = 0;                                // 0 is end()
+
+
+
+      // Helper functions
+      void         descendLeft( Node const * current ) noexcept;                      // Pushes current and its left child, its left child, and so on
+      Node const * current    (                      ) const noexcept;                // null at end()
+  };  // class PersistentTree<Key, Value>::Iterator
+
+}    // export namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// Not exported but reachable
+/***********************************************************************************************************************************
+************************************************************************************************************************************
+** Template Implementation
+*
+** Separating Interface from Implementation is an extremely important concept I hope students will come to appreciate.
+************************************************************************************************************************************
+***********************************************************************************************************************************/
+
+/***********************************************************************************************************************************
+** Class PersistentTree - an AVL tree of immutable nodes, shared by all the versions that can reach them
+**
+**  The writer's side:
+**
+**        _root --------------------------------------+    _epoch:  3
+**                                                    |
+**        _retired:  { epoch 3, 40' }                 v
+**                   { epoch 3, 60  }                40''                version 3, built from version 2 by inserting 50.
+**                                                  /    \               40'' and 60' are copies, 20' and everything under it
+**                                               20'      60'            are version 2's own nodes
+**                                              /   \     /
+**                                            10    30'  50
+**                                                    \
+**                                                     35
+**
+**  The readers' side:
+**
+**        _readers -> +-----------+    +-----------+    +-----------+
+**                    | epoch 3   | -> | IDLE      | -> | epoch 2   | -> nullptr         a snapshot of version 2 still holds 40' and
+**                    +-----------+    +-----------+    +-----------+                    60 in memory.  Version 1's 40, 20, and 30,
+**                                                                                       retired building version 2, are released
+**
+**  A reader record is claimed by a snapshot with a compare-and-exchange from IDLE to the version number it read, and handed back
+**  by setting it to IDLE again.  If every record is in use, a new one is pushed onto the front of the list, also with a
+**  compare-and-exchange.  Records are never removed until the tree is destroyed, so a thread walking the list never finds one
+**  gone from under it.  All the atomic operations use the default, sequentially consistent, memory order:  the argument for why
+**  reclamation is safe (see snapshot() and reclaim()) relies on every thread agreeing on the order of the publishes, the
+**  announcements, and the writer's checks of them.
+***********************************************************************************************************************************/
+
+namespace CSUF::CPSC131
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // A Persistent Tree's node, reader records, and node pool
+  //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  template <typename Key, typename Value>
+  struct PersistentTree<Key, Value>::Node
+  {
+    template <typename... Args>
+    Node( std::uint64_t born, Args &&... args )
+      : _pair( std::forward<Args>( args )... ), _born{ born }
+    {}
+
+    KeyValue_Pair _pair;
+    Node *        _left   = nullptr;
+    Node *        _right  = nullptr;
+    std::size_t   _size   = 1;                                                        // Number of nodes in this subtree, so a snapshot knows its size
+    std::uint64_t _born   = 0;                                                        // The version this node was created for.  Until that version is published, no reader can see the node and
+    Height        _height = 0;                                                        // the writer may change it in place
+  };
+
+
+
+
+  template <typename Key, typename Value>
+  struct alignas( 64 ) PersistentTree<Key, Value>::Reader                           // One per cache line, so threads announcing versions don't slow each other down
+  {
+    std::atomic<std::uint64_t> _epoch = IDLE;                                         // The version number announced, IDLE when no snapshot holds this record
+    Reader *                   _next  = nullptr;                                      // Never changes once the record is in the list
+  };
+
+
+
+
+  template <typename Key, typename Value>
+  struct PersistentTree<Key, Value>::Pool : NodePool<sizeof( Node ), alignof( Node )>
+  {};
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Constructors, destructor, and assignments
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // Default constructor
+  template <typename Key, typename Value>
+  PersistentTree<Key, Value>::PersistentTree()
+    : _pool{ std::make_unique<Pool>() }
+  {}
+
+
+
+
+  // Initialization list constructor
+  template <typename Key, typename Value>
+  PersistentTree<Key, Value>::PersistentTree( std::initializer_list<KeyValue_Pair> init_list )
+    : PersistentTree()                                                                // Once delegated to, the destructor cleans up should an insert throw
+  {
+    for( auto && pair : init_list )   insert( pair );
+  }
+
+
+
+
+  // Destructor
+  template <typename Key, typename Value>
+  PersistentTree<Key, Value>::~PersistentTree() noexcept
+  {
+    // No snapshot is alive, so what's left is the latest version and the nodes replaced on the way to it
+    destroy( _root.load() );
+    for( auto [epoch, node] : _retired )   _pool->destroy( node );
+
+    for( Reader * reader = _readers.load();  reader != nullptr;  )
+    {
+      Reader * next = reader->_next;
+      delete reader;
+      reader = next;
+    }
+  }
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Readers
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // snapshot()
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Snapshot PersistentTree<Key, Value>::snapshot() const
+  {
+    // First announce a version number, then read the root.  The root is published before its number, so the root read is at least
+    // as new as the number announced, and every node reachable from it was replaced (if at all) while building a later version -
+    // the writer won't release those while this announcement stands.  Should the writer look at the reader records before the
+    // announcement is made, it can release only nodes replaced no later than the version it had published by then, and the root
+    // read after the announcement is at least that new, so it can't reach them either.
+    std::uint64_t const epoch  = _epoch.load();
+    Reader *            reader = _readers.load();
+
+    for( ;  reader != nullptr;  reader = reader->_next )                              // Reuse a record some earlier snapshot handed back ...
+    {
+      std::uint64_t idle = IDLE;
+      if( reader->_epoch.compare_exchange_strong( idle, epoch ) )   break;
+    }
+
+    if( reader == nullptr )                                                           // ... or add one
+    {
+      reader = new Reader{ ._epoch = epoch, ._next = _readers.load() };
+      while( !_readers.compare_exchange_weak( reader->_next, reader ) ) {}           // On failure, _next is updated to the new front of the list and it's tried again
+    }
+
+    return Snapshot( reader, _root.load() );
+  }
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Writer
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // size()
+  template <typename Key, typename Value>
+  std::size_t PersistentTree<Key, Value>::size() const noexcept
+  { return sizeOf( _root.load() ); }
+
+
+
+
+  // empty()
+  template <typename Key, typename Value>
+  bool PersistentTree<Key, Value>::empty() const noexcept
+  { return _root.load() == nullptr; }
+
+
+
+
+  // insert()
+  template <typename Key, typename Value>
+  bool PersistentTree<Key, Value>::insert( KeyValue_Pair const & pair )
+  {
+    auto const before = size();
+    commit( [&]( Node * root ) { return insert( root, pair.first, pair.second, false ); } );
+    return size() > before;
+  }
+
+
+
+
+  // insert_or_assign()
+  template <typename Key, typename Value>  template <typename M>
+  bool PersistentTree<Key, Value>::insert_or_assign( Key const & key, M && value )
+  {
+    auto const before = size();
+    commit( [&]( Node * root ) { return insert( root, key, std::forward<M>( value ), true ); } );
+    return size() > before;
+  }
+
+
+
+
+  // erase()
+  template <typename Key, typename Value>
+  std::size_t PersistentTree<Key, Value>::erase( Key const & key )
+  {
+    auto const before = size();
+    commit( [&]( Node * root ) { return erase( root, key ); } );
+    return before - size();
+  }
+
+
+
+
+  // clear()
+  template <typename Key, typename Value>
+  void PersistentTree<Key, Value>::clear()
+  {
+    commit( [&]( Node * root ) -> Node * { retire( root, true );  return nullptr; } );
+  }
+
+
+
+
+  // reclaim()
+  template <typename Key, typename Value>
+  std::size_t PersistentTree<Key, Value>::reclaim()
+  {
+    // A node replaced while building version e is in versions before e only.  A snapshot that announced e or later holds e or
+    // later, so only the snapshots that announced something earlier can still reach it.
+    std::uint64_t oldest = _epoch.load();                                             // With no snapshots, everything retired can go
+    for( Reader * reader = _readers.load();  reader != nullptr;  reader = reader->_next )
+    {
+      auto const announced = reader->_epoch.load();
+      if( announced != IDLE )   oldest = std::min( oldest, announced );
+    }
+
+    auto const last = std::ranges::find_if( _retired, [&]( Retired const & retired ) { return retired.epoch > oldest; } );
+    for( auto i = _retired.begin();  i != last;  ++i )   _pool->destroy( i->node );
+
+    auto const released = static_cast<std::size_t>( last - _retired.begin() );
+    _retired.erase( _retired.begin(), last );
+    return released;
+  }
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Private member functions
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // compare()
+  template <typename Key, typename Value>
+  std::weak_ordering PersistentTree<Key, Value>::compare( Key const & lhs, Key const & rhs )
+  { return std::compare_weak_order_fallback( lhs, rhs ); }                            // uses operator== and operator< if operator<=> is unavailable
+
+
+
+
+  // heightOf()
+  template <typename Key, typename Value>
+  int PersistentTree<Key, Value>::heightOf( Node const * current )
+  { return current == nullptr  ?  -1  :  current->_height; }
+
+
+
+
+  // sizeOf()
+  template <typename Key, typename Value>
+  std::size_t PersistentTree<Key, Value>::sizeOf( Node const * current )
+  { return current == nullptr  ?  0  :  current->_size; }
+
+
+
+
+  // commit() - builds the next version, then publishes it with a single store.  Should anything throw along the way, nothing has
+  // been published, so the nodes made so far are released and the nodes retired so far go back to being in use
+  template <typename Key, typename Value>  template <typename Change>
+  void PersistentTree<Key, Value>::commit( Change change )
+  {
+    Node * const root          = _root.load();
+    auto const   retiredBefore = _retired.size();
+    Node *       newRoot       = nullptr;
+
+    try
+    {
+      newRoot = change( root );
+    }
+    catch( ... )
+    {
+      for( auto node : _created )   _pool->destroy( node );
+      _created.clear();
+      _retired.erase( _retired.begin() + static_cast<std::ptrdiff_t>( retiredBefore ), _retired.end() );
+      throw;
+    }
+    _created.clear();
+
+    if( newRoot == root ) return;                                                     // nothing changed, nothing to publish
+
+    _root .store( newRoot    );                                                       // root first, then its number (see snapshot())
+    _epoch.store( building() );
+
+    if( _retired.size() >= RECLAIM_BATCH )   reclaim();
+  }
+
+
+
+
+  // building()
+  template <typename Key, typename Value>
+  std::uint64_t PersistentTree<Key, Value>::building() const noexcept
+  { return _epoch.load() + 1; }
+
+
+
+
+  // makeNode()
+  template <typename Key, typename Value>  template <typename... Args>
+  typename PersistentTree<Key, Value>::Node * PersistentTree<Key, Value>::makeNode( Args &&... args )
+  {
+    _created.reserve( _created.size() + 1 );                                          // So push_back below can't throw and leak the node
+    Node * node = _pool->template make<Node>( building(), std::forward<Args>( args )... );
+    _created.push_back( node );
+    return node;
+  }
+
+
+
+
+  // writable() - path copying happens here
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Node * PersistentTree<Key, Value>::writable( Node * current )
+  {
+    if( current->_born == building() ) return current;                                // already a copy, no reader has seen it
+
+    Node * copy = makeNode( current->_pair );
+    copy->_left   = current->_left;                                                   // the copy shares current's children
+    copy->_right  = current->_right;
+    copy->_size   = current->_size;
+    copy->_height = current->_height;
+    retire( current );
+    return copy;
+  }
+
+
+
+
+  // retire() - current is replaced in the version being built, but older versions may still be read
+  template <typename Key, typename Value>
+  void PersistentTree<Key, Value>::retire( Node * current )
+  { _retired.push_back( { building(), current } ); }
+
+
+
+
+  // retire() - and optionally its entire subtree
+  template <typename Key, typename Value>
+  void PersistentTree<Key, Value>::retire( Node * current, bool wholeSubtree )
+  {
+    if( current == nullptr ) return;                                                  // base case
+
+    if( wholeSubtree )
+    {
+      retire( current->_left,  true );                                                // recurse left
+      retire( current->_right, true );                                                // recurse right
+    }
+    retire( current );                                                                // visit
+  }
+
+
+
+
+  // updateHeight()
+  template <typename Key, typename Value>
+  void PersistentTree<Key, Value>::updateHeight( Node * current )
+  {
+    current->_height = static_cast<Height>( 1 + std::max( heightOf( current->_left ), heightOf( current->_right ) ) );
+    current->_size   = 1 + sizeOf( current->_left ) + sizeOf( current->_right );
+  }
+
+
+
+
+  // reBalance() - the same single and double rotations class BinarySearchTree's reBalance() restructures with, but on copies
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Node * PersistentTree<Key, Value>::reBalance( Node * current )
+  {
+    updateHeight( current );
+    int const balanceFactor = heightOf( current->_left ) - heightOf( current->_right );   // Height(Left) - Height(Right), as in class BinarySearchTree
+
+    if( balanceFactor > 1 )                                                           // left is too tall
+    {
+      if( heightOf( current->_left->_left ) < heightOf( current->_left->_right ) )   current->_left = rotateLeft( writable( current->_left ) );   // left-right
+      return rotateRight( current );                                                                                                          // left-left
+    }
+
+    if( balanceFactor < -1 )                                                          // right is too tall
+    {
+      if( heightOf( current->_right->_right ) < heightOf( current->_right->_left ) ) current->_right = rotateRight( writable( current->_right ) );  // right-left
+      return rotateLeft( current );                                                                                                           // right-right
+    }
+
+    return current;
+  }
+
+
+
+
+  /*******************************************************************************
+  ** rotateLeft() - current's right child takes its place.  Both end up writable
+  **
+  **         current                      pivot
+  **         /     \                     /     \
+  **        T0    pivot      ===>>   current    T2
+  **              /   \              /     \
+  **             T1    T2           T0     T1
+  *******************************************************************************/
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Node * PersistentTree<Key, Value>::rotateLeft( Node * current )
+  {
+    Node * pivot = writable( current->_right );
+    current->_right = pivot->_left;
+    updateHeight( current );
+
+    pivot->_left = current;
+    updateHeight( pivot );
+    return pivot;
+  }
+
+
+
+
+  // rotateRight() - current's left child takes its place.  Both end up writable, the mirror image of rotateLeft()
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Node * PersistentTree<Key, Value>::rotateRight( Node * current )
+  {
+    Node * pivot = writable( current->_left );
+    current->_left = pivot->_right;
+    updateHeight( current );
+
+    pivot->_right = current;
+    updateHeight( pivot );
+    return pivot;
+  }
+
+
+
+
+  // insert() - private recursive helper.  The nodes on the way back up are copied only if something below them changed
+  template <typename Key, typename Value>  template <typename M>
+  typename PersistentTree<Key, Value>::Node * PersistentTree<Key, Value>::insert( Node * current, Key const & key, M && value, bool assign )
+  {
+    if( current == nullptr ) return makeNode( key, std::forward<M>( value ) );       // base case, found where it goes
+
+    auto comp = compare( key, current->_pair.first );
+    if( comp == 0 )                                                                   // duplicate key found
+    {
+      if( !assign ) return current;
+
+      Node * node = makeNode( current->_pair.first, std::forward<M>( value ) );       // a node's pair never changes, so replace the node
+      node->_left   = current->_left;
+      node->_right  = current->_right;
+      node->_size   = current->_size;
+      node->_height = current->_height;
+      retire( current );
+      return node;
+    }
+
+    Node * child = comp < 0  ?  current->_left  :  current->_right;
+    Node * changed = insert( child, key, std::forward<M>( value ), assign );          // recurse left or right
+    if( changed == child ) return current;                                            // nothing changed below, so nothing changes here
+
+    current = writable( current );
+    ( comp < 0  ?  current->_left  :  current->_right ) = changed;
+    return reBalance( current );
+  }
+
+
+
+
+  // erase() - private recursive helper
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Node * PersistentTree<Key, Value>::erase( Node * current, Key const & key )
+  {
+    if( current == nullptr ) return nullptr;                                          // base case, not found
+
+    auto comp = compare( key, current->_pair.first );
+    if( comp != 0 )
+    {
+      Node * child   = comp < 0  ?  current->_left  :  current->_right;
+      Node * changed = erase( child, key );                                           // recurse left or right
+      if( changed == child ) return current;
+
+      current = writable( current );
+      ( comp < 0  ?  current->_left  :  current->_right ) = changed;
+      return reBalance( current );
+    }
+
+    // Found it.  With zero or one child, that child takes its place.  With two, its successor does
+    retire( current );
+    if( current->_left  == nullptr )   return current->_right;
+    if( current->_right == nullptr )   return current->_left;
+
+    auto [right, successor] = eraseFirst( current->_right );
+    successor = writable( successor );
+    successor->_left  = current->_left;
+    successor->_right = right;
+    return reBalance( successor );
+  }
+
+
+
+
+  // eraseFirst() - private recursive helper
+  template <typename Key, typename Value>
+  std::pair<typename PersistentTree<Key, Value>::Node *, typename PersistentTree<Key, Value>::Node *> PersistentTree<Key, Value>::eraseFirst( Node * current )
+  {
+    if( current->_left == nullptr ) return { current->_right, current };              // base case
+
+    auto [left, first] = eraseFirst( current->_left );                                // recurse left
+    current = writable( current );
+    current->_left = left;
+    return { reBalance( current ), first };
+  }
+
+
+
+
+  // destroy() - private recursive helper
+  template <typename Key, typename Value>
+  void PersistentTree<Key, Value>::destroy( Node * current ) noexcept
+  {
+    if( current == nullptr ) return;                                                  // base case
+
+    destroy( current->_left );                                                        // recurse left
+    destroy( current->_right );                                                       // recurse right
+    _pool->destroy( current );                                                        // visit
+  }
+
+
+
+
+
+
+
+
+
+
+
+
+  /*******************************************************************************
+  ** Class PersistentTree<Key, Value>::Snapshot - One version of the tree, read-only
+  **
+  *******************************************************************************/
+  // Constructor
+  template <typename Key, typename Value>
+  PersistentTree<Key, Value>::Snapshot::Snapshot( Reader * reader, Node const * root ) noexcept
+    : _reader{ reader }, _root{ root }
+  {}
+
+
+
+
+  // Move constructor
+  template <typename Key, typename Value>
+  PersistentTree<Key, Value>::Snapshot::Snapshot( Snapshot && other ) noexcept
+    : _reader{ std::exchange( other._reader, nullptr ) }, _root{ std::exchange( other._root, nullptr ) }
+  {}
+
+
+
+
+  // Move assignment
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Snapshot & PersistentTree<Key, Value>::Snapshot::operator=( Snapshot && rhs ) noexcept
+  {
+    if( this != &rhs )
+    {
+      if( _reader != nullptr )   _reader->_epoch.store( IDLE );                      // let go of the version held until now
+      _reader = std::exchange( rhs._reader, nullptr );
+      _root   = std::exchange( rhs._root,   nullptr );
+    }
+    return *this;
+  }
+
+
+
+
+  // Destructor
+  template <typename Key, typename Value>
+  PersistentTree<Key, Value>::Snapshot::~Snapshot() noexcept
+  { if( _reader != nullptr )   _reader->_epoch.store( IDLE ); }                      // the record goes back to the tree for the next snapshot
+
+
+
+
+  // size()
+  template <typename Key, typename Value>
+  std::size_t PersistentTree<Key, Value>::Snapshot::size() const noexcept
+  { return sizeOf( _root ); }
+
+
+
+
+  // empty()
+  template <typename Key, typename Value>
+  bool PersistentTree<Key, Value>::Snapshot::empty() const noexcept
+  { return _root == nullptr; }
+
+
+
+
+  // contains()
+  template <typename Key, typename Value>
+  bool PersistentTree<Key, Value>::Snapshot::contains( Key const & key ) const
+  { return find( key ) != end(); }
+
+
+
+
+  // begin()
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Snapshot::const_iterator PersistentTree<Key, Value>::Snapshot::begin() const
+  {
+    const_iterator result;
+    result.descendLeft( _root );                                                      // the path down to the least key
+    return result;
+  }
+
+
+
+
+  // end()
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Snapshot::const_iterator PersistentTree<Key, Value>::Snapshot::end() const noexcept
+  { return {}; }
+
+
+
+
+  // cbegin()
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Snapshot::const_iterator PersistentTree<Key, Value>::Snapshot::cbegin() const
+  { return begin(); }
+
+
+
+
+  // cend()
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Snapshot::const_iterator PersistentTree<Key, Value>::Snapshot::cend() const noexcept
+  { return end(); }
+
+
+
+
+  // at()
+  template <typename Key, typename Value>
+  Value const & PersistentTree<Key, Value>::Snapshot::at( Key const & key ) const
+  {
+    auto position = find( key );
+    if( position == end() )   throw std::out_of_range( exceptionString( "Failure:  Attempted to access nonexistent element" ) );
+    return position->second;
+  }
+
+
+
+
+  // find()
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Snapshot::const_iterator PersistentTree<Key, Value>::Snapshot::find( Key const & key ) const
+  {
+    auto position = lower_bound( key );
+    if( position != end()  &&  compare( key, position->first ) != 0 )   return end();
+    return position;
+  }
+
+
+
+
+  // lower_bound()
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Snapshot::const_iterator PersistentTree<Key, Value>::Snapshot::lower_bound( Key const & key ) const
+  { return bound<false>( key ); }
+
+
+
+
+  // upper_bound()
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Snapshot::const_iterator PersistentTree<Key, Value>::Snapshot::upper_bound( Key const & key ) const
+  { return bound<true>( key ); }
+
+
+
+
+  // bound() - descends toward key, remembering each node passed on the way that is at or above the bound.  The last one
+  // remembered is the bound itself, the ones before it the ancestors the iterator visits after it
+  template <typename Key, typename Value>  template <bool UPPER>
+  typename PersistentTree<Key, Value>::Snapshot::const_iterator PersistentTree<Key, Value>::Snapshot::bound( Key const & key ) const
+  {
+    const_iterator result;
+    for( Node const * current = _root;  current != nullptr;  )
+    {
+      auto comp = compare( current->_pair.first, key );
+      if( UPPER ? comp > 0 : comp >= 0 )   { result._path[result._depth++] = current;  current = current->_left; }
+      else                                                                         current = current->_right;
+    }
+    return result;
+  }
+
+
+
+
+
+
+
+
+
+
+
+
+  /*******************************************************************************
+  ** Class PersistentTree<Key, Value>::Iterator - A forward iterator
+  **
+  *******************************************************************************/
+  // operator++ (pre-increment)
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Iterator & PersistentTree<Key, Value>::Iterator::operator++()
+  {
+    // The next node is the least in the right subtree if there is one, otherwise the nearest ancestor still to be visited, which is
+    // already the next one on the path
+    Node const * right = current()->_right;
+    --_depth;
+    descendLeft( right );
+    return *this;
+  }
+
+
+
+
+  // operator++ (post-increment)
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Iterator PersistentTree<Key, Value>::Iterator::operator++( int )
+  {
+    auto temp = *this;
+    ++*this;
+    return temp;
+  }
+
+
+
+
+  // operator*
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Iterator::reference PersistentTree<Key, Value>::Iterator::operator*() const
+  { return current()->_pair; }
+
+
+
+
+  // operator->
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Iterator::pointer PersistentTree<Key, Value>::Iterator::operator->() const
+  { return &current()->_pair; }
+
+
+
+
+  // operator==
+  template <typename Key, typename Value>
+  bool PersistentTree<Key, Value>::Iterator::operator==( Iterator const & rhs ) const
+  { return current() == rhs.current(); }
+
+
+
+
+  // descendLeft()
+  template <typename Key, typename Value>
+  void PersistentTree<Key, Value>::Iterator::descendLeft( Node const * current ) noexcept
+  {
+    for( ;  current != nullptr;  current = current->_left )   _path[_depth++] = current;
+  }
+
+
+
+
+  // current()
+  template <typename Key, typename Value>
+  typename PersistentTree<Key, Value>::Node const * PersistentTree<Key, Value>::Iterator::current() const noexcept
+  { return _depth == 0  ?  nullptr  :  _path[_depth - 1]; }
+}    // namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+** (C) Copyright 2022 by Thomas Bettens. All Rights Reserved.
+**
+** DISCLAIMER: The participating authors at California State University's Computer Science Department have used their best efforts
+** in preparing this code. These efforts include the development, research, and testing of the theories and programs to determine
+** their effectiveness. The authors make no warranty of any kind, expressed or implied, with regard to these programs or to the
+** documentation contained within. The authors shall not be liable in any event for incidental or consequential damages in
+** connection with, or arising out of, the furnishing, performance, or use of these libraries and programs.  Distribution without
+** written consent from the authors is prohibited.
+***********************************************************************************************************************************/
+
+/**************************************************
+** Last modified:  27-JUL-2025 (Converted to C++ Modules)
+** Last Verified:  27-JUL-2025
+** Verified with:  MS Visual Studio 2022 Version 17.14.9,  Compiler Version 19.44.35213 (/std:c++latest)
+**                 GCC version 15.1.0 (-std=c++23 )
+**                 Clang version 21.0.0 (-std=c++23 -stdlib=libc++)
+***************************************************/
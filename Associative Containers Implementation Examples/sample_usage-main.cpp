@@ -1,5 +1,33 @@
 import std;
 import CSUF.CPSC131.BinarySearchTree;
+import CSUF.CPSC131.BTree;
+import CSUF.CPSC131.PersistentTree;
+
+
+namespace    // anonymous
+{
+  // A code table built at compile time.  The tree's nodes are allocated during constant evaluation and so must be released before
+  // it ends, but what the tree computed (here, the codes in sorted order) is copied into a std::array embedded in the program.
+  using StatusCode = std::pair<unsigned, std::string_view>;
+
+  constexpr CSUF::CPSC131::BinarySearchTree<unsigned, std::string_view> makeStatusCodes()
+  {
+    return { {404, "Not Found"}, {200, "OK"}, {500, "Internal Server Error"}, {301, "Moved Permanently"}, {403, "Forbidden"},
+             {201, "Created"},   {503, "Service Unavailable"},                {304, "Not Modified"},      {400, "Bad Request"} };
+  }
+
+  constexpr auto statusCodes = []
+  {
+    auto const tree = makeStatusCodes();
+
+    std::array<StatusCode, 9> table{};
+    std::ranges::copy( tree, table.begin() );                             // In-order traversal, so the table comes out sorted by code
+    return table;
+  }();
+
+  static_assert( makeStatusCodes().at( 404 ) == "Not Found" );            // Looked up by the compiler, not when the program runs
+  static_assert( statusCodes.front().first == 200  &&  statusCodes.back().first == 503 );
+}    // anonymous namespace
 
 
 int main()
@@ -125,6 +153,16 @@ int main()
     testTree.erase (  20     );
     testTree.erase (  10     );
 
+    // Erasing can leave a node whose taller child has two equally tall children.  Only a single rotation rebalances that shape, a
+    // double rotation leaves it lopsided.  The six keys left here fit in a tree of height 2
+    {
+      BinarySearchTree<int, int> tieTree;
+      for( int key : { 3, 1, 6, 2, 7, 5, 4, 8 } )   tieTree.insert( { key, 0 } );
+      tieTree.erase( 1 );
+      tieTree.erase( 2 );
+      if( tieTree.getHeight() != 2 ) print( cerr, "Tree height does not match expected\n" );
+    }
+
 
     // print the entire BST using a range-based for loop and structured bindings
     cout << "for( auto && [key, value] : testTree ):\n";
@@ -137,6 +175,125 @@ int main()
     // And again with range formatting
     print( cout, "format \"{{}}\", testTree\n"
                  "{}\n", testTree );
+
+
+    // Bulk loading.  Constructing from sorted records links them straight into a balanced tree in O(n), no rotations needed, and
+    // insert_range() sorts a batch and merges it in rather than rebalancing after each insertion
+    {
+      std::vector<std::pair<unsigned, int>> sortedRecords;
+      for( unsigned id = 1; id <= 1'000; ++id )   sortedRecords.emplace_back( id * 10, static_cast<int>( id ) );
+
+      BinarySearchTree<unsigned, int> index( sortedRecords.begin(), sortedRecords.end() );
+      index.insert_range( std::vector<std::pair<unsigned, int>>{ {15, -1}, {5, -2}, {10, -3} } );      // {10, -3} is not added, key 10 is already there
+
+      print( cout, "\nBulk loaded {} records with a tree height of {}, first three: {}\n",
+             index.size(), index.getHeight(), std::ranges::subrange( index.begin(), std::next( index.begin(), 3 ) ) );
+
+      // Erasing every other record leaves free slots scattered all through the tree's node pool.  compact() moves the remaining
+      // nodes into fresh blocks, here in van Emde Boas order to speed up searches.  (shrink_to_fit() would instead just hand back
+      // the blocks left completely empty, moving nothing.)
+      for( unsigned id = 1; id <= 1'000; id += 2 )   index.erase( id * 10 );
+      index.compact( CSUF::CPSC131::TreeLayout::VAN_EMDE_BOAS );
+      print( cout, "After erasing half and compacting, {} records remain and {} is still found\n", index.size(), index.at( 20 ) );
+    }
+
+
+    // Heterogeneous lookup and range queries.  ThreeWayCompare<> is transparent, so the roster can be searched with a std::string_view
+    // (or a string literal) without first building a temporary std::string, and lower_bound() finds where a range begins in O(log n)
+    {
+      BinarySearchTree<std::string, double, CSUF::CPSC131::ThreeWayCompare<>> roster = { {"Barbara", 4.0 }, {"Chen",  2.5 }, {"Ellen",   3.5},
+                                                                                         {"Kevin",   3.25}, {"Kumar", 3.05}, {"Ricardo", 2.5} };
+      std::string_view name = "Kumar";
+      print( cout, "\n{} is {}on the roster\n", name, roster.contains( name ) ? "" : "not " );
+
+      print( cout, "Students from \"C\" up to, but not including, \"K\":\n" );
+      for( auto i = roster.lower_bound( "C" ), last = roster.lower_bound( "K" );   i != last;   ++i )
+      {
+        print( cout, "{:>8}'s grade point average is {:.2f}\n", i->first, i->second );
+      }
+
+      // Any comparison function object can order the keys, for example std::greater<> sorts them from greatest to least
+      BinarySearchTree<int, int, std::greater<>> descending = { {7, 0}, {13, 0}, {4, 0}, {15, 0} };
+      print( cout, "Ordered by std::greater<>:  {}\n", descending );
+    }
+
+
+    // Augmented trees.  With SubtreeSum, each node also keeps the size and value total of its subtree, so percentiles and windowed
+    // sums are found in O(log n) rather than by walking the tree.  The totals depend on the values, so the values are read-only
+    // (no operator[], and at() and the iterators give read-only values) and are changed through insert_or_assign() instead.
+    {
+      BinarySearchTree<unsigned, double, CSUF::CPSC131::ThreeWayCompare<unsigned>, CSUF::CPSC131::SubtreeSum> latencies;   // request time (seconds) -> latency (ms)
+      for( unsigned second = 0; second < 3'600; ++second )   latencies.insert( { second, 10.0 + ( second * 37 ) % 90 } );
+      latencies.insert_or_assign( 1'800u, 250.0 );                                    // a late correction
+
+      auto window = latencies.aggregate( 1'200, 2'400 );                              // the 20 minutes starting at 00:20:00
+      print( cout, "\nRequests from 00:20:00 to 00:40:00:  {} averaging {:.2f} ms\n", window.size, window.sum / static_cast<double>( window.size ) );
+      print( cout, "The 90th percentile request time is {} seconds, and {} requests came before 01:00:00\n",
+             latencies.nth( latencies.size() * 9 / 10 )->first, latencies.rank( 3'600 ) );
+    }
+
+
+    // Set operations.  Each shard keeps its own index, and merging them relinks the shards' nodes rather than copying them, so
+    // folding a small shard into a large index costs about as much as inserting the small shard's records one at a time
+    {
+      BinarySearchTree<unsigned, std::string> index  = { {101, "Barbara"}, {205, "Chen"}, {318, "Ellen"}, {422, "Kevin"} };
+      BinarySearchTree<unsigned, std::string> shard1 = { {205, "Chen"},    {530, "Kumar"} };
+      BinarySearchTree<unsigned, std::string> shard2 = { {640, "Ricardo"}, {702, "Sam"}   };
+      BinarySearchTree<unsigned, std::string> closed = { {101, "Barbara"}, {640, "Ricardo"} };
+
+      index.unite   ( std::move( shard1 ) );                                          // 205 is already indexed, the index's record is kept
+      index.join    ( std::move( shard2 ) );                                          // every key in shard2 is greater, O(log n)
+      index.subtract( std::move( closed ) );
+      print( cout, "\nMerged index of {} open accounts:  {}\n", index.size(), index );
+    }
+
+
+    // A B-Tree has the same interface, so swapping one in is only a change of type.  Its nodes each hold dozens of keys, searched
+    // with SIMD instructions, and its leaves are linked together so iterating never climbs back up the tree
+    {
+      CSUF::CPSC131::BTree<unsigned, int> index;
+      for( unsigned id = 1; id <= 1'000; ++id )   index[ ( id * 7'919 ) % 1'000 ] = static_cast<int>( id );     // Keys 0..999, inserted in scrambled order
+
+      for( unsigned id = 0; id < 1'000; id += 2 )   index.erase( id );
+
+      print( cout, "\nB-Tree holds {} records, {} through {}, and record 501 is {}\n",
+             index.size(), index.begin()->first, std::prev( index.end() )->first, index.at( 501 ) );
+
+      CSUF::CPSC131::BTree<std::string, double> bTreeGradeBook = { {"Barbara", 4.0 }, {"Chen",  2.5 }, {"Ellen",   3.5},
+                                                                   {"Kevin",   3.25}, {"Kumar", 3.05}, {"Ricardo", 2.5} };
+      print( cout, "B-Tree grade book:  {}\n", bTreeGradeBook );
+    }
+
+
+    // A persistent tree shares one writer's changes with many readers without any locks.  Each reader works from a snapshot, a
+    // version of the tree that never changes, while the writer keeps publishing new versions alongside it.  Here the writer keeps
+    // a price list current while auditors running in other threads each total up the version they started from
+    {
+      CSUF::CPSC131::PersistentTree<std::string, double> prices = { {"apples", 1.25}, {"bread", 3.50}, {"coffee", 9.75} };
+      auto opening = prices.snapshot();                                               // the price list as the day opened
+
+      std::vector<double> audits( 4 );
+      {
+        std::vector<std::jthread> auditors;
+        for( auto & total : audits )   auditors.emplace_back( [&prices, &total]
+        {
+          auto version = prices.snapshot();                                           // whatever version is latest right now
+          for( auto && [item, price] : version )   total += price;
+        } );
+
+        prices.insert_or_assign( "coffee", 10.25 );                                   // meanwhile, the writer carries on
+        prices.insert          ( { "dates", 6.00 } );
+        prices.erase           ( "bread" );
+      }                                                                               // jthreads join as they leave scope
+
+      print( cout, "\nThe day opened with {} prices, coffee at {:.2f}, and has {} now, coffee at {:.2f}\n",
+             opening.size(), opening.at( "coffee" ), prices.size(), prices.snapshot().at( "coffee" ) );
+      print( cout, "Each auditor saw one consistent version, totaling {}\n", audits );
+    }
+
+
+    // And finally, the status code table built by a tree while compiling
+    print( cout, "\nStatus codes sorted at compile time:\n{}\n", statusCodes );
   }
 
   catch( const std::exception & ex )
@@ -157,5 +314,19 @@ namespace CSUF::CPSC131
 {
   template class BinarySearchTree<std::string, double     >;
   template class BinarySearchTree<unsigned,    int        >;
+  template class BinarySearchTree<unsigned,    std::string>;
   template class BinarySearchTree<double,      std::string>;
+  template class BinarySearchTree<std::string, double,      ThreeWayCompare<>>;
+  template class BinarySearchTree<int,         int,         std::greater<>   >;
+  template class BinarySearchTree<unsigned,    double,      ThreeWayCompare<unsigned>, SubtreeSum     >;
+  template class BinarySearchTree<std::string, int,         ThreeWayCompare<>,         SubtreeMax     >;
+  template class BinarySearchTree<int,         std::string, std::greater<>,            OrderStatistics>;
+
+  template class BTree<std::string, double     >;
+  template class BTree<unsigned,    int        >;
+  template class BTree<double,      std::string>;
+  template class BTree<int,         int,         4>;                                  // The smallest fan-out, the most splits and merges
+
+  template class PersistentTree<std::string, double>;
+  template class PersistentTree<unsigned,    int   >;
 }
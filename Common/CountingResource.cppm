@@ -0,0 +1,101 @@
+/***********************************************************************************************************************************
+** Common class and functions used in the CSUF 131 Implementation Examples
+**
+**  A std::pmr::memory_resource that counts the requests passing through it on their way to another (upstream) memory resource.
+**  Hand one to a container using a std::pmr::polymorphic_allocator to observe how often, and how much, that container allocates.
+***********************************************************************************************************************************/
+module;                                                                               // Global fragment (not part of the module)
+  // Empty
+
+
+
+
+/***********************************************************************************************************************************
+**  Module CSUF.CPSC131.CountingResource Interface
+**
+***********************************************************************************************************************************/
+export module CSUF.CPSC131.CountingResource;                                          // Primary Module Interface Definition
+import std;
+
+
+export namespace CSUF::CPSC131
+{
+  // Usage:  std::pmr::monotonic_buffer_resource  arena;
+  //         CountingResource                     counter( &arena );                 // Count requests, but let the arena satisfy them
+  //         CSUF::CPSC131::pmr::Vector<int>      v( &counter );
+  //         ...
+  //         std::print( "{} allocations, {} bytes in use", counter.allocations(), counter.bytesInUse() );
+  class CountingResource : public std::pmr::memory_resource
+  {
+    public:
+      explicit CountingResource( std::pmr::memory_resource * upstream = std::pmr::get_default_resource() ) noexcept
+        : _upstream{ upstream }
+      {}
+
+      // Queries
+      std::size_t allocations  () const noexcept { return _allocations;   }   // Number of allocation requests so far
+      std::size_t deallocations() const noexcept { return _deallocations; }   // Number of deallocation requests so far
+      std::size_t bytesInUse   () const noexcept { return _bytesInUse;    }   // Bytes allocated but not yet deallocated
+      std::size_t peakBytes    () const noexcept { return _peakBytes;     }   // High water mark of bytesInUse()
+
+      std::pmr::memory_resource * upstream() const noexcept { return _upstream; }
+
+    private:
+      // The three customization points every memory resource overrides
+      void * do_allocate( std::size_t bytes, std::size_t alignment ) override
+      {
+        void * memory = _upstream->allocate( bytes, alignment );              // Count only requests that succeed
+        ++_allocations;
+        _bytesInUse += bytes;
+        _peakBytes   = std::max( _peakBytes, _bytesInUse );
+        return memory;
+      }
+
+      void do_deallocate( void * memory, std::size_t bytes, std::size_t alignment ) override
+      {
+        _upstream->deallocate( memory, bytes, alignment );
+        ++_deallocations;
+        _bytesInUse -= bytes;
+      }
+
+      bool do_is_equal( std::pmr::memory_resource const & other ) const noexcept override
+      { return this == &other; }                                              // Memory must go back to the very resource it came from
+
+      // Attributes
+      std::pmr::memory_resource * _upstream      = nullptr;                   // Where the memory really comes from
+      std::size_t                 _allocations   = 0;
+      std::size_t                 _deallocations = 0;
+      std::size_t                 _bytesInUse    = 0;
+      std::size_t                 _peakBytes     = 0;
+  };
+}  // CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+** (C) Copyright 2025 by Thomas Bettens. All Rights Reserved.
+**
+** DISCLAIMER: The participating authors at California State University's Computer Science Department have used their best efforts
+** in preparing this code. These efforts include the development, research, and testing of the theories and programs to determine
+** their effectiveness. The authors make no warranty of any kind, expressed or implied, with regard to these programs or to the
+** documentation contained within. The authors shall not be liable in any event for incidental or consequential damages in
+** connection with, or arising out of, the furnishing, performance, or use of these libraries and programs.  Distribution without
+** written consent from the authors is prohibited.
+***********************************************************************************************************************************/
+
+/**************************************************
+** Last modified:  27-JUL-2025 (Converted to C++ Modules)
+** Last Verified:  27-JUL-2025
+** Verified with:  MS Visual Studio 2022 Version 17.14.9,  Compiler Version 19.44.35213 (/std:c++latest)
+**                 GCC version 15.1.0 (-std=c++23 )
+**                 Clang version 21.0.0 (-std=c++23 -stdlib=libc++)
+***************************************************/
@@ -0,0 +1 @@
+../Associative Containers Implementation Examples/BST-AVL.cppm
\ No newline at end of file
@@ -0,0 +1,712 @@
+/***********************************************************************************************************************************
+** Class Cache - a bounded key/value cache that evicts by recency (LRU), frequency (LFU), or the 2Q policy.  Like Stack and Queue,
+**               the Cache is an adapter:  it adds no storage of its own, but composes a DoublyLinkedList, which keeps the entries in
+**               eviction order, with a BinarySearchTree, which finds an entry's node given its key.
+**
+**  LRU:
+**                                                        _recency (DoublyLinkedList<Entry>)
+**                                            most recently used                         least recently used (the victim)
+**                                                    |                                               |
+**                                                    v                                               v
+**                                             +-------------+    +-------------+    +-------------+
+**                                             | "dog" : 17  |<-->| "ant" :  3  |<-->| "cat" : 42  |
+**                                             +-------------+    +-------------+    +-------------+
+**                                                    ^                  ^                  ^
+**     _index (BinarySearchTree<Key, Location>)       |                  |                  |
+**        { "ant",  -----------------------------------------------------+                  |
+**          "cat",  ------------------------------------------------------------------------+
+**          "dog"   ----------------------------------+
+**        }
+**
+**  A hit finds the entry's node through the index in O(log n), then moves that very node to the front of the list by relinking it
+**  with DoublyLinkedList::splice() in O(1).  Nothing is erased and pushed again, so an LRU or 2Q hit never allocates or frees a node.
+**  When the cache is full, inserting evicts the entry at the victim end of the list, calling the eviction handler first so the
+**  owner can write the value back, log it, or move it somewhere else.
+**
+**  Policies:
+**    LRU     Evicts the least recently used entry.
+**    LFU     Evicts the least frequently used entry, least recently used among equals.  Entries with the same use count share a
+**            bucket, and the buckets are kept in a list in increasing use count order, so a hit moves the entry to the neighboring
+**            bucket in O(1).  A hit allocates only when it creates a use count no other entry has yet.
+**    TWO_Q   Johnson and Shasha's 2Q.  First time entries wait in a FIFO (A1in) where further hits don't promote them, so a one
+**            time scan can't flush the working set.  The keys (only) of entries evicted from A1in are remembered for a while
+**            (A1out), and if such a key comes back it's admitted straight into an LRU (Am) holding the proven entries.
+**
+**  Only find() counts hits and misses.  contains() looks without touching or counting, and put() on a key already present replaces
+**  the value and touches the entry but is not counted as a hit.  Cache hits and misses are counted so the hit ratio and eviction
+**  rate can be monitored.
+***********************************************************************************************************************************/
+module;                                                                               // Global fragment (not part of the module)
+  // Empty
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+**  Module CSUF.CPSC131.Cache Interface
+**
+***********************************************************************************************************************************/
+export module CSUF.CPSC131.Cache;
+import std;
+import CSUF.CPSC131.exceptionString;
+import CSUF.CPSC131.DoublyLinkedList;
+import CSUF.CPSC131.BinarySearchTree;
+
+
+
+
+namespace CSUF::CPSC131
+{
+  export enum class CachePolicy {LRU, LFU, TWO_Q};
+
+  template<typename, typename, CachePolicy> struct CacheMembers;                      // intentionally not exported
+
+
+
+  // Template Class Definition
+  export template<typename Key, typename Value, CachePolicy POLICY = CachePolicy::LRU>
+  class Cache
+  {
+    public:
+      // Types
+      struct Statistics
+      {
+        std::size_t hits       = 0;                                                   // find() calls that found the key
+        std::size_t misses     = 0;                                                   // find() calls that did not
+        std::size_t insertions = 0;                                                   // put() calls that added a new entry
+        std::size_t evictions  = 0;                                                   // entries removed to make room for a new one
+
+        double hitRatio     () const noexcept { return hits + misses == 0  ?  0.0  :  static_cast<double>( hits      ) / static_cast<double>( hits + misses ); }
+        double evictionRatio() const noexcept { return insertions    == 0  ?  0.0  :  static_cast<double>( evictions ) / static_cast<double>( insertions    ); }
+      };
+
+      using EvictionHandler = std::function<void( Key const & key, Value & value )>; // Called with each entry just before it's evicted
+
+
+
+      // Constructors, destructor, and assignments
+      explicit Cache     ( std::size_t capacity, EvictionHandler onEviction = {} );   // capacity is the maximum number of entries, and must be at least 1
+      Cache              ( Cache const  & original ) = delete;                        // the index refers to the very nodes in this cache's lists
+      Cache              ( Cache       && original ) = default;
+      Cache & operator=  ( Cache const  & rhs      ) = delete;
+      Cache & operator=  ( Cache       && rhs      ) = default;
+     ~Cache              (                         ) = default;                       // entries still cached are destroyed, not evicted
+
+
+
+      // Queries
+      bool        empty     (                 ) const noexcept;                       // returns true if the cache holds no entries
+      std::size_t size      (                 ) const noexcept;                       // returns the number of entries cached
+      std::size_t capacity  (                 ) const noexcept;                       // returns the most entries the cache will hold
+      bool        contains  ( Key const & key ) const;                                // returns true if key is cached.  Does not touch the entry or count a hit or miss
+      Statistics  statistics(                 ) const noexcept;                       // returns the hit, miss, insertion, and eviction counts
+
+
+
+      // Accessors
+      Value * find( Key const & key );                                                // returns the cached value and touches its entry (a hit), or nullptr (a miss)
+
+
+
+      // Modifiers
+      Value & put            ( Key const & key, Value value );                        // caches value under key, replacing any value already there, evicting an entry if the cache is full
+      bool    erase          ( Key const & key              );                        // removes key's entry without calling the eviction handler, returns true if there was one
+      void    clear          (                              );                        // removes all entries without calling the eviction handler
+      void    resetStatistics(                              ) noexcept;               // sets all the counts back to zero
+
+
+
+    private:
+      // Types
+      using PrivateAttributes = CacheMembers<Key, Value, POLICY>;                     // A specific policy's lists and how to maintain them
+      using Entry             = PrivateAttributes::Entry;
+      using Location          = PrivateAttributes::Location;                          // Where in the policy's lists an entry's node is
+
+      // Helper functions
+      void evict();                                                                   // evicts the policy's victim
+
+      // Member attributes
+      PrivateAttributes               _lists;                                         // the entries, in the policy's eviction order
+      BinarySearchTree<Key, Location> _index;                                         // key to list node
+      std::size_t                     _capacity;
+      EvictionHandler                 _onEviction;
+      Statistics                      _statistics;
+  };  // class Cache
+}    // namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+************************************************************************************************************************************
+** Private Implementation
+**
+************************************************************************************************************************************
+***********************************************************************************************************************************/
+
+// Not exported but reachable
+// Organization:
+//  o)  The cached entry
+//  o)  LRU Specific
+//  o)  LFU Specific
+//  o)  2Q Specific
+//  o)  Common across all Cache policies
+//
+// Each policy's members provide the same small set of functions the common code dispatches to:
+//    Entry &  entry ( Location )                   the entry at location
+//    Location admit ( Entry const & )              links a new entry into the policy's lists
+//    void     touch ( Location & )                 the entry was used again, relink it accordingly (may update location)
+//    Location victim()                             the entry to evict next
+//    void     remove( Location, bool evicted )     unlinks and destroys the entry at location
+//    void     clear ()                             unlinks and destroys all entries
+namespace CSUF::CPSC131
+{
+  template<typename Key, typename Value>
+  struct CacheEntry
+  {
+    Key   _key   = Key  {};
+    Value _value = Value{};
+  };
+}    // namespace CSUF::CPSC131
+
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// An LRU cache's unique private type, attribute, and function members
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace CSUF::CPSC131
+{
+  template<typename Key, typename Value>
+  struct CacheMembers<Key, Value, CachePolicy::LRU>
+  {
+    // Types
+    using Entry    = CacheEntry<Key, Value>;
+    using Location = DoublyLinkedList<Entry>::iterator;
+
+
+
+    // Member instance attributes
+    DoublyLinkedList<Entry> _recency;                                                 // most recently used at the front, the victim at the back
+
+
+
+    //==============================================================================================================================
+    // Specialized functions implemented specifically for an LRU cache
+    //
+    //==============================================================================================================================
+    explicit CacheMembers( std::size_t /*capacity*/ )
+    {}
+
+
+
+    Entry & entry( Location location )
+    { return *location; }
+
+
+
+    Location admit( Entry const & entry )
+    {
+      _recency.push_front( entry );
+      return _recency.begin();
+    }
+
+
+
+    void touch( Location & location )
+    { _recency.splice( _recency.begin(), _recency, location ); }                      // relinks the node, the location stays valid
+
+
+
+    Location victim()
+    { return std::prev( _recency.end() ); }
+
+
+
+    void remove( Location location, bool /*evicted*/ )
+    { _recency.erase( location ); }
+
+
+
+    void clear()
+    { _recency.clear(); }
+  };  // struct CacheMembers
+}    // namespace CSUF::CPSC131
+
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// An LFU cache's unique private type, attribute, and function members
+//
+//   _buckets:   +-----------+        +-----------+        +-----------+
+//               | used 1x   |<------>| used 2x   |<------>| used 5x   |
+//               +-----------+        +-----------+        +-----------+
+//                 |                    |                    |
+//                 v                    v                    v
+//               "eel" <-> "fox"      "ant"                "dog" <-> "cat"
+//                           ^
+//                           +--- victim:  least recent entry of the least used bucket
+//
+//   A hit on "ant" moves its node to the front of a new "used 3x" bucket linked in after "used 2x", and since that leaves "used 2x"
+//   empty, "used 2x" is removed.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace CSUF::CPSC131
+{
+  template<typename Key, typename Value>
+  struct CacheMembers<Key, Value, CachePolicy::LFU>
+  {
+    // Types
+    using Entry = CacheEntry<Key, Value>;
+
+    struct Bucket                                                                     // entries used the same number of times
+    {
+      std::size_t             _frequency = 0;
+      DoublyLinkedList<Entry> _entries;                                               // most recently used at the front
+    };
+
+    struct Location
+    {
+      DoublyLinkedList<Bucket>::iterator _bucket;
+      DoublyLinkedList<Entry >::iterator _entry;
+    };
+
+
+
+    // Member instance attributes
+    DoublyLinkedList<Bucket> _buckets;                                                // in increasing frequency order, so the victim's bucket is at the front
+
+
+
+    //==============================================================================================================================
+    // Specialized functions implemented specifically for an LFU cache
+    //
+    //==============================================================================================================================
+    explicit CacheMembers( std::size_t /*capacity*/ )
+    {}
+
+
+
+    Entry & entry( Location const & location )
+    { return *location._entry; }
+
+
+
+    Location admit( Entry const & entry )
+    {
+      if( _buckets.empty()  ||  _buckets.front()._frequency != 1 )   _buckets.push_front( Bucket{ 1, {} } );
+
+      auto bucket = _buckets.begin();
+      bucket->_entries.push_front( entry );
+      return { bucket, bucket->_entries.begin() };
+    }
+
+
+
+    void touch( Location & location )
+    {
+      // Move the entry to the front of the bucket for one more use, starting that bucket if there isn't one yet
+      auto next = std::next( location._bucket );
+      if( next == _buckets.end()  ||  next->_frequency != location._bucket->_frequency + 1 )
+      {
+        next = _buckets.insert( next, Bucket{ location._bucket->_frequency + 1, {} } );
+      }
+
+      next->_entries.splice( next->_entries.begin(), location._bucket->_entries, location._entry );   // relinks the node, the entry's iterator stays valid
+
+      if( location._bucket->_entries.empty() )   _buckets.erase( location._bucket );
+      location._bucket = next;
+    }
+
+
+
+    Location victim()
+    {
+      auto bucket = _buckets.begin();
+      return { bucket, std::prev( bucket->_entries.end() ) };
+    }
+
+
+
+    void remove( Location const & location, bool /*evicted*/ )
+    {
+      location._bucket->_entries.erase( location._entry );
+      if( location._bucket->_entries.empty() )   _buckets.erase( location._bucket );
+    }
+
+
+
+    void clear()
+    { _buckets.clear(); }
+  };  // struct CacheMembers
+}    // namespace CSUF::CPSC131
+
+
+
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// A 2Q cache's unique private type, attribute, and function members
+//
+//   new key ------> A1in (FIFO, about a quarter of capacity) ------> evicted, key remembered in A1out (keys only, FIFO)
+//                                                                                           |
+//   key found in A1out --------> Am (LRU, the rest) ------> evicted, forgotten              |
+//          ^                                                                                |
+//          +--------------------------------------------------------------------------------+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace CSUF::CPSC131
+{
+  template<typename Key, typename Value>
+  struct CacheMembers<Key, Value, CachePolicy::TWO_Q>
+  {
+    // Types
+    using Entry = CacheEntry<Key, Value>;
+
+    enum class Queue {A1IN, AM};
+
+    struct Location
+    {
+      Queue                             _queue;
+      DoublyLinkedList<Entry>::iterator _entry;
+    };
+
+    using GhostIndex = BinarySearchTree<Key, typename DoublyLinkedList<Key>::iterator>;
+
+
+
+    // Member instance attributes
+    DoublyLinkedList<Entry> _a1in;                                                    // entries seen once recently, newest at the front
+    DoublyLinkedList<Entry> _am;                                                      // entries seen again after leaving A1in, most recently used at the front
+    DoublyLinkedList<Key>   _a1out;                                                   // keys of entries recently evicted from A1in, newest at the front
+    GhostIndex              _ghosts;                                                  // key to A1out node
+    std::size_t             _a1inTarget;                                              // A1in's share of the capacity
+    std::size_t             _a1outCapacity;                                           // how many evicted keys to remember
+
+
+
+    //==============================================================================================================================
+    // Specialized functions implemented specifically for a 2Q cache
+    //
+    //==============================================================================================================================
+    explicit CacheMembers( std::size_t capacity )                                     // Johnson and Shasha suggest 25% and 50% of capacity
+      : _a1inTarget   { std::max<std::size_t>( 1, capacity / 4 ) },
+        _a1outCapacity{ std::max<std::size_t>( 1, capacity / 2 ) }
+    {}
+
+
+
+    Entry & entry( Location const & location )
+    { return *location._entry; }
+
+
+
+    Location admit( Entry const & entry )
+    {
+      // A key evicted from A1in not long ago has now been asked for again, so it has proven itself.  Admit it straight to Am
+      if( auto ghost = _ghosts.find( entry._key );  ghost != _ghosts.end() )
+      {
+        _a1out.erase( ghost->second );
+        _ghosts.erase( ghost );
+
+        _am.push_front( entry );
+        return { Queue::AM, _am.begin() };
+      }
+
+      _a1in.push_front( entry );
+      return { Queue::A1IN, _a1in.begin() };
+    }
+
+
+
+    void touch( Location & location )
+    {
+      // Hits while in A1in are left alone on purpose, they are usually correlated (one burst of use), not a sign of a hot entry
+      if( location._queue == Queue::AM )   _am.splice( _am.begin(), _am, location._entry );
+    }
+
+
+
+    Location victim()
+    {
+      if( _a1in.size() > _a1inTarget  ||  _am.empty() )   return { Queue::A1IN, std::prev( _a1in.end() ) };
+      else                                                return { Queue::AM,   std::prev( _am  .end() ) };
+    }
+
+
+
+    void remove( Location const & location, bool evicted )
+    {
+      if( location._queue == Queue::AM )
+      {
+        _am.erase( location._entry );
+        return;
+      }
+
+      if( evicted )                                                                   // remember the key (but not the value)
+      {
+        _a1out.push_front( location._entry->_key );
+        try
+        {
+          _ghosts.insert( { location._entry->_key, _a1out.begin() } );
+        }
+        catch( ... )                                                                  // remember nothing, and leave the entry where it was
+        {
+          _a1out.pop_front();
+          throw;
+        }
+
+        if( _a1out.size() > _a1outCapacity )                                          // forget the oldest remembered key
+        {
+          _ghosts.erase( _a1out.back() );
+          _a1out.pop_back();
+        }
+      }
+      _a1in.erase( location._entry );
+    }
+
+
+
+    void clear()
+    {
+      _a1in  .clear();
+      _am    .clear();
+      _a1out .clear();
+      _ghosts.clear();
+    }
+  };  // struct CacheMembers
+}    // namespace CSUF::CPSC131
+
+
+
+
+
+
+/***********************************************************************************************************************************
+** Common functions for all Cache policies
+**
+***********************************************************************************************************************************/
+namespace CSUF::CPSC131
+{
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Constructors, destructor, and assignments
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // Constructor
+  template<typename Key, typename Value, CachePolicy POLICY>
+  Cache<Key, Value, POLICY>::Cache( std::size_t capacity, EvictionHandler onEviction )
+    : _lists     { capacity                },
+      _capacity  { capacity                },
+      _onEviction{ std::move( onEviction ) }
+  {
+    if( capacity == 0 )   throw std::invalid_argument( exceptionString( "Attempt to create a cache that can hold nothing" ) );
+  }
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Queries
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // empty() const
+  template<typename Key, typename Value, CachePolicy POLICY>
+  bool Cache<Key, Value, POLICY>::empty() const noexcept
+  { return size() == 0; }
+
+
+
+  // size() const
+  template<typename Key, typename Value, CachePolicy POLICY>
+  std::size_t Cache<Key, Value, POLICY>::size() const noexcept
+  { return _index.size(); }
+
+
+
+  // capacity() const
+  template<typename Key, typename Value, CachePolicy POLICY>
+  std::size_t Cache<Key, Value, POLICY>::capacity() const noexcept
+  { return _capacity; }
+
+
+
+  // contains() const
+  template<typename Key, typename Value, CachePolicy POLICY>
+  bool Cache<Key, Value, POLICY>::contains( Key const & key ) const
+  { return _index.contains( key ); }
+
+
+
+  // statistics() const
+  template<typename Key, typename Value, CachePolicy POLICY>
+  typename Cache<Key, Value, POLICY>::Statistics Cache<Key, Value, POLICY>::statistics() const noexcept
+  { return _statistics; }
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Accessors
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // find()
+  template<typename Key, typename Value, CachePolicy POLICY>
+  Value * Cache<Key, Value, POLICY>::find( Key const & key )
+  {
+    auto found = _index.find( key );
+    if( found == _index.end() )
+    {
+      ++_statistics.misses;
+      return nullptr;
+    }
+
+    ++_statistics.hits;
+    _lists.touch( found->second );                                                    // dispatch to policy specific implementation, updating the index's location in place
+    return &_lists.entry( found->second )._value;
+  }
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Modifiers
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // put()
+  template<typename Key, typename Value, CachePolicy POLICY>
+  Value & Cache<Key, Value, POLICY>::put( Key const & key, Value value )
+  {
+    // Already cached?  Replace the value and touch the entry
+    if( auto found = _index.find( key );  found != _index.end() )
+    {
+      _lists.entry( found->second )._value = std::move( value );
+      _lists.touch( found->second );
+      return _lists.entry( found->second )._value;
+    }
+
+    if( size() == _capacity )   evict();                                              // make room
+
+    Location location = _lists.admit( Entry{ key, std::move( value ) } );             // dispatch to policy specific implementation
+    try
+    {
+      _index.insert( { key, location } );
+    }
+    catch( ... )                                                                      // keep the lists and the index consistent
+    {
+      _lists.remove( location, false );
+      throw;
+    }
+
+    ++_statistics.insertions;
+    return _lists.entry( location )._value;
+  }
+
+
+
+  // erase()
+  template<typename Key, typename Value, CachePolicy POLICY>
+  bool Cache<Key, Value, POLICY>::erase( Key const & key )
+  {
+    auto found = _index.find( key );
+    if( found == _index.end() )   return false;
+
+    Location location = found->second;                                                // the index's copy goes away with the index's node
+    _index.erase( found );
+    _lists.remove( location, false );
+    return true;
+  }
+
+
+
+  // clear()
+  template<typename Key, typename Value, CachePolicy POLICY>
+  void Cache<Key, Value, POLICY>::clear()
+  {
+    _index.clear();
+    _lists.clear();
+  }
+
+
+
+  // resetStatistics()
+  template<typename Key, typename Value, CachePolicy POLICY>
+  void Cache<Key, Value, POLICY>::resetStatistics() noexcept
+  { _statistics = {}; }
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Helper functions
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // evict()
+  template<typename Key, typename Value, CachePolicy POLICY>
+  void Cache<Key, Value, POLICY>::evict()
+  {
+    Location victim = _lists.victim();                                                // dispatch to policy specific implementation
+    Entry &  entry  = _lists.entry( victim );
+
+    if( _onEviction )   _onEviction( entry._key, entry._value );                      // last chance to see (or take) the value
+
+    // Removing the victim from the lists can throw (2Q remembers the evicted key), so do that first and drop the index's entry
+    // last.  The index's entry is found while the victim's key is still there to find it with.
+    auto found = _index.find( entry._key );
+    _lists.remove( victim, true );
+    _index.erase( found );
+    ++_statistics.evictions;
+  }
+}    // namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+** (C) Copyright 2025 by Thomas Bettens. All Rights Reserved.
+**
+** DISCLAIMER: The participating authors at California State University's Computer Science Department have used their best efforts
+** in preparing this code. These efforts include the development, research, and testing of the theories and programs to determine
+** their effectiveness. The authors make no warranty of any kind, expressed or implied, with regard to these programs or to the
+** documentation contained within. The authors shall not be liable in any event for incidental or consequential damages in
+** connection with, or arising out of, the furnishing, performance, or use of these libraries and programs.  Distribution without
+** written consent from the authors is prohibited.
+***********************************************************************************************************************************/
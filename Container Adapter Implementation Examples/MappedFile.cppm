@@ -0,0 +1 @@
+../Sequence Container Implementation Examples/Vector/MappedFile.cppm
\ No newline at end of file
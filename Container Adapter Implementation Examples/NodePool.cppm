@@ -0,0 +1 @@
+../Sequence Container Implementation Examples/SinglyLinkedList/NodePool.cppm
\ No newline at end of file
@@ -0,0 +1 @@
+../Sequence Container Implementation Examples/Vector/ParallelChunks.cppm
\ No newline at end of file
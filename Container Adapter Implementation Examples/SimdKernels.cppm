@@ -0,0 +1 @@
+../Sequence Container Implementation Examples/Vector/SimdKernels.cppm
\ No newline at end of file
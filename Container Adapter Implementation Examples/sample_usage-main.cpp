@@ -1,4 +1,5 @@
 import std;
+import CSUF.CPSC131.Cache;
 import CSUF.CPSC131.DoublyLinkedList;
 import CSUF.CPSC131.Stack;
 import CSUF.CPSC131.Queue;
@@ -86,6 +87,36 @@ namespace
 
 
   }
+
+
+
+  // A cache is an adapter too, over a doubly linked list and a binary search tree.  This driver looks up students by name.  Half the
+  // lookups are for a few favorite students, the rest cycle through a larger group of popular students, and mixed in are students
+  // looked up once and never again (a scan).  Compare how well each policy keeps the students worth keeping.
+  template<CSUF::CPSC131::CachePolicy POLICY>
+  void cacheDemo( std::string_view policyName )
+  {
+    using CSUF::CPSC131::Student;
+
+    std::size_t writeBacks = 0;
+    CSUF::CPSC131::Cache<std::string, Student, POLICY> cache( 20, [&]( std::string const &, Student & ) { ++writeBacks; } );
+
+    auto lookup = [&]( std::string const & name )
+    {
+      if( cache.find( name ) == nullptr )   cache.put( name, Student( name ) );       // a miss, so "fetch" the student and cache it
+    };
+
+    for( unsigned i = 0;  i < 3'000;  ++i )
+    {
+      if( i % 2 == 0 )   lookup( std::format( "Favorite_{:02}", i / 2 % 4  ) );
+      else               lookup( std::format( "Popular_{:02}",  i * 7 % 30 ) );
+      if( i % 4 == 3 )   lookup( std::format( "Scanned_{:04}",  i          ) );
+    }
+
+    auto statistics = cache.statistics();
+    std::print( std::cout, "{:<6} cache:  hits: {:>5}  misses: {:>5}  hit ratio: {:>5.1f}%  evictions: {:>5}  eviction ratio: {:>5.1f}%  write backs: {:>5}\n",
+                           policyName, statistics.hits, statistics.misses, statistics.hitRatio() * 100, statistics.evictions, statistics.evictionRatio() * 100, writeBacks );
+  }
 }     // namespace
 
 
@@ -118,6 +149,10 @@ int main()
       demo( myStack );
     }
 
+    { Stack<Student, DoublyLinkedList<Student, CSUF::CPSC131::DllPolicy::ARENA>> myStack;    // empty stack where stack is implemented over an arena backed, index linked doubly linked list
+      demo( myStack );
+    }
+
     { Stack<Student, std::list<Student>> myStack;           // empty stack where stack is implemented over standard doubly linked list
       demo( myStack );
     }
@@ -186,6 +221,10 @@ int main()
       demo( myQueue);
     }
 
+    { Queue<Student, SinglyLinkedList<Student, CSUF::CPSC131::SllPolicy::UNROLLED>> myQueue;    // empty queue where queue is implemented over an unrolled singly linked list (several students per node)
+      demo( myQueue );
+    }
+
     { Queue<Student, DoublyLinkedList<Student>> myQueue;    // empty queue where queue is implemented over a doubly linked list
       demo( myQueue );
     }
@@ -241,6 +280,19 @@ int main()
     { std::queue<Student, std::list<Student>> myQueue_6;    // standard queue with standard doubly linked list as underlying container
       demo( myQueue_6 );
     }
+
+
+
+
+
+
+    /*******************************************************************************************************************************
+    **  CACHES
+    *******************************************************************************************************************************/
+    std::print( std::cout, "\n\n\nCaches holding 20 students at a time\n" );
+    cacheDemo<CSUF::CPSC131::CachePolicy::LRU  >( "LRU" );
+    cacheDemo<CSUF::CPSC131::CachePolicy::LFU  >( "LFU" );
+    cacheDemo<CSUF::CPSC131::CachePolicy::TWO_Q>( "2Q"  );
   }
 
   catch (const std::exception & ex)
@@ -277,6 +329,7 @@ namespace CSUF::CPSC131
   template class Stack< Student,   std::forward_list<Student                          > >;
   template class Stack< Student,   SinglyLinkedList <Student                          > >;
   template class Stack< Student,   DoublyLinkedList <Student                          > >;
+  template class Stack< Student,   DoublyLinkedList <Student, DllPolicy::ARENA        > >;
 
   // Queues
   template class Queue_Over_Array < Student,   std::array       <Student, 5                       > >;
@@ -288,8 +341,14 @@ namespace CSUF::CPSC131
   template class Queue_Over_List  < Student,   std::list        <Student                          > >;
   template class Queue_Over_List  < double,    SinglyLinkedList <double                           > >;
   template class Queue_Over_List  < Student,   SinglyLinkedList <Student                          > >;
+  template class Queue_Over_List  < Student,   SinglyLinkedList <Student, SllPolicy::UNROLLED     > >;
   template class Queue_Over_List  < Student,   DoublyLinkedList <Student                          > >;
 
   // The standard singly linked list is not a viable option - it cannot push to the back
   // template class Queue< Student, std::forward_list<Student> >;
+
+  // Caches
+  template class Cache<std::string, Student, CachePolicy::LRU  >;
+  template class Cache<std::string, Student, CachePolicy::LFU  >;
+  template class Cache<std::string, Student, CachePolicy::TWO_Q>;
 }    // namespace CSUF::CPSC131
@@ -8,6 +8,14 @@
 **     unlike std:list that returns revere_iterators, this example returns (normal) iterators.  rbegin() still returns an iterator
 **     to the last element in the list, but to move to the next element the iterator needs to be decremented, not incremented as
 **     with a true reverse iterator.
+**
+**  Three implementations (policies) are provided.  CIRCULAR and NTL allocate each node separately and link them with pointers.
+**  ARENA keeps all of a list's nodes in one contiguous array (the arena) and links them with 32-bit indices into that array
+**  instead of pointers, which roughly halves a node's size for small T, keeps traversal within one block of memory, and lets a
+**  list be copied with a single block copy.  Erased nodes go on a free list for reuse, and compact() renumbers the nodes into list
+**  order.  An ARENA list's iterators are an index into the arena, so they survive the arena growing and only compact() (which
+**  renumbers the nodes) invalidates them.  References and pointers to elements, however, are invalidated when the arena grows,
+**  as with std::vector.
 ***********************************************************************************************************************************/
 module;                                                                               // Global fragment (not part of the module)
   // Empty
@@ -33,7 +41,7 @@ import CSUF.CPSC131.exceptionString;
 
 namespace CSUF::CPSC131
 {
-  export enum class DllPolicy {CIRCULAR, NTL};
+  export enum class DllPolicy {CIRCULAR, NTL, ARENA};
 
   template<typename, DllPolicy> struct Members;                                       // intentionally not exported
 
@@ -123,6 +131,10 @@ namespace CSUF::CPSC131
       iterator insert( const_iterator position, T const & value );                    // Inserts an element containing "value" into list before the one occupied at position and returns an iterator to the newly inserted value
       iterator erase ( const_iterator position                  );                    // Removes from list the element occupied at position and returns an iterator to the element after the one removed
 
+      void splice( const_iterator position, DoublyLinkedList & other, const_iterator it );    // Moves other's element at it into this list before position by relinking its node, O(1).  other may be this list
+
+      void compact() requires( POLICY == DllPolicy::ARENA );                          // Renumbers the arena's nodes into list order and releases its free slots.  Invalidates all iterators
+
 
 
       // Relational Operators
@@ -195,12 +207,15 @@ namespace CSUF::CPSC131
 
     private:
       // Member attributes
-      Node * _nodePtr = nullptr;
+      Node *              _nodePtr = nullptr;
+      PrivateAttributes * _arena   = nullptr;                                         // Arena lists only:  the list whose arena holds the node.  Always null otherwise
+      std::uint32_t       _index   = 0;                                               // Arena lists only:  the node's index within that arena.  Always zero otherwise
 
 
 
       // Helper functions
       Iterator_type( Node * position ) noexcept;                                      // Implicit conversion constructor from pointer-to-Node to iterator-to-Node
+      Iterator_type( PrivateAttributes * arena, std::uint32_t index ) noexcept;      // Arena lists only:  an iterator to the node at index within arena
   };  // DoublyLinkedList<T, DllPolicy POLICY>::Iterator_type
 
 }    // namespace CSUF::CPSC131
@@ -240,6 +255,7 @@ namespace CSUF::CPSC131
 // Organization:
 //  o)  Circular Doubly Linked List With One Dummy Node Specific
 //  o)  Null-Terminated Doubly Linked List With One Dummy Node Specific
+//  o)  Arena (Index Linked) Circular Doubly Linked List With One Dummy Node Specific
 //  0)  Common across all Doubly Linked Lists
 
 
@@ -326,9 +342,26 @@ namespace CSUF::CPSC131
 
     // insert()
     Node * insert( Node * currentNode, T const & value )
+    { return link( currentNode, new Node( value ) ); }                                // create and populate a new node, then link it in
+
+
+
+    // erase()
+    Node * erase( Node * currentNode )
     {
-      Node * newNode     = new Node( value );                                         // create and populate a new node
+      if( _size == 0           )   throw std::length_error    ( exceptionString( "Attempt to erase from an empty list"     ) );
+      if( currentNode == end() )   throw std::invalid_argument( exceptionString( "Attempt to erase at an invalid location" ) );
+
+      Node * returnNode{ unlink( currentNode ) };                                     // return the node after the one removed
+      delete currentNode;                                                             // delete the old, now removed, node
+      return returnNode;
+    }
 
+
+
+    // link() - links an existing node into the list before currentNode
+    Node * link( Node * currentNode, Node * newNode ) noexcept
+    {
       newNode->_next = currentNode;                                                   // Link the node to the list
       newNode->_prev = currentNode->_prev;
 
@@ -341,20 +374,14 @@ namespace CSUF::CPSC131
 
 
 
-    // erase()
-    Node * erase( Node * currentNode )
+    // unlink() - takes currentNode out of the list without deleting it, returns the node that followed it
+    Node * unlink( Node * currentNode ) noexcept
     {
-      if( _size == 0           )   throw std::length_error    ( exceptionString( "Attempt to erase from an empty list"     ) );
-      if( currentNode == end() )   throw std::invalid_argument( exceptionString( "Attempt to erase at an invalid location" ) );
-
       currentNode->_next->_prev = currentNode->_prev;                                 // Take the node out of the list
       currentNode->_prev->_next = currentNode->_next;
 
       --_size;                                                                        // decrease the list's size
-
-      Node * returnNode{ currentNode->_next };                                        // return the node after the one removed
-      delete currentNode;                                                             // delete the old, now removed, node
-      return returnNode;
+      return currentNode->_next;
     }
 
   }; // struct Members;
@@ -443,16 +470,39 @@ namespace CSUF::CPSC131
     // insert()
     Node * insert( Node * currentNode, T const & value )
     {
-      Node * newNode     = new Node( value );                                         // Create and populate a new node with the provided data
+      // Checking head for a null pointer is not logically necessary because we know head should be null if the list is empty. But a
+      // little defensive programming here is worth while.
+      if( _size != 0  &&  _head == nullptr )   throw std::logic_error( exceptionString( "Error:  DoublyLinkedList insert() size and head inconsistency" ) );
 
+      return link( currentNode, new Node( value ) );                                  // Create and populate a new node with the provided data, then link it in
+    }
 
-      // Special Case 1:  Inserting into an empty list?
-      if( _size == 0 )   _head = _tail = newNode;                                     // Both _head and _tail now point to the same, one and only node in the list
 
 
-      // Checking head for a null pointer is not logically necessary because we know head should be null if the list is empty. But a
-      // little defensive programming here is worth while.
-      else if( _head == nullptr )   throw std::logic_error( exceptionString( "Error:  DoublyLinkedList insert() size and head inconsistency" ) );
+    // erase()
+    Node * erase( Node * currentNode )
+    {
+      // Error Case: Removing from an empty list?
+      if( _size == 0 )   throw std::length_error( exceptionString( "attempt to erase from an empty list" ) );
+
+      // Special Case 1:  Removing a node not in the list?
+      if( currentNode == end() )   throw std::length_error( exceptionString( "attempt to erase from past the end of list" ) );
+
+      Node *  returnNode{ unlink( currentNode ) };                                    // return the node after the one removed
+      delete currentNode;                                                             // delete what used to be the old node
+      return returnNode;
+    }
+
+
+
+    // link() - links an existing node into the list before currentNode
+    Node * link( Node * currentNode, Node * newNode ) noexcept
+    {
+      newNode->_next = newNode->_prev = nullptr;                                      // A relinked node may still hold its old neighbors
+
+
+      // Special Case 1:  Inserting into an empty list?
+      if( _size == 0 )   _head = _tail = newNode;                                     // Both _head and _tail now point to the same, one and only node in the list
 
 
       // Special Case 2:  Inserting at the front of the list?
@@ -491,20 +541,13 @@ namespace CSUF::CPSC131
 
 
 
-    // erase()
-    Node * erase( Node * currentNode )
+    // unlink() - takes currentNode out of the list without deleting it, returns the node that followed it
+    Node * unlink( Node * currentNode ) noexcept
     {
-      // Error Case: Removing from an empty list?
-      if( _size == 0 )   throw std::length_error( exceptionString( "attempt to erase from an empty list" ) );
-
-      // Special Case 1:  Removing a node not in the list?
-      if( currentNode == end() )   throw std::length_error( exceptionString( "attempt to erase from past the end of list" ) );
-
-
-      // Special Case 2:  Removing the node at the front of the list?
+      // Special Case 1:  Removing the node at the front of the list?
       if( currentNode == _head )
       {
-        // Special Case 3: removing the node at the back of the list?
+        // Special Case 2: removing the node at the back of the list?
         if( currentNode == _tail )                                                    // current node is both the head and the tail
         {
           _head = _tail = nullptr;
@@ -529,12 +572,195 @@ namespace CSUF::CPSC131
       }
 
       --_size;
+      return currentNode->_next;                                                      // return the node after the one removed
+    }
 
-      Node *  returnNode{ currentNode->_next };                                       // return the node after the one removed
-      delete currentNode;                                                             // delete what used to be the old node
+  }; // struct Members;
+} // namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+** Class DoublyLinkedList - a very basic example implementation of the Doubly Linked List Abstract Data Type
+**
+**  This file provides an arena backed, index linked, one-dummy node, circular implementation of the DoublyLinkedList interface
+**
+**  All nodes live in one contiguous array (the arena), and a node refers to its neighbors by their 32-bit index in the arena rather
+**  than by address.  Slot 0 is the sentinel, so index 0 doubles as "no node" (end()).  Erased slots are kept on a free list
+**  threaded through their _next indexes and are reused before the arena grows.  For an int, a node shrinks from 24 bytes (4 + 2x8,
+**  padded) to 12 (4 + 2x4), and the nodes of a list sit next to each other instead of wherever the heap put them.
+**
+**  size = 3 (after some inserts and erases):
+**
+**                   +------+----------+------+------+------+------+------+------+------+------+------+------+------+------+------+
+**          _arena:  | prev | not used | next | prev | data | next | prev |  --  | next | prev | data | next | prev | data | next |
+**                   |  1   |          |  3   |  4   |      |  0   |  --  |      |  0   |  0   |      |  4   |  3   |      |  1   |
+**                   +------+----------+------+------+------+------+------+------+------+------+------+------+------+------+------+
+**                             [0]                    [1]                  [2]                  [3]                  [4]
+**                           sentinel                 tail                 free              head, begin()
+**                            end()                                         ^
+**                                                                          |
+**          _free:  --------------------------------------------------------+     (its next, 0, ends the free list)
+**
+**  List order:  [3] -> [4] -> [1].  compact() would renumber that to [1] -> [2] -> [3] and release the free slot.
+***********************************************************************************************************************************/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// An arena backed doubly linked list's unique private type, attribute, and function members
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace CSUF::CPSC131
+{
+  template<typename T>
+  struct Members<T, DllPolicy::ARENA>
+  {
+    // Types
+    using Index = std::uint32_t;                                                      // Half the size of a pointer on 64-bit platforms
+    static constexpr Index SENTINEL = 0;                                              // The sentinel's slot, also the end of the free list
+
+    // An arena backed doubly linked list's node
+    struct Node
+    {
+      T     _data = T{};                                                              // linked list element value
+      Index _next = SENTINEL;                                                         // index of the next item in the list (or in the free list)
+      Index _prev = SENTINEL;                                                         // index of the previous item in the list
+    };
+
+
+
+    // Member instance attributes
+    // An arena backed doubly linked list's private data implementation
+    std::vector<Node> _arena = std::vector<Node>( 1 );                                // _arena[SENTINEL] is the dummy node.  The first node of the list is at _arena[_arena[SENTINEL]._next]
+    Index             _free  = SENTINEL;                                              // first slot on the free list, SENTINEL if there are none
+    std::size_t       _size  = 0;                                                     // number of elements in the collection
+
+
+
+    //==============================================================================================================================
+    // Specialized function implemented specifically for an arena backed doubly linked list
+    //
+    //==============================================================================================================================
+
+    // end(), head(), and tail()
+    Index end () const noexcept { return SENTINEL;                }
+    Index head() const noexcept { return _arena[SENTINEL]._next; }
+    Index tail() const noexcept { return _arena[SENTINEL]._prev; }
+
+
+
+    // insert()
+    Index insert( Index currentNode, T const & value )
+    {
+      Index newNode;
+
+      if( _free != SENTINEL )                                                         // reuse a free slot if there is one
+      {
+        newNode               = _free;
+        _free                 = _arena[newNode]._next;
+        _arena[newNode]._data = value;
+      }
+      else                                                                            // otherwise grow the arena by one slot
+      {
+        if( _arena.size() > std::numeric_limits<Index>::max() )   throw std::length_error( exceptionString( "Attempt to grow the arena beyond what a 32-bit index can reach" ) );
+
+        newNode = static_cast<Index>( _arena.size() );
+        _arena.push_back( Node{ value } );                                            // Node{ value } is built before the arena might move, so value may refer to an element
+      }
+
+      return link( currentNode, newNode );
+    }
+
+
+
+    // erase()
+    Index erase( Index currentNode )
+    {
+      if( _size == 0           )   throw std::length_error    ( exceptionString( "Attempt to erase from an empty list"     ) );
+      if( currentNode == end() )   throw std::invalid_argument( exceptionString( "Attempt to erase at an invalid location" ) );
+
+      Index  returnNode{ unlink( currentNode ) };                                     // return the node after the one removed
+      Node & node = _arena[currentNode];
+      node._data = T{};                                                               // release the old value's resources now rather than when the slot is reused
+      node._next = _free;                                                             // and put the slot on the free list
+      _free      = currentNode;
       return returnNode;
     }
 
+
+
+    // link() - links an existing node into the list before currentNode
+    Index link( Index currentNode, Index newNode ) noexcept
+    {
+      _arena[newNode]._next = currentNode;                                            // Link the node to the list
+      _arena[newNode]._prev = _arena[currentNode]._prev;
+
+      _arena[_arena[currentNode]._prev]._next = newNode;                              // Link the list to the node
+      _arena[currentNode]._prev               = newNode;
+
+      ++_size;                                                                        // Increase the list's size and return
+      return newNode;
+    }
+
+
+
+    // unlink() - takes currentNode out of the list, leaving it in its slot, returns the node that followed it
+    Index unlink( Index currentNode ) noexcept
+    {
+      Node & node = _arena[currentNode];
+      _arena[node._next]._prev = node._prev;                                          // Take the node out of the list
+      _arena[node._prev]._next = node._next;
+
+      --_size;                                                                        // decrease the list's size
+      return node._next;
+    }
+
+
+
+    // clear()
+    void clear()
+    {
+      // Every node is in the arena, so there's no list to walk.  Releasing the arena destroys all the elements in one sweep
+      _arena = std::vector<Node>( 1 );
+      _free  = SENTINEL;
+      _size  = 0;
+    }
+
+
+
+    // compact()
+    void compact()
+    {
+      // Copy the elements in list order into a new arena sized to fit, so the list's nodes are adjacent and in order, and the
+      // free slots are gone.  Elements are moved only if that can't throw, so should a copy throw the list is as it was
+      std::vector<Node> compacted;
+      compacted.reserve( _size + 1 );
+      compacted.emplace_back();                                                       // the sentinel
+
+      for( Index i = head();  i != SENTINEL;  i = _arena[i]._next )
+      {
+        Index newIndex = static_cast<Index>( compacted.size() );
+        compacted.push_back( Node{ std::move_if_noexcept( _arena[i]._data ), newIndex + 1, newIndex - 1 } );
+      }
+
+      compacted.back()._next      = SENTINEL;                                         // the last node wraps back around to the sentinel
+      compacted[SENTINEL]._next   = _size > 0  ?  1  :  SENTINEL;
+      compacted[SENTINEL]._prev   = static_cast<Index>( _size );
+
+      _arena = std::move( compacted );
+      _free  = SENTINEL;
+    }
+
   }; // struct Members;
 } // namespace CSUF::CPSC131
 
@@ -552,6 +778,7 @@ namespace CSUF::CPSC131
 
 
 
+
 /***********************************************************************************************************************************
 ** Common functions for all Doubly Linked List implementations
 **
@@ -584,7 +811,8 @@ namespace CSUF::CPSC131
   {
     // This new list has already been constructed and initialized to be empty.  Now, walk the original list adding copies of the
     // elements to this (initially empty) list maintaining order (i.e,  perform a deep copy)
-    for( const auto & element : original )    push_back( element );
+    if constexpr( POLICY == DllPolicy::ARENA )   *self = *original.self;             // Copying the arena copies the whole list, links and all, in one block
+    else for( const auto & element : original )    push_back( element );
   }
 
 
@@ -613,7 +841,12 @@ namespace CSUF::CPSC131
   template<typename T, DllPolicy POLICY>
   DoublyLinkedList<T, POLICY> & DoublyLinkedList<T, POLICY>::operator=( DoublyLinkedList const & rhs )
   {
-    if( &rhs != this )
+    if constexpr( POLICY == DllPolicy::ARENA )
+    {
+      if( &rhs != this )   *self = *rhs.self;                                         // Copying the arena copies the whole list, links and all, in one block
+    }
+
+    else if( &rhs != this )
     {
       auto p = begin();
       auto q = rhs.begin();
@@ -673,7 +906,7 @@ namespace CSUF::CPSC131
   // size() const
   template<typename T, DllPolicy POLICY>
   std::size_t DoublyLinkedList<T, POLICY>::size() const noexcept
-  { return self->_size; }
+  { return self ? self->_size : 0; }                                                  // a moved-from list has no self, and is empty
 
 
 
@@ -715,7 +948,10 @@ namespace CSUF::CPSC131
   // begin()
   template<typename T, DllPolicy POLICY>
   typename DoublyLinkedList<T, POLICY>::iterator DoublyLinkedList<T, POLICY>::begin() noexcept
-  { return self->_head; }
+  {
+    if constexpr( POLICY == DllPolicy::ARENA )   return { self.get(), self->head() };
+    else                                         return self->_head;
+  }
 
 
 
@@ -736,7 +972,10 @@ namespace CSUF::CPSC131
   // end()
   template <typename T, DllPolicy POLICY>
   typename DoublyLinkedList<T, POLICY>::iterator DoublyLinkedList<T, POLICY>::end() noexcept
-  { return self->end(); }                                                             // dispatch to policy specific implementation
+  {
+    if constexpr( POLICY == DllPolicy::ARENA )   return { self.get(), self->end() };  // dispatch to policy specific implementation
+    else                                         return self->end();
+  }
 
 
 
@@ -807,7 +1046,8 @@ namespace CSUF::CPSC131
   {
     if( empty() )   throw std::length_error( exceptionString( "Attempt to access the front of an empty list" ) );
 
-    return self->_head->_data;
+    if constexpr( POLICY == DllPolicy::ARENA )   return self->_arena[self->head()]._data;
+    else                                         return self->_head->_data;
   }
 
 
@@ -817,7 +1057,9 @@ namespace CSUF::CPSC131
   T & DoublyLinkedList<T, POLICY>::back()
   {
     if( empty() )    throw std::length_error( exceptionString( "Attempt to access the back of an empty list" ) );
-    return self->_tail->_data;
+
+    if constexpr( POLICY == DllPolicy::ARENA )   return self->_arena[self->tail()]._data;
+    else                                         return self->_tail->_data;
   }
 
 
@@ -830,21 +1072,24 @@ namespace CSUF::CPSC131
   // clear()
   template<typename T, DllPolicy POLICY>
   void DoublyLinkedList<T, POLICY>::clear()
-  { while( !empty() ) pop_front(); }
+  {
+    if constexpr( POLICY == DllPolicy::ARENA )   { if( self )   self->clear(); }      // no nodes to visit one at a time, just the arena to release
+    else                                         while( !empty() ) pop_front();
+  }
 
 
 
   // push_front()
   template<typename T, DllPolicy POLICY>
   void DoublyLinkedList<T, POLICY>::push_front( T const & value )
-  { insert( self->_head, value ); }
+  { insert( begin(), value ); }
 
 
 
   // pop_front
   template<typename T, DllPolicy POLICY>
   void DoublyLinkedList<T, POLICY>::pop_front()
-  { erase( self->_head ); }
+  { erase( begin() ); }
 
 
 
@@ -858,21 +1103,66 @@ namespace CSUF::CPSC131
   // pop_back()
   template<typename T, DllPolicy POLICY>
   void DoublyLinkedList<T, POLICY>::pop_back()
-  { erase( self->_tail ); }
+  {
+    if constexpr( POLICY == DllPolicy::ARENA )   erase( { self.get(), self->tail() } );
+    else                                         erase( self->_tail );
+  }
 
 
 
   // insert()
   template <typename T, DllPolicy POLICY>
   typename DoublyLinkedList<T, POLICY>::iterator DoublyLinkedList<T, POLICY>::insert( const_iterator position, T const & data )
-  { return self->insert( position._nodePtr, data ); }                                 // dispatch to policy specific implementation
+  {
+    if constexpr( POLICY == DllPolicy::ARENA )   return { self.get(), self->insert( position._index, data ) };      // dispatch to policy specific implementation
+    else                                         return self->insert( position._nodePtr, data );
+  }
 
 
 
   // erase()
   template <typename T, DllPolicy POLICY>
   typename DoublyLinkedList<T, POLICY>::iterator DoublyLinkedList<T, POLICY>::erase( const_iterator position )
-  { return self->erase( position._nodePtr ); }                                        // dispatch to policy specific implementation
+  {
+    if constexpr( POLICY == DllPolicy::ARENA )   return { self.get(), self->erase( position._index ) };             // dispatch to policy specific implementation
+    else                                         return self->erase( position._nodePtr );
+  }
+
+
+
+  // splice()
+  template <typename T, DllPolicy POLICY>
+  void DoublyLinkedList<T, POLICY>::splice( const_iterator position, DoublyLinkedList & other, const_iterator it )
+  {
+    if( other.empty()  ||  it == other.end() )   throw std::invalid_argument( exceptionString( "Attempt to splice from an invalid location" ) );
+    if( &other == this  &&  it == position   )   return;                             // already there - moving a node before itself
+
+    if constexpr( POLICY == DllPolicy::ARENA )
+    {
+      if( &other == this )                                                            // Within one arena the node can simply be relinked
+      {
+        self->unlink( it._index );
+        self->link  ( position._index, it._index );
+      }
+      else                                                                            // but each list has its own arena, so between lists the
+      {                                                                               // element has to be copied over instead
+        insert( position, *it );
+        other.erase( it );
+      }
+    }
+    else
+    {
+      other.self->unlink( it._nodePtr );                                              // Neither allocates nor copies, the node itself changes places
+      self->link( position._nodePtr, it._nodePtr );
+    }
+  }
+
+
+
+  // compact()
+  template <typename T, DllPolicy POLICY>
+  void DoublyLinkedList<T, POLICY>::compact() requires( POLICY == DllPolicy::ARENA )
+  { self->compact(); }
 
 
 
@@ -954,7 +1244,9 @@ namespace CSUF::CPSC131
   // Type of parameter is intentionally a non-constant iterator
   template<typename T, DllPolicy POLICY>   template<typename U>
   DoublyLinkedList<T, POLICY>::Iterator_type<U>::Iterator_type( iterator const & other )  noexcept    // Notice the parameter type is "iterator", not "Iterator_type"
-    : _nodePtr{ other._nodePtr }
+    : _nodePtr{ other._nodePtr },
+      _arena  { other._arena   },
+      _index  { other._index   }
   {}
 
 
@@ -967,13 +1259,31 @@ namespace CSUF::CPSC131
 
 
 
+  // Conversion Constructor from arena and index to iterator (arena lists)
+  template<typename T, DllPolicy POLICY>   template<typename U>
+  DoublyLinkedList<T, POLICY>::Iterator_type<U>::Iterator_type( PrivateAttributes * arena, std::uint32_t index ) noexcept
+    : _arena{ arena },
+      _index{ index }
+  {}
+
+
+
   // operator++   pre-increment
   template<typename T, DllPolicy POLICY>   template<typename U>
   typename DoublyLinkedList<T, POLICY>::template Iterator_type<U> &   DoublyLinkedList<T, POLICY>::Iterator_type<U>::operator++()
   {
-    if( _nodePtr == nullptr )   throw std::invalid_argument( exceptionString( "Attempt to increment null iterator.  Cannot increment end() for a null-terminated list" ) );
+    if constexpr( POLICY == DllPolicy::ARENA )
+    {
+      if( _arena == nullptr )   throw std::invalid_argument( exceptionString( "Attempt to increment null iterator" ) );
 
-    _nodePtr = _nodePtr->_next;
+      _index = _arena->_arena[_index]._next;
+    }
+    else
+    {
+      if( _nodePtr == nullptr )   throw std::invalid_argument( exceptionString( "Attempt to increment null iterator.  Cannot increment end() for a null-terminated list" ) );
+
+      _nodePtr = _nodePtr->_next;
+    }
     return *this;
   }
 
@@ -994,9 +1304,18 @@ namespace CSUF::CPSC131
   template<typename T, DllPolicy POLICY>   template<typename U>
   typename DoublyLinkedList<T, POLICY>::template Iterator_type<U> &   DoublyLinkedList<T, POLICY>::Iterator_type<U>::operator--()
   {
-    if( _nodePtr == nullptr )   throw std::invalid_argument( exceptionString( "Attempt to decrement null iterator.  Cannot decrement end() for a null-terminated list" ) );
+    if constexpr( POLICY == DllPolicy::ARENA )
+    {
+      if( _arena == nullptr )   throw std::invalid_argument( exceptionString( "Attempt to decrement null iterator" ) );
 
-    _nodePtr = _nodePtr->_prev;
+      _index = _arena->_arena[_index]._prev;
+    }
+    else
+    {
+      if( _nodePtr == nullptr )   throw std::invalid_argument( exceptionString( "Attempt to decrement null iterator.  Cannot decrement end() for a null-terminated list" ) );
+
+      _nodePtr = _nodePtr->_prev;
+    }
     return *this;
   }
 
@@ -1017,9 +1336,18 @@ namespace CSUF::CPSC131
   template<typename T, DllPolicy POLICY>   template<typename U>
   typename DoublyLinkedList<T, POLICY>::template Iterator_type<U>::reference   DoublyLinkedList<T, POLICY>::Iterator_type<U>::operator*() const
   {
-    if( _nodePtr == nullptr )   throw std::invalid_argument( exceptionString( "Attempt to dereference null iterator" ) );
+    if constexpr( POLICY == DllPolicy::ARENA )
+    {
+      if( _arena == nullptr )   throw std::invalid_argument( exceptionString( "Attempt to dereference null iterator" ) );
+
+      return _arena->_arena[_index]._data;
+    }
+    else
+    {
+      if( _nodePtr == nullptr )   throw std::invalid_argument( exceptionString( "Attempt to dereference null iterator" ) );
 
-    return _nodePtr->_data;
+      return _nodePtr->_data;
+    }
   }
 
 
@@ -1028,9 +1356,7 @@ namespace CSUF::CPSC131
   template<typename T, DllPolicy POLICY>   template<typename U>
   typename DoublyLinkedList<T, POLICY>::template Iterator_type<U>::pointer   DoublyLinkedList<T, POLICY>::Iterator_type<U>::operator->() const
   {
-    if( _nodePtr == nullptr )  throw std::invalid_argument( exceptionString( "Attempt to dereference null iterator" ) );
-
-    return &(_nodePtr->_data);
+    return &operator*();                                                              // Delegate to operator* leveraging error checking
   }
 
 
@@ -1038,7 +1364,7 @@ namespace CSUF::CPSC131
   // operator==
   template<typename T, DllPolicy POLICY>   template<typename U>
   bool DoublyLinkedList<T, POLICY>::Iterator_type<U>::operator==( Iterator_type const & rhs ) const
-  { return _nodePtr == rhs._nodePtr; }
+  { return _nodePtr == rhs._nodePtr  &&  _arena == rhs._arena  &&  _index == rhs._index; }
 }    // namespace CSUF::CPSC131
 
 
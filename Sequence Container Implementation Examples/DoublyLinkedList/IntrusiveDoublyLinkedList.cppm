@@ -0,0 +1,788 @@
+/***********************************************************************************************************************************
+** Class IntrusiveDoublyLinkedList - a doubly linked list of objects that carry their own links
+**
+**  DoublyLinkedList owns its elements.  Every insert allocates a node and copies the value into it, every erase destroys that copy
+**  and frees the node.  That's exactly right when the list is where the elements live, but when the objects already live somewhere
+**  else (a vector, a pool, a member of some other object) and all we want is to keep them in some order, the allocation and the
+**  copy are pure overhead - and the copy isn't the object anyway.
+**
+**  An intrusive list turns that around.  The element type embeds the links (the "hook") by inheriting from DllHook, and the list
+**  threads the objects themselves together through those hooks.  Linking and unlinking an object is a handful of pointer
+**  assignments, never allocates, never copies or moves the element, and because an object knows where its own links are, it can
+**  be removed in O(1) given just a reference to it - no search and no iterator required.
+**
+**  An object can sit on several lists at once, one per hook.  Hooks are told apart by a tag type, and a list names the tag of the
+**  hook it uses:
+**
+**      struct ByArrival;  struct ByPriority;                                         // tags, never defined
+**      struct Job : DllHook<ByArrival>, DllHook<ByPriority> { ... };
+**
+**      IntrusiveDoublyLinkedList<Job, ByArrival > arrivalOrder;                       // both lists link the very same Job objects
+**      IntrusiveDoublyLinkedList<Job, ByPriority> priorityOrder;
+**
+**  The list is circular with one dummy node (just a hook, no element), so end() can be decremented and std::reverse_iterator works
+**  as expected:
+**
+**                 +--------------------------------------------------------------------------------------------+
+**                 |                                                                                            |
+**                 v            +---------- Job ----------+      +---------- Job ----------+                    |
+**       +------+------+        | +------+------+         |      | +------+------+         |                    |
+**  +----| prev | next |<------>| | prev | next |  data   |<---->| | prev | next |  data   |                    |
+**  |    +------+------+        | +------+------+         |      | +------+------+         |                    |
+**  |     sentinel              +-------------------------+      +-------------------------+                    |
+**  |        ^                    ^  (hook)                        ^                                            |
+**  |      end()                begin()                          tail                                           |
+**  +-----------------------------------------------------------------------------------------------------------+
+**
+**  Ownership rules (the price of not owning anything):
+**    1) The list never creates, copies, or destroys an element.  Objects must outlive their membership on every list they're on,
+**       so remove an object from its lists before destroying it.  Destroying or clearing a list just unlinks its elements.
+**    2) An object is on at most one list per hook.  Linking an object whose hook is already linked is an error.
+**    3) Copying an object does not copy its links, the copy starts out unlinked.  Moving an object doesn't move them either.
+**    4) Lists can't be copied (elements can't be on two lists through one hook), but they can be moved.
+***********************************************************************************************************************************/
+module;                                                                               // Global fragment (not part of the module)
+  // Empty
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+**  Module CSUF.CPSC131.IntrusiveDoublyLinkedList Interface
+**
+***********************************************************************************************************************************/
+export module CSUF.CPSC131.IntrusiveDoublyLinkedList;
+import std;
+import CSUF.CPSC131.exceptionString;
+
+
+
+
+namespace CSUF::CPSC131
+{
+  export template<typename T, typename TAG> class IntrusiveDoublyLinkedList;
+
+
+  // The links an element embeds, one per list it can be on.  TAG distinguishes several hooks in the same element.
+  export template<typename TAG = void>
+  class DllHook
+  {
+    template<typename, typename>
+    friend class IntrusiveDoublyLinkedList;
+
+    public:
+      DllHook            (                 ) noexcept = default;                      // Unlinked
+      DllHook            ( DllHook const & ) noexcept {}                              // Copies start out unlinked, links are never copied
+      DllHook & operator=( DllHook const & ) noexcept { return *this; }               // Assigning elements leaves both elements' links alone
+     ~DllHook            (                 ) noexcept = default;                      // Unlink from the list before destroying the element
+
+      bool is_linked() const noexcept { return _next != nullptr; }                    // True if currently on a list through this hook
+
+    private:
+      DllHook * _next = nullptr;                                                      // next item in the list, nullptr when unlinked
+      DllHook * _prev = nullptr;                                                      // previous item in the list, nullptr when unlinked
+  };
+
+
+
+
+  // Template Class Definition
+  export template<typename T, typename TAG = void>
+  class IntrusiveDoublyLinkedList
+  {
+    static_assert( std::is_base_of_v<DllHook<TAG>, T>, "IntrusiveDoublyLinkedList<T, TAG> requires T to publicly inherit from DllHook<TAG>" );
+
+    private:
+      // Types
+      template <typename U> class  Iterator_type;                                     // Template class for iterator and const_iterator classes
+      using Hook = DllHook<TAG>;                                                      // The "node" is the hook embedded in each element
+
+      // Member attributes
+      Hook        _sentinel;                                                          // dummy node, never an element.  The first element's hook is at *(_sentinel._next)
+      std::size_t _size = 0;                                                          // number of elements currently linked
+
+
+
+    public:
+      // Types
+      using value_type     = T;
+      using iterator       = Iterator_type<T      >;                                  // A bi-directional iterator to a read-write value in the list
+      using const_iterator = Iterator_type<T const>;                                  // A bi-directional iterator to a read-only value in the list
+
+      using reverse_iterator       = std::reverse_iterator<iterator>;                 // A bi-directional iterator to a read-write value in the list
+      using const_reverse_iterator = std::reverse_iterator<const_iterator>;           // A bi-directional iterator to a read-only value in the list
+
+
+
+      // Constructors, destructor, and assignments
+      IntrusiveDoublyLinkedList            (                                            ) noexcept; // default constructor
+      IntrusiveDoublyLinkedList            ( IntrusiveDoublyLinkedList const & original ) = delete; // an element is on at most one list per hook
+      IntrusiveDoublyLinkedList            ( IntrusiveDoublyLinkedList      && original ) noexcept; // move constructor, the elements (not copies) change lists
+      IntrusiveDoublyLinkedList & operator=( IntrusiveDoublyLinkedList const & rhs      ) = delete;
+      IntrusiveDoublyLinkedList & operator=( IntrusiveDoublyLinkedList      && rhs      ) noexcept; // move assignment, this list's elements are unlinked first
+     ~IntrusiveDoublyLinkedList            (                                            ) noexcept; // destructor, unlinks (but does not destroy) the elements
+
+
+
+      // Queries
+      bool        empty() const noexcept;                                             // returns true if list has no items
+      std::size_t size () const noexcept;                                             // returns the number of elements in the list
+      T const &   front() const;                                                      // return list's front element
+      T const &   back () const;                                                      // return list's back element
+
+
+
+      // Iterators
+      iterator               begin ()       noexcept;                                 // Returns a read-write iterator to the list's front element, end() if list is empty
+      iterator               end   ()       noexcept;                                 // Returns a read-write iterator beyond the list's back element.  Do not dereference this iterator
+
+      const_iterator         begin () const noexcept;                                 // Returns a read-only iterator to the list's front element, end() if list is empty
+      const_iterator         end   () const noexcept;                                 // Returns a read-only iterator beyond the list's back element.  Do not dereference this iterator
+
+      const_iterator         cbegin() const noexcept;                                 // Returns a read-only iterator to the list's front element, end() if list is empty
+      const_iterator         cend  () const noexcept;                                 // Returns a read-only iterator beyond the list's back element.  Do not dereference this iterator
+
+
+      reverse_iterator       rbegin ()       noexcept;                                // Returns a read-write reverse iterator to the list's back element, rend() if list is empty
+      reverse_iterator       rend   ()       noexcept;                                // Returns a read-write reverse iterator before the list's front element.  Do not dereference this iterator
+
+      const_reverse_iterator rbegin () const noexcept;                                // Returns a read-only reverse iterator to the list's back element, rend() if list is empty
+      const_reverse_iterator rend   () const noexcept;                                // Returns a read-only reverse iterator before the list's front element.  Do not dereference this iterator
+
+      const_reverse_iterator crbegin() const noexcept;                                // Returns a read-only reverse iterator to the list's back element, rend() if list is empty
+      const_reverse_iterator crend  () const noexcept;                                // Returns a read-only reverse iterator before the list's front element.  Do not dereference this iterator
+
+
+      static iterator        iterator_to( T       & element );                        // Returns an iterator to an element known to be on this (kind of) list, O(1)
+      static const_iterator  iterator_to( T const & element );
+
+
+
+      // Accessors
+      T & front();                                                                    // Read-write access to the list's front element
+      T & back ();                                                                    // Read-write access to the list's back element
+
+
+
+      // Modifiers
+      void clear     (                 ) noexcept;                                    // unlink all elements setting size to zero
+      void push_front( T & element     );                                             // link "element" (not a copy) to the front of list
+      void push_back ( T & element     );                                             // link "element" (not a copy) to the back of list
+      void pop_front (                 );                                             // unlink the element at front of list
+      void pop_back  (                 );                                             // unlink the element at back of list
+
+      iterator insert( const_iterator position, T & element );                        // Links "element" into list before the one occupied at position and returns an iterator to it
+      iterator erase ( const_iterator position              );                        // Unlinks from list the element occupied at position and returns an iterator to the element after the one removed
+      iterator erase ( T const &      element               );                        // Unlinks "element", which must be on this list, and returns an iterator to the element after it.  O(1), no search
+
+
+
+    private:
+      // Helper functions
+      static Hook & hookOf( T const & element ) noexcept;                             // The element's hook for this kind of list
+      void          link  ( Hook * position, Hook * hook  ) noexcept;                 // Links hook in before position
+      Hook *        unlink( Hook * hook                   ) noexcept;                 // Unlinks hook, returns what followed it
+      void          adopt ( IntrusiveDoublyLinkedList & other ) noexcept;             // Takes over other's (non-empty) chain leaving other empty
+  };  // class IntrusiveDoublyLinkedList
+
+
+
+
+  // Non-member functions
+  export template<typename T, typename TAG>
+  void swap( IntrusiveDoublyLinkedList<T, TAG> & lhs, IntrusiveDoublyLinkedList<T, TAG> & rhs ) noexcept;
+
+
+
+
+
+
+  /*********************************************************************************************************************************
+  ** Class IntrusiveDoublyLinkedList<T, TAG>::iterator - A doubly linked bi-directional iterator
+  **
+  ** Identical in spirit to DoublyLinkedList's iterator, except the position is an element's hook and dereferencing converts the
+  ** hook back to the element that embeds it.
+  *********************************************************************************************************************************/
+  template<typename T, typename TAG>   template<typename U>
+  class IntrusiveDoublyLinkedList<T, TAG>::Iterator_type
+  {
+    friend class IntrusiveDoublyLinkedList<T, TAG>;
+
+    public:
+      // Iterator Type Traits - Boilerplate stuff so the iterator can be used with the rest of the standard library
+      using iterator_category = std::bidirectional_iterator_tag;
+      using value_type        = U;
+      using difference_type   = std::ptrdiff_t;
+      using pointer           = value_type *;
+      using reference         = value_type &;
+
+
+
+      Iterator_type(                        ) = default;                              // Default constructed Iterator_type returns a pseudo Sentinel (null pointer in this case)
+      Iterator_type( iterator const & other ) noexcept;                               // Copy constructor when U is non-const, Conversion constructor from non-const to const iterator when U is const
+
+
+
+      // Pre and post Increment operators move the position to the next element in the list
+      Iterator_type & operator++();                                                   // advance the iterator one element (pre -increment)
+      Iterator_type   operator++( int );                                              // advance the iterator one element (post-increment)
+
+
+
+      // Pre and post Decrement operators move the position to the previous element in the list
+      Iterator_type & operator--();                                                   // retreat the iterator one element (pre -decrement)
+      Iterator_type   operator--( int );                                              // retreat the iterator one element (post-decrement)
+
+
+
+      // Dereferencing and member access operators provide access to the element itself (not a copy)
+      reference operator* () const;
+      pointer   operator->() const;
+
+
+
+      // Equality operators
+      bool operator==( Iterator_type const & rhs ) const;                             // Symmetrically compares all const & non-const iterator combinations, with the help of the Conversion constructor above
+
+
+
+    private:
+      // Member attributes
+      Hook * _hookPtr = nullptr;
+
+
+
+      // Helper functions
+      Iterator_type( Hook * position ) noexcept;                                      // Implicit conversion constructor from pointer-to-Hook to iterator
+  };  // IntrusiveDoublyLinkedList<T, TAG>::Iterator_type
+}    // namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+************************************************************************************************************************************
+** Private Implementation
+**
+************************************************************************************************************************************
+***********************************************************************************************************************************/
+
+// Not exported but reachable
+namespace CSUF::CPSC131
+{
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Constructors, destructor, and assignments
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // Default constructor
+  template<typename T, typename TAG>
+  IntrusiveDoublyLinkedList<T, TAG>::IntrusiveDoublyLinkedList() noexcept
+  { _sentinel._next = _sentinel._prev = &_sentinel; }                                 // An empty circular list's sentinel points to itself
+
+
+
+  // Move constructor
+  template<typename T, typename TAG>
+  IntrusiveDoublyLinkedList<T, TAG>::IntrusiveDoublyLinkedList( IntrusiveDoublyLinkedList && original ) noexcept
+    : IntrusiveDoublyLinkedList()
+  { adopt( original ); }
+
+
+
+  // Move assignment
+  template<typename T, typename TAG>
+  IntrusiveDoublyLinkedList<T, TAG> & IntrusiveDoublyLinkedList<T, TAG>::operator=( IntrusiveDoublyLinkedList && rhs ) noexcept
+  {
+    if( &rhs != this )
+    {
+      clear();
+      adopt( rhs );
+    }
+    return *this;
+  }
+
+
+
+  // Destructor
+  template<typename T, typename TAG>
+  IntrusiveDoublyLinkedList<T, TAG>::~IntrusiveDoublyLinkedList() noexcept
+  { clear(); }
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Queries
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // empty() const
+  template<typename T, typename TAG>
+  bool IntrusiveDoublyLinkedList<T, TAG>::empty() const noexcept
+  { return size() == 0; }
+
+
+
+  // size() const
+  template<typename T, typename TAG>
+  std::size_t IntrusiveDoublyLinkedList<T, TAG>::size() const noexcept
+  { return _size; }
+
+
+
+  // front() const
+  template<typename T, typename TAG>
+  T const & IntrusiveDoublyLinkedList<T, TAG>::front() const
+  { return const_cast<IntrusiveDoublyLinkedList<T, TAG> *>( this )->front(); }        // to implement the logic in one place, delegate to non-const version
+
+
+
+  // back() const
+  template<typename T, typename TAG>
+  T const & IntrusiveDoublyLinkedList<T, TAG>::back() const
+  { return const_cast<IntrusiveDoublyLinkedList<T, TAG> *>( this )->back(); }         // to implement the logic in one place, delegate to non-const version
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Iterators
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // begin()
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::iterator IntrusiveDoublyLinkedList<T, TAG>::begin() noexcept
+  { return _sentinel._next; }
+
+
+
+  // begin() const
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::const_iterator IntrusiveDoublyLinkedList<T, TAG>::begin() const noexcept
+  { return const_cast<IntrusiveDoublyLinkedList<T, TAG> *>( this )->begin(); }
+
+
+
+  // cbegin() const
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::const_iterator IntrusiveDoublyLinkedList<T, TAG>::cbegin() const noexcept
+  { return begin(); }
+
+
+
+  // end()
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::iterator IntrusiveDoublyLinkedList<T, TAG>::end() noexcept
+  { return &_sentinel; }
+
+
+
+  // end() const
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::const_iterator IntrusiveDoublyLinkedList<T, TAG>::end() const noexcept
+  { return const_cast<IntrusiveDoublyLinkedList<T, TAG> *>( this )->end(); }
+
+
+
+  // cend() const
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::const_iterator IntrusiveDoublyLinkedList<T, TAG>::cend() const noexcept
+  { return end(); }
+
+
+
+  // rbegin()
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::reverse_iterator IntrusiveDoublyLinkedList<T, TAG>::rbegin() noexcept
+  { return std::make_reverse_iterator( end() ); }
+
+
+
+  // rbegin() const
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::const_reverse_iterator IntrusiveDoublyLinkedList<T, TAG>::rbegin() const noexcept
+  { return std::make_reverse_iterator( end() ); }
+
+
+
+  // crbegin() const
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::const_reverse_iterator IntrusiveDoublyLinkedList<T, TAG>::crbegin() const noexcept
+  { return std::make_reverse_iterator( end() ); }
+
+
+
+  // rend()
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::reverse_iterator IntrusiveDoublyLinkedList<T, TAG>::rend() noexcept
+  { return std::make_reverse_iterator( begin() ); }
+
+
+
+  // rend() const
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::const_reverse_iterator IntrusiveDoublyLinkedList<T, TAG>::rend() const noexcept
+  { return std::make_reverse_iterator( begin() ); }
+
+
+
+  // crend() const
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::const_reverse_iterator IntrusiveDoublyLinkedList<T, TAG>::crend() const noexcept
+  { return std::make_reverse_iterator( begin() ); }
+
+
+
+  // iterator_to()
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::iterator IntrusiveDoublyLinkedList<T, TAG>::iterator_to( T & element )
+  {
+    if( !hookOf( element ).is_linked() )   throw std::invalid_argument( exceptionString( "Attempt to get an iterator to an element not on a list" ) );
+    return &hookOf( element );
+  }
+
+
+
+  // iterator_to() const
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::const_iterator IntrusiveDoublyLinkedList<T, TAG>::iterator_to( T const & element )
+  { return iterator_to( const_cast<T &>( element ) ); }
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Accessors
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // front()
+  template<typename T, typename TAG>
+  T & IntrusiveDoublyLinkedList<T, TAG>::front()
+  {
+    if( empty() )   throw std::length_error( exceptionString( "Attempt to access the front of an empty list" ) );
+    return *begin();
+  }
+
+
+
+  // back()
+  template<typename T, typename TAG>
+  T & IntrusiveDoublyLinkedList<T, TAG>::back()
+  {
+    if( empty() )   throw std::length_error( exceptionString( "Attempt to access the back of an empty list" ) );
+    return *rbegin();
+  }
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Modifiers
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // clear()
+  template<typename T, typename TAG>
+  void IntrusiveDoublyLinkedList<T, TAG>::clear() noexcept
+  {
+    // Nothing to destroy, but each element's hook must be reset so the element can be linked onto a list again later
+    for( Hook * hook = _sentinel._next;  hook != &_sentinel;  )
+    {
+      Hook * next = hook->_next;
+      hook->_next = hook->_prev = nullptr;
+      hook = next;
+    }
+
+    _sentinel._next = _sentinel._prev = &_sentinel;
+    _size           = 0;
+  }
+
+
+
+  // push_front()
+  template<typename T, typename TAG>
+  void IntrusiveDoublyLinkedList<T, TAG>::push_front( T & element )
+  { insert( begin(), element ); }
+
+
+
+  // push_back()
+  template<typename T, typename TAG>
+  void IntrusiveDoublyLinkedList<T, TAG>::push_back( T & element )
+  { insert( end(), element ); }
+
+
+
+  // pop_front()
+  template<typename T, typename TAG>
+  void IntrusiveDoublyLinkedList<T, TAG>::pop_front()
+  { erase( begin() ); }
+
+
+
+  // pop_back()
+  template<typename T, typename TAG>
+  void IntrusiveDoublyLinkedList<T, TAG>::pop_back()
+  { erase( std::prev( end() ) ); }
+
+
+
+  // insert()
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::iterator IntrusiveDoublyLinkedList<T, TAG>::insert( const_iterator position, T & element )
+  {
+    Hook & hook = hookOf( element );
+    if( hook.is_linked()             )   throw std::invalid_argument( exceptionString( "Attempt to insert an element already linked on a list through this hook" ) );
+    if( position._hookPtr == nullptr )   throw std::invalid_argument( exceptionString( "Attempt to insert at an invalid location" ) );
+
+    link( position._hookPtr, &hook );
+    return &hook;
+  }
+
+
+
+  // erase()
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::iterator IntrusiveDoublyLinkedList<T, TAG>::erase( const_iterator position )
+  {
+    if( _size == 0                                                          )   throw std::length_error    ( exceptionString( "Attempt to erase from an empty list"     ) );
+    if( position._hookPtr == &_sentinel  ||  position._hookPtr == nullptr )   throw std::invalid_argument( exceptionString( "Attempt to erase at an invalid location" ) );
+
+    return unlink( position._hookPtr );
+  }
+
+
+
+  // erase() given the element itself
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::iterator IntrusiveDoublyLinkedList<T, TAG>::erase( T const & element )
+  {
+    // The hook can say whether it's on *a* list, but not which one.  Confirming it's on *this* list would take an O(n) walk, which
+    // is exactly what an intrusive list is meant to avoid, so that remains the caller's responsibility.
+    if( _size == 0                     )   throw std::length_error    ( exceptionString( "Attempt to erase from an empty list"       ) );
+    if( !hookOf( element ).is_linked() )   throw std::invalid_argument( exceptionString( "Attempt to erase an element not on a list" ) );
+
+    return unlink( &hookOf( element ) );
+  }
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Helper functions
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // hookOf()
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::Hook & IntrusiveDoublyLinkedList<T, TAG>::hookOf( T const & element ) noexcept
+  { return const_cast<T &>( element ); }                                              // derived-to-base conversion selects the TAG'ed hook
+
+
+
+  // link()
+  template<typename T, typename TAG>
+  void IntrusiveDoublyLinkedList<T, TAG>::link( Hook * position, Hook * hook ) noexcept
+  {
+    hook->_next = position;                                                           // Link the element to the list
+    hook->_prev = position->_prev;
+
+    position->_prev->_next = hook;                                                    // Link the list to the element
+    position->_prev        = hook;
+
+    ++_size;
+  }
+
+
+
+  // unlink()
+  template<typename T, typename TAG>
+  typename IntrusiveDoublyLinkedList<T, TAG>::Hook * IntrusiveDoublyLinkedList<T, TAG>::unlink( Hook * hook ) noexcept
+  {
+    Hook * next = hook->_next;
+
+    hook->_next->_prev = hook->_prev;                                                 // Take the element out of the list
+    hook->_prev->_next = hook->_next;
+    hook->_next        = hook->_prev = nullptr;                                       // and mark it unlinked so it can be linked again
+
+    --_size;
+    return next;
+  }
+
+
+
+  // adopt()
+  template<typename T, typename TAG>
+  void IntrusiveDoublyLinkedList<T, TAG>::adopt( IntrusiveDoublyLinkedList & other ) noexcept
+  {
+    // The first and last elements point back at other's sentinel, which lives inside other, so they have to be re-pointed at ours
+    if( other.empty() )   return;
+
+    _sentinel._next         = other._sentinel._next;
+    _sentinel._prev         = other._sentinel._prev;
+    _sentinel._next->_prev  = &_sentinel;
+    _sentinel._prev->_next  = &_sentinel;
+    _size                   = other._size;
+
+    other._sentinel._next = other._sentinel._prev = &other._sentinel;
+    other._size           = 0;
+  }
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Non-member functions
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // swap()
+  template<typename T, typename TAG>
+  void swap( IntrusiveDoublyLinkedList<T, TAG> & lhs, IntrusiveDoublyLinkedList<T, TAG> & rhs ) noexcept
+  {
+    IntrusiveDoublyLinkedList<T, TAG> temp( std::move( lhs ) );                        // Only the sentinels move, the elements stay put
+    lhs = std::move( rhs );
+    rhs = std::move( temp );
+  }
+
+
+
+
+
+
+  /*********************************************************************************************************************************
+  **********************************************************************************************************************************
+  ** IntrusiveDoublyLinkedList<>::iterator Member Function Definitions
+  **
+  *********************************************************************************************************************************/
+  // Copy constructor when U is non-const iterator, Conversion constructor from non-const to const iterator when U is a const iterator
+  // Type of parameter is intentionally a non-constant iterator
+  template<typename T, typename TAG>   template<typename U>
+  IntrusiveDoublyLinkedList<T, TAG>::Iterator_type<U>::Iterator_type( iterator const & other ) noexcept
+    : _hookPtr{ other._hookPtr }
+  {}
+
+
+
+  // Conversion Constructor from pointer-to-Hook to iterator
+  template<typename T, typename TAG>   template<typename U>
+  IntrusiveDoublyLinkedList<T, TAG>::Iterator_type<U>::Iterator_type( Hook * p ) noexcept
+    : _hookPtr{ p }
+  {}
+
+
+
+  // operator++   pre-increment
+  template<typename T, typename TAG>   template<typename U>
+  typename IntrusiveDoublyLinkedList<T, TAG>::template Iterator_type<U> &   IntrusiveDoublyLinkedList<T, TAG>::Iterator_type<U>::operator++()
+  {
+    if( _hookPtr == nullptr )   throw std::invalid_argument( exceptionString( "Attempt to increment null iterator" ) );
+
+    _hookPtr = _hookPtr->_next;
+    return *this;
+  }
+
+
+
+  // operator++   post-increment
+  template<typename T, typename TAG>   template<typename U>
+  typename IntrusiveDoublyLinkedList<T, TAG>::template Iterator_type<U>   IntrusiveDoublyLinkedList<T, TAG>::Iterator_type<U>::operator++( int )
+  {
+    auto temp{ *this };
+    operator++();                                                                     // Delegate to pre-increment leveraging error checking
+    return temp;
+  }
+
+
+
+  // operator--   pre-decrement
+  template<typename T, typename TAG>   template<typename U>
+  typename IntrusiveDoublyLinkedList<T, TAG>::template Iterator_type<U> &   IntrusiveDoublyLinkedList<T, TAG>::Iterator_type<U>::operator--()
+  {
+    if( _hookPtr == nullptr )   throw std::invalid_argument( exceptionString( "Attempt to decrement null iterator" ) );
+
+    _hookPtr = _hookPtr->_prev;
+    return *this;
+  }
+
+
+
+  // operator--   post-decrement
+  template<typename T, typename TAG>   template<typename U>
+  typename IntrusiveDoublyLinkedList<T, TAG>::template Iterator_type<U>   IntrusiveDoublyLinkedList<T, TAG>::Iterator_type<U>::operator--( int )
+  {
+    auto temp{ *this };
+    operator--();                                                                     // Delegate to pre-decrement leveraging error checking
+    return temp;
+  }
+
+
+
+  // operator*
+  template<typename T, typename TAG>   template<typename U>
+  typename IntrusiveDoublyLinkedList<T, TAG>::template Iterator_type<U>::reference   IntrusiveDoublyLinkedList<T, TAG>::Iterator_type<U>::operator*() const
+  {
+    if( _hookPtr == nullptr )   throw std::invalid_argument( exceptionString( "Attempt to dereference null iterator" ) );
+
+    return static_cast<T &>( *_hookPtr );                                             // base-to-derived conversion, the hook is embedded in a T
+  }
+
+
+
+  // operator->
+  template<typename T, typename TAG>   template<typename U>
+  typename IntrusiveDoublyLinkedList<T, TAG>::template Iterator_type<U>::pointer   IntrusiveDoublyLinkedList<T, TAG>::Iterator_type<U>::operator->() const
+  { return &operator*(); }
+
+
+
+  // operator==
+  template<typename T, typename TAG>   template<typename U>
+  bool IntrusiveDoublyLinkedList<T, TAG>::Iterator_type<U>::operator==( Iterator_type const & rhs ) const
+  { return _hookPtr == rhs._hookPtr; }
+}    // namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+** (C) Copyright 2025 by Thomas Bettens. All Rights Reserved.
+**
+** DISCLAIMER: The participating authors at California State University's Computer Science Department have used their best efforts
+** in preparing this code. These efforts include the development, research, and testing of the theories and programs to determine
+** their effectiveness. The authors make no warranty of any kind, expressed or implied, with regard to these programs or to the
+** documentation contained within. The authors shall not be liable in any event for incidental or consequential damages in
+** connection with, or arising out of, the furnishing, performance, or use of these libraries and programs.  Distribution without
+** written consent from the authors is prohibited.
+***********************************************************************************************************************************/
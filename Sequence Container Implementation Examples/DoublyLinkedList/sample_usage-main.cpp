@@ -1,6 +1,97 @@
 import std;
 import CSUF.CPSC131.Student;
 import CSUF.CPSC131.DoublyLinkedList;
+import CSUF.CPSC131.IntrusiveDoublyLinkedList;
+
+namespace  // unnamed, anonymous namespace
+{
+  // An intrusive list links objects that already live elsewhere.  Each Job embeds one hook per list it can be on
+  struct ByArrival;                                                                     // Hook tags, never defined
+  struct ByUrgency;
+
+  struct Job : CSUF::CPSC131::DllHook<ByArrival>, CSUF::CPSC131::DllHook<ByUrgency>
+  {
+    CSUF::CPSC131::Student owner;
+    bool                   urgent = false;
+  };
+
+
+
+  void runIntrusiveDriver()
+  {
+    using CSUF::CPSC131::Student;
+    using CSUF::CPSC131::IntrusiveDoublyLinkedList;
+
+    // The jobs are owned by the array, the lists only thread them together.  Nothing below allocates, copies, or moves a Job
+    std::array<Job, 6> jobs;
+    for( std::size_t i = 0;  i < jobs.size();  ++i )
+    {
+      jobs[i].owner  = Student( std::format( "Owner_{:02}", i ) );
+      jobs[i].urgent = i % 2 == 0;
+    }
+
+    IntrusiveDoublyLinkedList<Job, ByArrival> arrivalOrder;
+    IntrusiveDoublyLinkedList<Job, ByUrgency> urgencyOrder;
+
+    for( auto & job : jobs )
+    {
+      arrivalOrder.push_back( job );
+      if( job.urgent )   urgencyOrder.push_front( job );
+      else               urgencyOrder.push_back ( job );
+    }
+
+    auto show = [&]( std::string_view when )
+    {
+      std::print( std::cout, "{}:\n  arrival order:          ", when );
+      for( auto const & job : arrivalOrder )                                     std::print( std::cout, "{}, ", job.owner );
+      std::print( std::cout, "\n  urgency order reversed: " );
+      for( auto job = urgencyOrder.crbegin();  job != urgencyOrder.crend();  ++job )   std::print( std::cout, "{}, ", job->owner );
+      std::print( std::cout, "\n\n" );
+    };
+
+    std::print( std::cout, "\n\nIntrusive lists linking the same objects\n" );
+    show( "After linking" );
+
+    // O(1) removal given just the object - no search, no iterator
+    arrivalOrder.erase( jobs[3] );
+    urgencyOrder.erase( jobs[3] );
+    show( "After removing Owner_03 from both lists" );
+
+    // Move a job to the front of one list without disturbing its place on the other
+    urgencyOrder.erase( jobs[5] );
+    urgencyOrder.push_front( jobs[5] );
+    show( "After moving Owner_05 to the front of the urgency list" );
+  }
+
+
+
+  void runArenaDriver()
+  {
+    using CSUF::CPSC131::DoublyLinkedList;
+    using CSUF::CPSC131::DllPolicy;
+
+    // All of an arena list's nodes share one array and link to each other by 32-bit index
+    DoublyLinkedList<int, DllPolicy::ARENA> numbers;
+    for( int i = 0;  i < 10;  ++i )
+    {
+      if( i % 2 == 0 )   numbers.push_back ( i );
+      else               numbers.push_front( i );
+    }
+
+    // Erased nodes' slots go on a free list and are reused by the next inserts
+    for( auto i = numbers.begin();  i != numbers.end();  )   i = ( *i % 3 == 0 )  ?  numbers.erase( i )  :  std::next( i );
+    numbers.push_back( 100 );
+
+    // Renumber the nodes so list order and arena order are the same, then copy the whole list with one block copy
+    numbers.compact();
+    DoublyLinkedList<int, DllPolicy::ARENA> copy( numbers );
+
+    std::print( std::cout, "Arena backed list:\n"
+                           "  forward:  {}\n"
+                           "  backward: {}\n\n",
+                           copy, copy | std::views::reverse );
+  }
+}    // anonymous namespace
 
 
 
@@ -71,6 +162,14 @@ int main()
       students.pop_back();
     }
     std::print( std::cout, "\n\n" );
+
+
+    // Example intrusive lists
+    runIntrusiveDriver();
+
+
+    // Example arena backed list
+    runArenaDriver();
   }
 
   catch( std::exception & ex )
@@ -89,3 +188,10 @@ template class CSUF::CPSC131::DoublyLinkedList<std::string,            CSUF::CPS
 template class CSUF::CPSC131::DoublyLinkedList<CSUF::CPSC131::Student, CSUF::CPSC131::DllPolicy::NTL>;
 template class CSUF::CPSC131::DoublyLinkedList<int,                    CSUF::CPSC131::DllPolicy::NTL>;
 template class CSUF::CPSC131::DoublyLinkedList<std::string,            CSUF::CPSC131::DllPolicy::NTL>;
+
+template class CSUF::CPSC131::DoublyLinkedList<CSUF::CPSC131::Student, CSUF::CPSC131::DllPolicy::ARENA>;
+template class CSUF::CPSC131::DoublyLinkedList<int,                    CSUF::CPSC131::DllPolicy::ARENA>;
+template class CSUF::CPSC131::DoublyLinkedList<std::string,            CSUF::CPSC131::DllPolicy::ARENA>;
+
+template class CSUF::CPSC131::IntrusiveDoublyLinkedList<Job, ByArrival>;
+template class CSUF::CPSC131::IntrusiveDoublyLinkedList<Job, ByUrgency>;
@@ -0,0 +1,388 @@
+/***********************************************************************************************************************************
+** Node pools (slab allocation) for linked structures
+**
+**  A linked list that asks the general purpose allocator for every node it creates, and hands every node back as it's removed,
+**  spends much of its time inside new and delete.  Worse, nodes allocated one at a time end up wherever the allocator finds
+**  room, so walking the list hops all over memory.
+**
+**  A NodePool instead gets memory from the allocator in large blocks (slabs) aligned to a cache line, carves each block into
+**  equal sized node slots, and keeps the slots not holding a node on a free list threaded through the slots themselves.  Taking
+**  and returning a slot is then just a couple of pointer assignments, nodes created together sit next to each other in memory,
+**  and once a list has grown to its working size, pushing and popping never calls the allocator again.  The most recently
+**  released slot is reused first since it's the one most likely still in cache.
+**
+**      block:  +--------+--------+--------+--------+--------+--------+--------+--------+
+**              | node A |  free  | node B | node C |  free  |  free  | node D |  free  |       (one or more cache lines)
+**              +--------+--------+--------+--------+--------+--------+--------+--------+
+**                          ^  |                        ^  |     ^  |              ^  |
+**      _free --------------+  +------------------------+  +-----+  +--------------+  +--> nullptr
+**
+**  Blocks are kept until the pool is destroyed or shrink() is called, which returns to the allocator every block with no slot in
+**  use.  A pool is not thread safe, containers sharing one pool must all be used from the same thread.  One pool can also take over
+**  all of another's blocks with merge(), after which the nodes the other pool made belong to it, so a container can relink nodes
+**  it did not create without copying them.  Both pools must have blocks of the same size.
+**
+**  Usage:
+**     CSUF::CPSC131::NodePool<sizeof(Node), alignof(Node)> pool;
+**     Node * node = pool.make<Node>( value );                           // Constructs a Node in a pooled slot
+**     pool.destroy( node );                                             // Destroys the Node, its slot goes back on the free list
+**     pool.shrink();                                                    // Gives the completely unused blocks back
+**     pool.merge( other );                                              // Takes over other's blocks, and the nodes in them
+***********************************************************************************************************************************/
+module;                                                                               // Global fragment (not part of the module)
+  // Empty
+
+
+
+
+/***********************************************************************************************************************************
+**  Module CSUF.CPSC131.NodePool Interface
+**
+***********************************************************************************************************************************/
+export module CSUF.CPSC131.NodePool;                                                 // Primary Module Interface Definition
+import std;
+import CSUF.CPSC131.exceptionString;
+
+
+export namespace CSUF::CPSC131
+{
+  // Pools objects up to SLOT_SIZE bytes with alignment up to SLOT_ALIGNMENT
+  template<std::size_t SLOT_SIZE, std::size_t SLOT_ALIGNMENT = alignof( std::max_align_t )>
+  class NodePool
+  {
+    public:
+      static constexpr std::size_t CACHE_LINE_SIZE = 64;                  // Typical, and what std::hardware_destructive_interference_size is on most platforms
+
+      // A snapshot of the pool's bookkeeping
+      struct Statistics
+      {
+        std::size_t blocks           = 0;                                 // Blocks currently held
+        std::size_t capacity         = 0;                                 // Slots in those blocks
+        std::size_t inUse            = 0;                                 // Slots currently holding a node
+        std::size_t available        = 0;                                 // Slots on the free list, capacity - inUse
+        std::size_t allocatorCalls   = 0;                                 // Blocks obtained from the allocator over the pool's lifetime
+        std::size_t allocatorReturns = 0;                                 // Blocks given back to the allocator over the pool's lifetime
+      };
+
+      // Constructors, destructor, and assignments
+      explicit NodePool     ( std::size_t slotsPerBlock = 0 );            // Zero means as many as fit in DEFAULT_BLOCK_SIZE bytes.  Nothing is allocated until needed
+      NodePool              ( NodePool const & ) = delete;                // Slots given out belong to exactly one pool
+      NodePool & operator=  ( NodePool const & ) = delete;
+     ~NodePool              (                  ) noexcept;                // Every node must have been destroyed already
+
+      // Node lifetime
+      template<typename Node, typename... Args>
+      Node * make   ( Args &&... args );                                  // Constructs a Node in a free slot, obtaining a new block first if none are free
+      template<typename Node>
+      void   destroy( Node * node ) noexcept;                             // Destroys the node and puts its slot on the free list.  Null is ignored
+
+      // Raw slots
+      void * allocate  (              );                                  // Returns uninitialized memory for one object
+      void   deallocate( void * slot  ) noexcept;                         // slot must have come from this pool's allocate() and no longer hold an object
+
+      // Queries
+      Statistics  statistics   () const noexcept;
+      std::size_t slotsPerBlock() const noexcept { return _slotsPerBlock; }
+
+      // Modifiers
+      std::size_t shrink();                                               // Returns completely unused blocks to the allocator, returns how many blocks were released
+      void        merge ( NodePool & other );                             // Takes all of other's blocks, leaving other empty.  Throws std::invalid_argument unless both have the same slotsPerBlock()
+
+    private:
+      struct FreeSlot { FreeSlot * _next = nullptr; };                    // What a slot holds while it's on the free list
+
+      static constexpr std::size_t DEFAULT_BLOCK_SIZE = 4'096;            // A typical page
+      static constexpr std::size_t SLOT_ALIGN         = std::max( SLOT_ALIGNMENT, alignof( FreeSlot ) );
+      static constexpr std::size_t SLOT_STRIDE        = ( std::max( SLOT_SIZE, sizeof( FreeSlot ) ) + SLOT_ALIGN - 1 ) / SLOT_ALIGN * SLOT_ALIGN;
+      static constexpr std::size_t BLOCK_ALIGN        = std::max( CACHE_LINE_SIZE, SLOT_ALIGN );
+
+      std::size_t blockSize() const noexcept;                             // Bytes per block, rounded up to whole cache lines
+      void        grow     ();                                            // Obtains one more block and puts all of its slots on the free list
+      void        release  ( std::byte * block ) noexcept;                // Gives one block back to the allocator
+
+      std::vector<std::byte *> _blocks;
+      FreeSlot *               _free             = nullptr;               // Top of the free list
+      std::size_t              _slotsPerBlock    = 0;
+      std::size_t              _inUse            = 0;
+      std::size_t              _allocatorCalls   = 0;
+      std::size_t              _allocatorReturns = 0;
+  };
+}    // export namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// Not exported but reachable
+/***********************************************************************************************************************************
+************************************************************************************************************************************
+** Template Implementation
+************************************************************************************************************************************
+***********************************************************************************************************************************/
+namespace CSUF::CPSC131
+{
+  // Construction
+  template<std::size_t SLOT_SIZE, std::size_t SLOT_ALIGNMENT>
+  NodePool<SLOT_SIZE, SLOT_ALIGNMENT>::NodePool( std::size_t slotsPerBlock )
+    : _slotsPerBlock{ slotsPerBlock > 0  ?  slotsPerBlock  :  std::max<std::size_t>( 1, DEFAULT_BLOCK_SIZE / SLOT_STRIDE ) }
+  {}
+
+
+
+
+  // Destruction
+  template<std::size_t SLOT_SIZE, std::size_t SLOT_ALIGNMENT>
+  NodePool<SLOT_SIZE, SLOT_ALIGNMENT>::~NodePool() noexcept
+  {
+    // Any node still in a slot is simply abandoned - its destructor is never called.  The containers using this pool clear
+    // themselves before letting go of it.
+    for( auto block : _blocks )   release( block );
+  }
+
+
+
+
+  // make()
+  template<std::size_t SLOT_SIZE, std::size_t SLOT_ALIGNMENT>
+  template<typename Node, typename... Args>
+  Node * NodePool<SLOT_SIZE, SLOT_ALIGNMENT>::make( Args &&... args )
+  {
+    static_assert( sizeof ( Node ) <= SLOT_SIZE,      "Node does not fit in this pool's slots"        );
+    static_assert( alignof( Node ) <= SLOT_ALIGNMENT, "Node is more strictly aligned than this pool's slots" );
+
+    void * slot = allocate();
+    try
+    {
+      return std::construct_at( static_cast<Node *>( slot ), std::forward<Args>( args )... );
+    }
+    catch( ... )
+    {
+      deallocate( slot );                                                 // Node's constructor threw, the slot is still free
+      throw;
+    }
+  }
+
+
+
+
+  // destroy()
+  template<std::size_t SLOT_SIZE, std::size_t SLOT_ALIGNMENT>
+  template<typename Node>
+  void NodePool<SLOT_SIZE, SLOT_ALIGNMENT>::destroy( Node * node ) noexcept
+  {
+    if( node == nullptr )   return;
+    std::destroy_at( node );
+    deallocate( node );
+  }
+
+
+
+
+  // allocate()
+  template<std::size_t SLOT_SIZE, std::size_t SLOT_ALIGNMENT>
+  void * NodePool<SLOT_SIZE, SLOT_ALIGNMENT>::allocate()
+  {
+    if( _free == nullptr )   grow();                                      // The only time the allocator is called
+
+    FreeSlot * slot = _free;
+    _free = slot->_next;                                                  // Pop the slot off the free list
+    std::destroy_at( slot );
+    ++_inUse;
+    return slot;
+  }
+
+
+
+
+  // deallocate()
+  template<std::size_t SLOT_SIZE, std::size_t SLOT_ALIGNMENT>
+  void NodePool<SLOT_SIZE, SLOT_ALIGNMENT>::deallocate( void * slot ) noexcept
+  {
+    _free = std::construct_at( static_cast<FreeSlot *>( slot ), _free );  // Push the slot on the free list, it's the first to be reused
+    --_inUse;
+  }
+
+
+
+
+  // statistics()
+  template<std::size_t SLOT_SIZE, std::size_t SLOT_ALIGNMENT>
+  auto NodePool<SLOT_SIZE, SLOT_ALIGNMENT>::statistics() const noexcept -> Statistics
+  {
+    std::size_t const capacity = _blocks.size() * _slotsPerBlock;
+    return { .blocks           = _blocks.size(),
+             .capacity         = capacity,
+             .inUse            = _inUse,
+             .available        = capacity - _inUse,
+             .allocatorCalls   = _allocatorCalls,
+             .allocatorReturns = _allocatorReturns };
+  }
+
+
+
+
+  // shrink()
+  template<std::size_t SLOT_SIZE, std::size_t SLOT_ALIGNMENT>
+  std::size_t NodePool<SLOT_SIZE, SLOT_ALIGNMENT>::shrink()
+  {
+    std::size_t const blockCount = _blocks.size();
+
+    // Nothing in use?  Then every block goes
+    if( _inUse == 0 )
+    {
+      for( auto block : _blocks )   release( block );
+      _blocks.clear();
+      _free = nullptr;
+      return blockCount;
+    }
+
+    // Otherwise count the free slots in each block.  A block whose every slot is free can go.  Sorting the blocks by address lets
+    // the block holding a slot be found with a binary search.  (std::less gives a total order even across separate allocations.)
+    std::ranges::sort( _blocks, std::less<>{} );
+
+    auto blockOf = [&]( FreeSlot * slot ) -> std::size_t
+    {
+      auto next = std::ranges::upper_bound( _blocks, reinterpret_cast<std::byte *>( slot ), std::less<>{} );
+      return static_cast<std::size_t>( next - _blocks.begin() ) - 1;
+    };
+
+    std::vector<std::size_t> freeSlots( blockCount, 0 );
+    for( FreeSlot * slot = _free;  slot != nullptr;  slot = slot->_next )   ++freeSlots[ blockOf( slot ) ];
+
+    // Unlink the doomed blocks' slots from the free list, keeping the rest in their current (most recently released first) order
+    FreeSlot ** link = &_free;
+    while( *link != nullptr )
+    {
+      if( freeSlots[ blockOf( *link ) ] == _slotsPerBlock )   *link = ( *link )->_next;
+      else                                                     link = &( *link )->_next;
+    }
+
+    // Release them
+    std::size_t kept = 0;
+    for( std::size_t i = 0;  i < blockCount;  ++i )
+    {
+      if( freeSlots[i] == _slotsPerBlock )   release( _blocks[i] );
+      else                                   _blocks[kept++] = _blocks[i];
+    }
+    _blocks.resize( kept );
+
+    return blockCount - kept;
+  }
+
+
+
+
+  // merge()
+  template<std::size_t SLOT_SIZE, std::size_t SLOT_ALIGNMENT>
+  void NodePool<SLOT_SIZE, SLOT_ALIGNMENT>::merge( NodePool & other )
+  {
+    if( &other == this )   return;
+
+    // Blocks are given back to the allocator with the size this pool asked for, so both pools' blocks must be the same size
+    if( other._slotsPerBlock != _slotsPerBlock )   throw std::invalid_argument( exceptionString( std::format( "Failure:  Attempted to merge node pools of different block sizes\n"
+                                                                                                                  "   Slots per block:        {}\n"
+                                                                                                                  "   Other slots per block:  {}",
+                                                                                                                  _slotsPerBlock, other._slotsPerBlock ) ) );
+
+    _blocks.reserve( _blocks.size() + other._blocks.size() );             // The only thing that can throw, and nothing has changed yet
+    _blocks.insert ( _blocks.end(), other._blocks.begin(), other._blocks.end() );
+
+    // Other's free slots go on top of this pool's
+    if( other._free != nullptr )
+    {
+      FreeSlot * last = other._free;
+      while( last->_next != nullptr )   last = last->_next;
+      last->_next = _free;
+      _free       = other._free;
+    }
+
+    _inUse            += other._inUse;
+    _allocatorCalls   += other._allocatorCalls;
+    _allocatorReturns += other._allocatorReturns;
+
+    other._blocks.clear();
+    other._free             = nullptr;
+    other._inUse            = 0;
+    other._allocatorCalls   = 0;
+    other._allocatorReturns = 0;
+  }
+
+
+
+
+  // blockSize()
+  template<std::size_t SLOT_SIZE, std::size_t SLOT_ALIGNMENT>
+  std::size_t NodePool<SLOT_SIZE, SLOT_ALIGNMENT>::blockSize() const noexcept
+  { return ( _slotsPerBlock * SLOT_STRIDE + CACHE_LINE_SIZE - 1 ) / CACHE_LINE_SIZE * CACHE_LINE_SIZE; }
+
+
+
+
+  // grow()
+  template<std::size_t SLOT_SIZE, std::size_t SLOT_ALIGNMENT>
+  void NodePool<SLOT_SIZE, SLOT_ALIGNMENT>::grow()
+  {
+    _blocks.reserve( _blocks.size() + 1 );                                // So push_back below can't throw and leak the block
+
+    auto block = static_cast<std::byte *>( ::operator new( blockSize(), std::align_val_t{ BLOCK_ALIGN } ) );
+    _blocks.push_back( block );
+    ++_allocatorCalls;
+
+    // Thread the block's slots onto the free list back to front so they're handed out front to back, i.e., in address order
+    for( std::size_t i = _slotsPerBlock;  i > 0;  --i )   _free = std::construct_at( reinterpret_cast<FreeSlot *>( block + ( i - 1 ) * SLOT_STRIDE ), _free );
+  }
+
+
+
+
+  // release()
+  template<std::size_t SLOT_SIZE, std::size_t SLOT_ALIGNMENT>
+  void NodePool<SLOT_SIZE, SLOT_ALIGNMENT>::release( std::byte * block ) noexcept
+  {
+    ::operator delete( block, blockSize(), std::align_val_t{ BLOCK_ALIGN } );
+    ++_allocatorReturns;
+  }
+}    // namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+** (C) Copyright 2025 by Thomas Bettens. All Rights Reserved.
+**
+** DISCLAIMER: The participating authors at California State University's Computer Science Department have used their best efforts
+** in preparing this code. These efforts include the development, research, and testing of the theories and programs to determine
+** their effectiveness. The authors make no warranty of any kind, expressed or implied, with regard to these programs or to the
+** documentation contained within. The authors shall not be liable in any event for incidental or consequential damages in
+** connection with, or arising out of, the furnishing, performance, or use of these libraries and programs.  Distribution without
+** written consent from the authors is prohibited.
+***********************************************************************************************************************************/
+
+/**************************************************
+** Last modified:  27-JUL-2025 (Converted to C++ Modules)
+** Last Verified:  27-JUL-2025
+** Verified with:  MS Visual Studio 2022 Version 17.14.9,  Compiler Version 19.44.35213 (/std:c++latest)
+**                 GCC version 15.1.0 (-std=c++23 )
+**                 Clang version 21.0.0 (-std=c++23 -stdlib=libc++)
+***************************************************/
@@ -8,6 +8,11 @@
 **     the back of the list in constant time O(1) that std::forward_list cannot.
 **  2) This example maintains the size of the list, std::forward_list does not.  SinglyLinkedList::size() is a constant O(1)
 **     operation, and std::forward_list has no size() operation.
+**
+**  Nodes are not individually allocated with new and deleted with delete.  Each list takes its nodes from a node pool (see
+**  NodePool.cppm) that gets memory from the allocator a block of nodes at a time and recycles removed nodes, so once a list has
+**  grown to its working size pushing and popping never calls the allocator.  Lists may share a pool, and lists of the same size
+**  elements can share a pool even if their policies differ.
 ***********************************************************************************************************************************/
 module;                                                                               // Global fragment (not part of the module)
   // Empty
@@ -27,12 +32,19 @@ module;
 export module CSUF.CPSC131.SinglyLinkedList;
 import std;
 import CSUF.CPSC131.exceptionString;
+import CSUF.CPSC131.NodePool;
 
 
 
 namespace CSUF::CPSC131
 {
-  export enum class SllPolicy {CIRCULAR, NTL};
+  export enum class SllPolicy {CIRCULAR, NTL, UNROLLED};
+
+  // The number of elements in each node of an UNROLLED list.  By default, as many as fit in a cache line next to the node's next
+  // pointer and bookkeeping, but at least 4.  Specialize to choose a different number, for example
+  //     template<> inline constexpr std::size_t CSUF::CPSC131::unrolledNodeCapacity<Student> = 8;
+  export template<typename T>
+  inline constexpr std::size_t unrolledNodeCapacity = std::max<std::size_t>( 4, ( 64 - sizeof( void * ) - 2 * sizeof( std::uint32_t ) ) / sizeof( T ) );
 
   template<typename, SllPolicy> struct Members;                                       // intentionally not exported
 
@@ -50,6 +62,8 @@ namespace CSUF::CPSC131
       using Node              = Members<T, POLICY>::Node;                             // Specific implementations are responsible for defining their node structure
       using PrivateAttributes = Members<T, POLICY>;                                   // A specific implementation's private members (attributes, functions, etc)
 
+      static constexpr bool ONE_ELEMENT_PER_NODE = POLICY != SllPolicy::UNROLLED;     // An unrolled list's nodes hold several elements
+
       // Member instance attributes
       std::unique_ptr<PrivateAttributes> self = nullptr;                              // See Pimpl Idiom at https://cpppatterns.com/patterns/pimpl.html
 
@@ -59,6 +73,7 @@ namespace CSUF::CPSC131
       // Types
       using iterator       = Iterator_type<T      >;                                  // A forward iterator to a read-write value in the list
       using const_iterator = Iterator_type<T const>;                                  // A forward iterator to a read-only value in the list
+      using node_pool      = Members<T, POLICY>::Pool;                                // Where the list's nodes come from
 
 
 
@@ -67,6 +82,7 @@ namespace CSUF::CPSC131
       SinglyLinkedList            ( SinglyLinkedList const    & original  );          // copy constructor
       SinglyLinkedList            ( SinglyLinkedList         && original  ) noexcept; // move constructor
       SinglyLinkedList            ( std::initializer_list<T>    init_list );          // initialization list constructor
+      explicit SinglyLinkedList   ( std::shared_ptr<node_pool>  pool      );          // empty list taking its nodes from a (possibly shared) pool
       SinglyLinkedList & operator=( SinglyLinkedList const    & rhs       );          // copy assignment
       SinglyLinkedList & operator=( SinglyLinkedList         && rhs       ) noexcept; // move assignment
      ~SinglyLinkedList            (                                       ) noexcept; // destructor
@@ -76,6 +92,7 @@ namespace CSUF::CPSC131
       // Queries
       bool        empty() const noexcept;                                             // returns true if list has no items
       std::size_t size () const noexcept;                                             // returns the number of elements in the list
+      std::shared_ptr<node_pool> pool() const noexcept;                               // returns the pool the list's nodes come from, e.g., to see its statistics() or share it
 
 
 
@@ -108,18 +125,62 @@ namespace CSUF::CPSC131
       void push_back ( T const & value );                                             // add an element containing "value" to back of list
       void pop_front (                 );                                             // remove element at front of list
       void pop_back  (                 ) = delete;                                    // intentionally not provided - cannot remove a node after the last one
+      void shrink_to_fit(              );                                             // return the node pool's unused blocks to the allocator
 
       iterator insert_after( const_iterator position, T const & value );              // Inserts an element containing "value" into list after the one occupied at position and returns an iterator to the newly inserted value
       iterator erase_after ( const_iterator position                  );              // Removes from list the element after the one occupied at position and returns an iterator to the element after the one removed
 
 
 
+      // Operations
+      //   These relink existing nodes, they never allocate memory nor copy, move, or swap elements.  Iterators to the elements
+      //   remain valid, even those moved into another list.  Nodes can only be relinked between lists sharing a node pool, so two
+      //   lists with pools of their own (e.g., both default constructed) first fold one pool into the other and share it from then
+      //   on.  Only when neither pool can be given up, each being shared with yet other lists, are the elements moved into newly
+      //   created nodes instead.  Not available for unrolled lists, whose nodes hold several elements.
+      void splice_after( const_iterator position, SinglyLinkedList & other                                          ) requires ONE_ELEMENT_PER_NODE; // Moves all of other's elements into this list after position, O(1)
+      void splice_after( const_iterator position, SinglyLinkedList & other, const_iterator it                       ) requires ONE_ELEMENT_PER_NODE; // Moves other's element after it into this list after position, O(1)
+      void splice_after( const_iterator position, SinglyLinkedList & other, const_iterator first, const_iterator last ) requires ONE_ELEMENT_PER_NODE; // Moves other's elements in the open range (first, last) into this list after position, O(last - first)
+
+      void merge( SinglyLinkedList & other )                 requires ONE_ELEMENT_PER_NODE;  // Merges other into this list, both sorted in ascending order, leaving other empty.  Stable, O(n+m)
+      template<typename Compare>
+      void merge( SinglyLinkedList & other, Compare less )   requires ONE_ELEMENT_PER_NODE;  // As above, where both are sorted by less
+
+      void sort()                                            requires ONE_ELEMENT_PER_NODE;  // Sorts the list in ascending order with an iterative, bottom-up merge sort.  Stable, O(n log n)
+      template<typename Compare>
+      void sort( Compare less )                              requires ONE_ELEMENT_PER_NODE;  // As above, ordered by less
+
+      std::size_t unique()                                   requires ONE_ELEMENT_PER_NODE;  // Removes all but the first element from every group of consecutive equal elements, returns the number removed
+      template<typename BinaryPredicate>
+      std::size_t unique( BinaryPredicate equal )            requires ONE_ELEMENT_PER_NODE;  // As above, where elements are equal if equal( first, element ) is true
+
+      std::size_t remove( T const & value )                  requires ONE_ELEMENT_PER_NODE;  // Removes all elements equal to value, returns the number removed
+      template<typename Predicate>
+      std::size_t remove_if( Predicate predicate )           requires ONE_ELEMENT_PER_NODE;  // Removes all elements for which predicate( element ) is true, returns the number removed
+
+
+
       // Relational Operators
       std::weak_ordering operator<=>( SinglyLinkedList const & rhs ) const;
       bool               operator== ( SinglyLinkedList const & rhs ) const;
 
 
 
+    private:
+      // Relinking helper functions.  A "chain" is a null-terminated sequence of nodes not (or no longer) part of any list.
+      Node *& nextOf      ( Node * position                  )          requires ONE_ELEMENT_PER_NODE;  // The link to the node after position.  The link after before_begin() is the head
+      Node *  detach      (                                  )          requires ONE_ELEMENT_PER_NODE;  // Takes every node out of the list, leaving it empty, and returns them as a chain
+      void    attach      ( Node * chain, std::size_t count  )          requires ONE_ELEMENT_PER_NODE;  // Makes the chain of count nodes the contents of this (empty) list
+      void    destroyChain( Node * chain                     ) noexcept requires ONE_ELEMENT_PER_NODE;  // Destroys the chain's nodes, returning them to the pool
+      bool    sharePool   ( SinglyLinkedList & other         )          requires ONE_ELEMENT_PER_NODE;  // Makes both lists take their nodes from the same pool if possible, returns true if they do
+
+      static Node * concatenate( Node * front, Node * back   )          requires ONE_ELEMENT_PER_NODE;  // Appends chain back to chain front, returns the combined chain
+
+      template<typename Compare>
+      static Node * mergeChains( Node *& a, Node *& b, Compare & less ) requires ONE_ELEMENT_PER_NODE;  // Merges two sorted chains, returns the merged chain
+
+
+
 
 
 
@@ -127,14 +188,15 @@ namespace CSUF::CPSC131
     ** Extended the Linked List Implementation Example with some examples of operations solved recursively.
     **
     ** These are not in a typical Singly Linked List interface, but included here for educational discussion.  These types of
-    ** exercises are often found in homework or exams.
+    ** exercises are often found in homework or exams.  They walk the list one node, and so one element, at a time and are not
+    ** available for unrolled lists.
     *******************************************************************************************************************************/
     public:
       // Add a function, named "reverse", to the Singly Linked List that reverses the list without copying the list or moving data
       // in the list. Implement the function recursively.  The function must be implemented recursively.
       //
       // Client visible interface (the public function)
-      void reverse();
+      void reverse() requires ONE_ELEMENT_PER_NODE;
 
 
 
@@ -143,7 +205,7 @@ namespace CSUF::CPSC131
       // defined
       //
       // Client visible interface (the public function)
-      iterator find( T const & value );
+      iterator find( T const & value ) requires ONE_ELEMENT_PER_NODE;
 
 
 
@@ -151,29 +213,29 @@ namespace CSUF::CPSC131
       // recursively. Assume operator+(lhs, rhs) is defined
       //
       // Client visible interface (the public function)
-      T add() const;
+      T add() const requires ONE_ELEMENT_PER_NODE;
 
 
 
       // Add a function, named "forwardPrint", to the Singly Linked List that writes the elements to standard output from front to
       // back. The function must be implemented recursively. Assume operator+(lhs, rhs) is defined
-      void forwardPrint( std::ostream & stream = std::cout ) const;
+      void forwardPrint( std::ostream & stream = std::cout ) const requires ONE_ELEMENT_PER_NODE;
 
 
 
       // Add a function, named "backwardPrint", to the Singly Linked List that writes the elements to standard output from back to
       // front. The function must be implemented recursively. Assume operator+(lhs, rhs) is defined
-      void backwardPrint( std::ostream & stream = std::cout ) const;
+      void backwardPrint( std::ostream & stream = std::cout ) const requires ONE_ELEMENT_PER_NODE;
 
 
 
     private:
       // Extended interface helper functions to demonstrate recursion
-      void     reverse      ( Node * current                        );
-      iterator find         ( Node * current, const T & value       );
-      T        add          ( Node * current                        ) const;
-      void     forwardPrint ( Node * current, std::ostream & stream ) const;
-      void     backwardPrint( Node * current, std::ostream & stream ) const;
+      void     reverse      ( Node * current                        )       requires ONE_ELEMENT_PER_NODE;
+      iterator find         ( Node * current, const T & value       )       requires ONE_ELEMENT_PER_NODE;
+      T        add          ( Node * current                        ) const requires ONE_ELEMENT_PER_NODE;
+      void     forwardPrint ( Node * current, std::ostream & stream ) const requires ONE_ELEMENT_PER_NODE;
+      void     backwardPrint( Node * current, std::ostream & stream ) const requires ONE_ELEMENT_PER_NODE;
   };  // class SinglyLinkedList
 
 
@@ -228,10 +290,12 @@ namespace CSUF::CPSC131
 
     private:
       // Member attributes
-      Node * _nodePtr = nullptr;
+      Node *      _nodePtr = nullptr;
+      std::size_t _index   = 0;                                                       // Unrolled lists only:  which of the node's slots.  Always zero otherwise
 
       // Helper functions
       Iterator_type( Node * position );                                               // Implicit conversion constructor from pointer-to-Node to iterator-to-Node
+      Iterator_type( Node * position, std::size_t index );                            // Unrolled lists only:  an iterator to the element in slot index of node position
   };  // SinglyLinkedList<T, POLICY>::Iterator_type
 
 }    // namespace CSUF::CPSC131
@@ -262,6 +326,7 @@ namespace CSUF::CPSC131
 // Organization:
 //  o)  Circular Singly Linked List With One Dummy Node Specific
 //  o)  Null-Terminated Singly Linked List With One Dummy Node Specific
+//  o)  Unrolled Singly Linked List Specific
 //  0)  Common across all Singly Linked Lists
 
 
@@ -322,6 +387,8 @@ namespace CSUF::CPSC131
       Node * _next = this;                                                            // next item in the list
     };
 
+    using Pool = NodePool<sizeof( Node ), alignof( Node )>;
+
 
 
     // Member instance attributes
@@ -330,6 +397,7 @@ namespace CSUF::CPSC131
     Node *&     _head = _sentinel._next;                                              // _head is just another name for _sentinel._next.  The head of the list is always at this location
     Node *      _tail = &_sentinel;                                                   // last element in the list.  tail->next always points to _sentinel
     std::size_t _size = 0;                                                            // number of elements in the collection
+    std::shared_ptr<Pool> _pool;                                                      // where nodes come from and go back to.  The sentinel is not pooled
 
 
 
@@ -351,9 +419,9 @@ namespace CSUF::CPSC131
 
 
     // insert_after()
-    Node * insert_after( Node * currentNode, T const & data )
+    Node * insert_after( Node * currentNode, T data )
     {
-      Node * newNode     = new Node( data );                                            // Create and populate a new node with the provided data
+      Node * newNode     = _pool->template make<Node>( std::move( data ) );             // Create and populate a new node with the provided data
 
       // Relink the node into position
       newNode    ->_next = currentNode->_next;                                          // the new node and the current node point to the same next node
@@ -385,7 +453,7 @@ namespace CSUF::CPSC131
 
       if( toBeRemoved == _tail )    _tail = currentNode;                                // adjust tail to point to the new back node in the list
 
-      delete toBeRemoved;                                                               // delete what used to be the old node
+      _pool->destroy( toBeRemoved );                                                    // destroy what used to be the old node, recycling its memory
       return currentNode->_next;
     }
 
@@ -450,6 +518,8 @@ namespace CSUF::CPSC131
       Node * _next = nullptr;                                                // next item in the list
     };
 
+    using Pool = NodePool<sizeof( Node ), alignof( Node )>;
+
 
 
     // Member instance attributes
@@ -457,6 +527,7 @@ namespace CSUF::CPSC131
     Node *      _head = nullptr;                                             // first element in the list
     Node *      _tail = nullptr;                                             // last element in the list.  tail->next is always nullptr
     std::size_t _size = 0;                                                   // number of elements in the collection
+    std::shared_ptr<Pool> _pool;                                             // where nodes come from and go back to
 
 
 
@@ -478,9 +549,9 @@ namespace CSUF::CPSC131
 
 
     // insert_after()
-    Node * insert_after( Node * currentNode, T const & data )
+    Node * insert_after( Node * currentNode, T data )
     {
-      Node * newNode     = new Node( data );                                 // Create and populate a new node with the provided data
+      Node * newNode     = _pool->template make<Node>( std::move( data ) );  // Create and populate a new node with the provided data
 
       // Special Case 1:  Inserting into an empty list?
       if( _size == 0 )   _head = _tail = newNode;                            // Both _head and _tail now point to the same, one and only node in the list
@@ -566,7 +637,7 @@ namespace CSUF::CPSC131
       if( toBeRemoved == _tail )    _tail = currentNode;                     // adjust tail to point to the new back node in the list
 
       Node * returnNode( toBeRemoved->_next );                               // return the node after the one removed
-      delete toBeRemoved;                                                    // delete what used to be the old node
+      _pool->destroy( toBeRemoved );                                         // destroy what used to be the old node, recycling its memory
       return returnNode;
     }
   };    // struct Members;
@@ -586,6 +657,314 @@ namespace CSUF::CPSC131
 
 
 
+/***********************************************************************************************************************************
+**  Unrolled Singly Linked List
+**
+**  This file provides an unrolled, null-terminated implementation of the SinglyLinkedList interface.  Each node holds up to
+**  CAPACITY elements (see unrolledNodeCapacity) instead of just one, so there's one _next pointer, and one trip to memory, per
+**  handful of elements.  A node's elements occupy slots [_begin, _end), so elements can be added to or removed from either end of
+**  a node without moving the others.
+**
+**  size = 7, 4 elements per node:
+**
+**                       +------+-------+-----+---+---+---+---+       +------+-------+-----+---+---+---+---+
+**                       | next | begin | end |   | a | b | c |------>| next | begin | end | d | e | f | g |------>nullptr
+**                       +------+-------+-----+---+---+---+---+       +------+-------+-----+---+---+---+---+          ^
+**                           ^                      ^                     ^                              ^            |
+**                           |                      |                     |                              |            |
+**                         head                  begin()                tail                           back()       end()
+**
+**  Iterators are a (node, slot) pair.  Inserting or erasing an element may move the other elements in the same node, so unlike
+**  the other policies, it invalidates iterators to elements sharing the node.
+***********************************************************************************************************************************/
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// An unrolled singly linked list's unique private type, attribute, and function members
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace CSUF::CPSC131
+{
+  template<typename T>
+  struct Members<T, SllPolicy::UNROLLED>
+  {
+    static constexpr std::size_t CAPACITY = unrolledNodeCapacity<T>;                  // elements per node
+    static_assert( CAPACITY > 0, "An unrolled list's nodes must hold at least one element" );
+
+    // Types
+    // An unrolled singly linked list's node
+    struct Node
+    {
+      Node () {}                                                                      // Slots are empty.  Elements are constructed as they're added
+     ~Node () {}                                                                      // and destroyed as they're removed, not here
+
+      Node *        _next  = nullptr;                                                 // next node in the list
+      std::uint32_t _begin = 0;                                                       // the node's elements are in slots [_begin, _end)
+      std::uint32_t _end   = 0;
+      union { T     _elements[CAPACITY]; };                                           // a union so the slots are not constructed or destroyed with the node
+    };
+
+    using Pool     = NodePool<sizeof( Node ), alignof( Node )>;
+    using Position = std::pair<Node *, std::size_t>;                                  // a node and one of its slots
+
+
+
+    // Member instance attributes
+    // An unrolled linked list's private data implementation
+    Node *      _head = nullptr;                                                      // first node in the list
+    Node *      _tail = nullptr;                                                      // last node in the list.  tail->next is always nullptr
+    std::size_t _size = 0;                                                            // number of elements (not nodes) in the collection
+    std::shared_ptr<Pool> _pool;                                                      // where nodes come from and go back to
+
+
+
+    //==============================================================================================================================
+    // Specialized function implemented specifically for an unrolled singly linked list
+    //
+    //==============================================================================================================================
+
+    // before_begin()
+    Node * before_begin()
+    { return nullptr; }
+
+
+
+    // end()
+    Node * end()
+    { return nullptr; }
+
+
+
+    // insert_after()
+    //   Inserts data into the slot after (node, slot), or at the front of the list if node is before_begin()
+    Position insert_after( Node * node, std::size_t slot, T data )
+    {
+      // Special Case 1:  Inserting at the front of the list?
+      if( node == before_begin() )
+      {
+        // If the head node has a free slot at its front use it, otherwise put a new node in front of the head. The element goes in
+        // the new node's last slot, leaving the others free for future insertions at the front
+        if( _head == nullptr  ||  _head->_begin == 0 )   linkAfter( before_begin(), makeNode( CAPACITY - 1, std::move( data ) ) );
+        else
+        {
+          std::construct_at( &_head->_elements[_head->_begin - 1], std::move( data ) );
+          --_head->_begin;
+        }
+
+        ++_size;
+        return { _head, _head->_begin };
+      }
+
+
+      std::size_t position = slot + 1;                                                // data goes in this slot
+
+
+      // Special Case 2:  Inserting after the node's last slot, and the node is full?
+      if( position == CAPACITY )
+      {
+        // Use a free slot at the front of the next node, or start a new node after this one, rather than move elements around.
+        // Filling the list from front to back (i.e., push_back) leaves every node full
+        if( node->_next != nullptr  &&  node->_next->_begin > 0 )
+        {
+          node = node->_next;
+          std::construct_at( &node->_elements[node->_begin - 1], std::move( data ) );
+          --node->_begin;
+        }
+        else
+        {
+          linkAfter( node, makeNode( 0, std::move( data ) ) );
+          node = node->_next;
+        }
+
+        ++_size;
+        return { node, node->_begin };
+      }
+
+
+      // Special Case 3:  The node is full?  Split it, moving its back half to a new node after it.  The back half is moved if that
+      // can't throw and copied otherwise, so should a copy throw the new node is let go and the list is as it was
+      if( node->_begin == 0  &&  node->_end == CAPACITY )
+      {
+        std::size_t middle = CAPACITY / 2;
+        Node *      back   = _pool->template make<Node>();
+        try
+        {
+          for( std::size_t i = middle;  i < CAPACITY;  ++i )
+          {
+            std::construct_at( &back->_elements[back->_end], std::move_if_noexcept( node->_elements[i] ) );
+            ++back->_end;
+          }
+        }
+        catch( ... )
+        {
+          std::destroy( &back->_elements[0], &back->_elements[back->_end] );
+          _pool->destroy( back );
+          throw;
+        }
+        std::destroy( &node->_elements[middle], &node->_elements[CAPACITY] );
+        node->_end = static_cast<std::uint32_t>( middle );
+        linkAfter( node, back );
+
+        if( position > middle )                                                       // data now belongs in the new node
+        {
+          position -= middle;
+          node      = back;
+        }
+      }
+
+
+      // Normal Case:  Make room for data by shifting elements toward the end of the node with a free slot.  Should a move throw
+      // part way through the shift, the slot just opened up is destroyed again so the node keeps as many elements as the list
+      // counts, although they may no longer be the same ones (like Vector's insert, only the basic guarantee)
+      if( node->_end < CAPACITY )
+      {
+        if( position == node->_end )   std::construct_at( &node->_elements[position], std::move( data ) );
+        else
+        {
+          std::construct_at( &node->_elements[node->_end], std::move_if_noexcept( node->_elements[node->_end - 1] ) );
+          try
+          {
+            std::move_backward( &node->_elements[position], &node->_elements[node->_end - 1], &node->_elements[node->_end] );
+            node->_elements[position] = std::move( data );
+          }
+          catch( ... )
+          {
+            std::destroy_at( &node->_elements[node->_end] );
+            throw;
+          }
+        }
+        ++node->_end;
+      }
+      else                                                                            // the only free slots are at the front
+      {
+        --position;
+        std::construct_at( &node->_elements[node->_begin - 1], std::move_if_noexcept( node->_elements[node->_begin] ) );
+        try
+        {
+          std::move( &node->_elements[node->_begin + 1], &node->_elements[position + 1], &node->_elements[node->_begin] );
+          node->_elements[position] = std::move( data );
+        }
+        catch( ... )
+        {
+          std::destroy_at( &node->_elements[node->_begin - 1] );
+          throw;
+        }
+        --node->_begin;
+      }
+
+      ++_size;
+      return { node, position };
+    }
+
+
+
+    // erase_after()
+    //   Removes the element after (node, slot), or at the front of the list if node is before_begin()
+    Position erase_after( Node * node, std::size_t slot )
+    {
+      // Error Case: Removing from an empty list?
+      if( _size == 0 )   throw std::length_error( exceptionString( "attempt to remove from an empty list" ) );
+
+      // Find the element to remove, and the node before the one it's in
+      Node *      previous = node;
+      Node *      target   = node;
+      std::size_t position = slot + 1;
+
+      if( node == before_begin() )              { target = _head;        position = _head->_begin; }
+      else if( position == node->_end )
+      {
+        // Special Case 1:  Attempting to remove after the last element?             // There is nothing after the tail - logic error?
+        if( node == _tail )   return { end(), 0 };                                    // removing after the tail intentionally does nothing
+
+        target   = node->_next;
+        position = target->_begin;
+      }
+      // else the element is in the same node as (node, slot), so the node can't become empty
+
+
+      // Remove the element.  At the front of the node nothing else moves, elsewhere the elements after it shift forward
+      if( position == target->_begin )
+      {
+        std::destroy_at( &target->_elements[position] );
+        ++target->_begin;
+        ++position;                                                                   // the element after the removed one
+      }
+      else
+      {
+        std::move( &target->_elements[position + 1], &target->_elements[target->_end], &target->_elements[position] );
+        std::destroy_at( &target->_elements[target->_end - 1] );
+        --target->_end;
+      }
+      --_size;
+
+
+      // Special Case 2:  The node is now empty?  Take it out of the chain
+      if( target->_begin == target->_end )
+      {
+        Node * next    = target->_next;
+        bool   wasHead = target == _head;
+
+        if( wasHead )           _head           = next;
+        else                    previous->_next = next;
+        if( target == _tail )   _tail           = wasHead ? nullptr : previous;
+
+        _pool->destroy( target );
+        return { next, next ? next->_begin : 0 };
+      }
+
+      if( position < target->_end )   return { target, position };                  // the element after the removed one is in the same node
+      return { target->_next, target->_next ? target->_next->_begin : 0 };
+    }
+
+
+
+    // makeNode()
+    //   A new node, not yet linked into the list, holding just data in the given slot.  The element is in place before the node
+    //   is linked, so should moving data throw, the node goes back to the pool and the list never sees it
+    Node * makeNode( std::size_t slot, T && data )
+    {
+      Node * newNode = _pool->template make<Node>();
+      try
+      {
+        std::construct_at( &newNode->_elements[slot], std::move( data ) );
+      }
+      catch( ... )
+      {
+        _pool->destroy( newNode );
+        throw;
+      }
+
+      newNode->_begin = static_cast<std::uint32_t>( slot     );
+      newNode->_end   = static_cast<std::uint32_t>( slot + 1 );
+      return newNode;
+    }
+
+
+
+    // linkAfter()
+    //   Links newNode, which already holds its elements, after node, or at the front of the list if node is before_begin()
+    void linkAfter( Node * node, Node * newNode ) noexcept
+    {
+      if( node == before_begin() )   { newNode->_next = _head;        _head        = newNode; }
+      else                           { newNode->_next = node->_next;  node->_next  = newNode; }
+
+      if( newNode->_next == nullptr )   _tail = newNode;
+    }
+  };    // struct Members;
+}  //namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
 /***********************************************************************************************************************************
 ** Common functions for all Singly Linked List implementations
 **
@@ -606,15 +985,26 @@ namespace CSUF::CPSC131
   // Default constructor
   template <typename T, SllPolicy POLICY>
   SinglyLinkedList<T, POLICY>::SinglyLinkedList()
-    : self( std::make_unique<PrivateAttributes>() )                                   // construct the list's private members
+    : SinglyLinkedList( std::make_shared<node_pool>() )                               // delegating constructor, with a pool of its own
   {}
 
 
 
+  // Node pool constructor
+  template <typename T, SllPolicy POLICY>
+  SinglyLinkedList<T, POLICY>::SinglyLinkedList( std::shared_ptr<node_pool> pool )
+    : self( std::make_unique<PrivateAttributes>() )                                   // construct the list's private members
+  {
+    if( pool == nullptr )   throw std::invalid_argument( exceptionString( "a list's node pool cannot be null" ) );
+    self->_pool = std::move( pool );
+  }
+
+
+
   // Copy construction
   template <typename T, SllPolicy POLICY>
   SinglyLinkedList<T, POLICY>::SinglyLinkedList( const SinglyLinkedList & original )
-    : SinglyLinkedList()                                                              // delegating constructor
+    : SinglyLinkedList()                                                              // delegating constructor.  The copy does not share the original's pool
   {
     // This new list has already been constructed and initialized to be empty.  Now, walk the original list adding copies of the
     // elements to this (initially empty) list maintaining order (i.e,  perform a deep copy)
@@ -708,7 +1098,14 @@ namespace CSUF::CPSC131
   // size() const
   template <typename T, SllPolicy POLICY>
   std::size_t SinglyLinkedList<T, POLICY>::size() const noexcept
-  { return self->_size; }
+  { return self ? self->_size : 0; }                                                  // a moved-from list has no private members, and is empty
+
+
+
+  // pool() const
+  template <typename T, SllPolicy POLICY>
+  std::shared_ptr<typename SinglyLinkedList<T, POLICY>::node_pool> SinglyLinkedList<T, POLICY>::pool() const noexcept
+  { return self ? self->_pool : nullptr; }
 
 
 
@@ -741,7 +1138,10 @@ namespace CSUF::CPSC131
   // begin()
   template <typename T, SllPolicy POLICY>
   typename SinglyLinkedList<T, POLICY>::iterator SinglyLinkedList<T, POLICY>::begin()
-  { return self->_head; }
+  {
+    if constexpr( POLICY == SllPolicy::UNROLLED )   return { self->_head, self->_head != nullptr  ?  self->_head->_begin  :  0u };
+    else                                            return self->_head;
+  }
 
 
 
@@ -817,7 +1217,8 @@ namespace CSUF::CPSC131
   {
     if( empty() )   throw std::length_error( exceptionString( "attempt to access data from an empty list" ) );
 
-    return self->_tail->_data;
+    if constexpr( POLICY == SllPolicy::UNROLLED )   return self->_tail->_elements[self->_tail->_end - 1];
+    else                                            return self->_tail->_data;
   }
 
 
@@ -863,7 +1264,10 @@ namespace CSUF::CPSC131
   // push_back()
   template <typename T, SllPolicy POLICY>
   void SinglyLinkedList<T, POLICY>::push_back( const T & data )
-  { insert_after( self->_tail, data );}
+  {
+    if constexpr( POLICY == SllPolicy::UNROLLED )   insert_after( empty() ? before_begin() : iterator{ self->_tail, self->_tail->_end - 1u }, data );   // after the tail node's last element
+    else                                            insert_after( self->_tail, data );
+  }
 
 
 
@@ -878,17 +1282,440 @@ namespace CSUF::CPSC131
 
 
 
+  // shrink_to_fit()
+  template <typename T, SllPolicy POLICY>
+  void SinglyLinkedList<T, POLICY>::shrink_to_fit()
+  {
+    // Removed nodes are kept by the pool for reuse.  Blocks with no node in use, by this list or any other list sharing the pool,
+    // are given back.
+    if( self )   self->_pool->shrink();
+  }
+
+
+
   // insert_after()
   template <typename T, SllPolicy POLICY>
   typename SinglyLinkedList<T, POLICY>::iterator SinglyLinkedList<T, POLICY>::insert_after( const_iterator position, T const & data )
-  { return self->insert_after( position._nodePtr, data ); }                           // dispatch to policy specific implementation
+  {
+    if constexpr( POLICY == SllPolicy::UNROLLED )
+    {
+      auto [node, index] = self->insert_after( position._nodePtr, position._index, data );   // dispatch to policy specific implementation
+      return { node, index };
+    }
+    else   return self->insert_after( position._nodePtr, data );                      // dispatch to policy specific implementation
+  }
 
 
 
   // erase_after()
   template <typename T, SllPolicy POLICY>
   typename SinglyLinkedList<T, POLICY>::iterator SinglyLinkedList<T, POLICY>::erase_after( const_iterator position )
-  { return self->erase_after( position._nodePtr ); }                                 // dispatch to policy specific implementation
+  {
+    if constexpr( POLICY == SllPolicy::UNROLLED )
+    {
+      auto [node, index] = self->erase_after( position._nodePtr, position._index );   // dispatch to policy specific implementation
+      return { node, index };
+    }
+    else   return self->erase_after( position._nodePtr );                             // dispatch to policy specific implementation
+  }
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Operations
+  //
+  // Everything here works by changing _next pointers.  A node's element never moves, so elements are never copied and iterators
+  // stay valid.  Nodes taken out of a list are destroyed (returned to the pool), and no node is ever created.  A node must go back
+  // to the pool it came from, so lists with different node pools first combine them (see sharePool()).  Only if that's not
+  // possible are the elements moved into new nodes from this list's pool instead.
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // splice_after() - the whole list
+  template <typename T, SllPolicy POLICY>
+  void SinglyLinkedList<T, POLICY>::splice_after( const_iterator position, SinglyLinkedList & other ) requires ONE_ELEMENT_PER_NODE
+  {
+    if( &other == this  ||  other.empty() )   return;
+
+    if( !sharePool( other ) )                                                         // can't relink, move the elements instead
+    {
+      splice_after( position, other, other.cbefore_begin(), other.cend() );
+      return;
+    }
+
+    // Other's head and tail are known, so no walking is needed to find the nodes being moved
+    std::size_t count = other.size();
+    Node *      first = other.self->_head;
+    Node *      last  = other.self->_tail;
+    other.detach();
+
+    Node *& link = nextOf( position._nodePtr );
+    last->_next  = link;                                                              // the last node moved now points to what followed position
+    link         = first;                                                             // and position now points to the first node moved
+    if( self->_tail == position._nodePtr )   self->_tail = last;                      // If necessary, move the tail
+
+    self->_size += count;
+  }
+
+
+
+  // splice_after() - one element
+  template <typename T, SllPolicy POLICY>
+  void SinglyLinkedList<T, POLICY>::splice_after( const_iterator position, SinglyLinkedList & other, const_iterator it ) requires ONE_ELEMENT_PER_NODE
+  {
+    Node * moved = other.nextOf( it._nodePtr );
+    if( moved == other.self->end() )   return;                                        // nothing after it
+    if( &other == this  &&  ( position._nodePtr == it._nodePtr  ||  position._nodePtr == moved ) )   return;   // already there
+
+    splice_after( position, other, it, moved->_next );
+  }
+
+
+
+  // splice_after() - the open range (first, last)
+  template <typename T, SllPolicy POLICY>
+  void SinglyLinkedList<T, POLICY>::splice_after( const_iterator position, SinglyLinkedList & other, const_iterator first, const_iterator last ) requires ONE_ELEMENT_PER_NODE
+  {
+    Node *& firstLink = other.nextOf( first._nodePtr );                               // the link to the first node moved
+    if( firstLink == last._nodePtr )   return;                                        // (first, last) is empty
+
+    // Walk to the last node moved, counting the nodes along the way so both sizes stay right
+    Node *      lastMoved = firstLink;
+    std::size_t count     = 1;
+    for( ; lastMoved->_next != last._nodePtr;  lastMoved = lastMoved->_next )   ++count;
+
+
+    // Different node pools that can't be combined?  Move the elements into new nodes, then remove the old ones
+    if( !sharePool( other ) )
+    {
+      Node * current = position._nodePtr;
+      for( Node * p = firstLink;  p != last._nodePtr;  p = p->_next )   current = self->insert_after( current, std::move( p->_data ) );
+      for( ; count > 0;  --count )   other.self->erase_after( first._nodePtr );
+      return;
+    }
+
+
+    // Take the nodes out of other's chain
+    Node * firstMoved = firstLink;
+    firstLink = last._nodePtr;
+    if( other.self->_tail == lastMoved )   other.self->_tail = first._nodePtr;        // first is other's new back node
+    other.self->_size -= count;
+
+    // And put them into this list's chain.  (When splicing within the same list, the link after position is found only after the
+    // nodes have been taken out.)
+    Node *& link     = nextOf( position._nodePtr );
+    lastMoved->_next = link;
+    link             = firstMoved;
+    if( self->_tail == position._nodePtr )   self->_tail = lastMoved;
+    self->_size += count;
+  }
+
+
+
+  // merge()
+  template <typename T, SllPolicy POLICY>
+  void SinglyLinkedList<T, POLICY>::merge( SinglyLinkedList & other ) requires ONE_ELEMENT_PER_NODE
+  { merge( other, std::less<>{} ); }
+
+
+
+  template <typename T, SllPolicy POLICY>   template<typename Compare>
+  void SinglyLinkedList<T, POLICY>::merge( SinglyLinkedList & other, Compare less ) requires ONE_ELEMENT_PER_NODE
+  {
+    if( &other == this  ||  other.empty() )   return;
+
+    if( !sharePool( other ) )
+    {
+      // Move other's elements into nodes from this list's pool, then merge those
+      SinglyLinkedList moved( pool() );
+      moved.splice_after( moved.cbefore_begin(), other );
+      merge( moved, less );
+      return;
+    }
+
+    std::size_t count  = size() + other.size();
+    Node *      mine   = detach();
+    Node *      theirs = other.detach();
+
+    try
+    {
+      attach( mergeChains( mine, theirs, less ), count );
+    }
+    catch( ... )
+    {
+      attach( concatenate( mine, theirs ), count );                                   // less threw, keep every element (in some order)
+      throw;
+    }
+  }
+
+
+
+  // sharePool() - A node must go back to the pool it came from, so the nodes of one pool can be relinked into lists of another only
+  // if the two pools become one.  NodePool::merge() hands all of one pool's blocks, and so all of its nodes, to another in O(blocks)
+  // without touching a node.  But a pool some other list (or anyone holding a pool() pointer) still uses can't be given up, that
+  // other list's nodes would then belong to a pool it doesn't know about.
+  template <typename T, SllPolicy POLICY>
+  bool SinglyLinkedList<T, POLICY>::sharePool( SinglyLinkedList & other ) requires ONE_ELEMENT_PER_NODE
+  {
+    auto & mine   = self->_pool;
+    auto & theirs = other.self->_pool;
+
+    if( mine == theirs )                                      return true;            // already sharing
+    if( mine->slotsPerBlock() != theirs->slotsPerBlock() )    return false;           // blocks of different sizes can't be combined
+
+    if( theirs.use_count() == 1 )                                                     // only other uses its pool, fold it into this list's
+    {
+      mine->merge( *theirs );
+      theirs = mine;
+      return true;
+    }
+
+    if( mine.use_count() == 1 )                                                       // only this list uses its pool, fold it into other's
+    {
+      theirs->merge( *mine );
+      mine = theirs;
+      return true;
+    }
+
+    return false;
+  }
+
+
+
+  // sort()
+  template <typename T, SllPolicy POLICY>
+  void SinglyLinkedList<T, POLICY>::sort() requires ONE_ELEMENT_PER_NODE
+  { sort( std::less<>{} ); }
+
+
+
+  template <typename T, SllPolicy POLICY>   template<typename Compare>
+  void SinglyLinkedList<T, POLICY>::sort( Compare less ) requires ONE_ELEMENT_PER_NODE
+  {
+    // Bottom-up merge sort.  Instead of recursively splitting the list in half, start with sorted runs of one node and merge
+    // equal length runs into runs twice as long.  bins[i] is either empty or holds a sorted run of 2^i nodes, much like the digits
+    // of a binary counter.  Each node taken from the list is a run of length 1 that "carries" up through the bins, merging with
+    // every full bin it meets until it finds an empty one.  When the nodes run out, the bins are merged together.  64 bins are
+    // enough for 2^64 nodes, and there's no recursion so no risk of overflowing the stack.
+    if( size() < 2 )   return;
+
+    std::size_t               count    = size();
+    Node *                    unsorted = detach();
+    Node *                    carry    = nullptr;
+    Node *                    sorted   = nullptr;
+    std::array<Node *, 64>    bins{};
+
+    try
+    {
+      while( unsorted != nullptr )
+      {
+        carry          = unsorted;                                                    // take the next node off the front of the chain
+        unsorted       = unsorted->_next;
+        carry->_next   = nullptr;
+
+        std::size_t i = 0;
+        for( ; bins[i] != nullptr;  ++i )   carry = mergeChains( bins[i], carry, less );   // bins[i] holds earlier nodes, keeping the sort stable
+        bins[i] = carry;
+        carry   = nullptr;
+      }
+
+      for( auto & bin : bins )   if( bin != nullptr )   sorted = mergeChains( bin, sorted, less );   // bigger bins hold earlier nodes
+    }
+    catch( ... )
+    {
+      // less threw.  Put every node back in the list, in no particular order, so nothing is lost
+      Node * everything = concatenate( carry, concatenate( sorted, unsorted ) );
+      for( auto bin : bins )   everything = concatenate( bin, everything );
+      attach( everything, count );
+      throw;
+    }
+
+    attach( sorted, count );
+  }
+
+
+
+  // unique()
+  template <typename T, SllPolicy POLICY>
+  std::size_t SinglyLinkedList<T, POLICY>::unique() requires ONE_ELEMENT_PER_NODE
+  { return unique( std::equal_to<>{} ); }
+
+
+
+  template <typename T, SllPolicy POLICY>   template<typename BinaryPredicate>
+  std::size_t SinglyLinkedList<T, POLICY>::unique( BinaryPredicate equal ) requires ONE_ELEMENT_PER_NODE
+  {
+    if( empty() )   return 0;
+
+    // Compare each element with the first element of its group, which is kept
+    std::size_t removed = 0;
+    for( Node * kept = self->_head;  kept->_next != self->end(); )
+    {
+      if( equal( kept->_data, kept->_next->_data ) )   { self->erase_after( kept );  ++removed; }
+      else                                             kept = kept->_next;
+    }
+    return removed;
+  }
+
+
+
+  // remove()
+  template <typename T, SllPolicy POLICY>
+  std::size_t SinglyLinkedList<T, POLICY>::remove( T const & value ) requires ONE_ELEMENT_PER_NODE
+  { return remove_if( [&value]( T const & element ) { return element == value; } ); }
+
+
+
+  // remove_if()
+  template <typename T, SllPolicy POLICY>   template<typename Predicate>
+  std::size_t SinglyLinkedList<T, POLICY>::remove_if( Predicate predicate ) requires ONE_ELEMENT_PER_NODE
+  {
+    // Removed nodes are set aside and destroyed only after the walk.  value in remove( value ) may well be a reference to an
+    // element in this very list, and destroying it part way through would change what's being removed.
+    Node *      removedNodes = nullptr;
+    std::size_t removed      = 0;
+
+    try
+    {
+      Node * previous = self->before_begin();
+      while( nextOf( previous ) != self->end() )
+      {
+        Node *& link    = nextOf( previous );
+        Node *  current = link;
+
+        if( predicate( current->_data ) )
+        {
+          link = current->_next;                                                      // take the node out of the chain
+          if( current == self->_tail )   self->_tail = previous;
+          --self->_size;
+
+          current->_next = removedNodes;                                              // and set it aside
+          removedNodes   = current;
+          ++removed;
+        }
+        else   previous = current;
+      }
+    }
+    catch( ... )
+    {
+      destroyChain( removedNodes );
+      throw;
+    }
+
+    destroyChain( removedNodes );
+    return removed;
+  }
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Relinking helper functions
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // nextOf()
+  template <typename T, SllPolicy POLICY>
+  typename SinglyLinkedList<T, POLICY>::Node *& SinglyLinkedList<T, POLICY>::nextOf( Node * position ) requires ONE_ELEMENT_PER_NODE
+  {
+    // A null-terminated list's before_begin() is a null pointer, with no _next to follow.  A circular list's before_begin() is the
+    // sentinel whose _next is the head, so asking for the head covers both
+    return position == self->before_begin()  ?  self->_head  :  position->_next;
+  }
+
+
+
+  // detach()
+  template <typename T, SllPolicy POLICY>
+  typename SinglyLinkedList<T, POLICY>::Node * SinglyLinkedList<T, POLICY>::detach() requires ONE_ELEMENT_PER_NODE
+  {
+    if( empty() )   return nullptr;
+
+    Node * chain = self->_head;
+    self->_tail->_next = nullptr;                                                     // null-terminate the chain
+
+    self->_head = self->end();                                                        // and leave the list empty
+    self->_tail = self->before_begin();
+    self->_size = 0;
+    return chain;
+  }
+
+
+
+  // attach()
+  template <typename T, SllPolicy POLICY>
+  void SinglyLinkedList<T, POLICY>::attach( Node * chain, std::size_t count ) requires ONE_ELEMENT_PER_NODE
+  {
+    if( chain == nullptr )   return;
+
+    Node * last = chain;
+    while( last->_next != nullptr )   last = last->_next;
+
+    self->_head  = chain;
+    self->_tail  = last;
+    last->_next  = self->end();                                                       // nullptr or the sentinel, depending on policy
+    self->_size  = count;
+  }
+
+
+
+  // destroyChain()
+  template <typename T, SllPolicy POLICY>
+  void SinglyLinkedList<T, POLICY>::destroyChain( Node * chain ) noexcept requires ONE_ELEMENT_PER_NODE
+  {
+    while( chain != nullptr )
+    {
+      Node * next = chain->_next;
+      self->_pool->destroy( chain );
+      chain = next;
+    }
+  }
+
+
+
+  // concatenate()
+  template <typename T, SllPolicy POLICY>
+  typename SinglyLinkedList<T, POLICY>::Node * SinglyLinkedList<T, POLICY>::concatenate( Node * front, Node * back ) requires ONE_ELEMENT_PER_NODE
+  {
+    if( front == nullptr )   return back;
+
+    Node * last = front;
+    while( last->_next != nullptr )   last = last->_next;
+    last->_next = back;
+    return front;
+  }
+
+
+
+  // mergeChains()
+  //   On return a and b are empty (null).  Should less throw, a holds every node from both chains (in no particular order), and b
+  //   is empty.
+  template <typename T, SllPolicy POLICY>   template<typename Compare>
+  typename SinglyLinkedList<T, POLICY>::Node * SinglyLinkedList<T, POLICY>::mergeChains( Node *& a, Node *& b, Compare & less ) requires ONE_ELEMENT_PER_NODE
+  {
+    Node *  merged = nullptr;
+    Node ** link   = &merged;                                                         // where the next node of the merged chain goes
+
+    try
+    {
+      while( a != nullptr  &&  b != nullptr )
+      {
+        // Take from a unless b's node is strictly less.  Equal elements keep their relative order (a's come first)
+        if( less( b->_data, a->_data ) )   { *link = b;  b = b->_next; }
+        else                               { *link = a;  a = a->_next; }
+        link = &( *link )->_next;
+      }
+    }
+    catch( ... )
+    {
+      *link = concatenate( a, b );
+      a     = merged;
+      b     = nullptr;
+      throw;
+    }
+
+    *link = ( a != nullptr )  ?  a  :  b;                                             // whatever remains is already sorted
+    a = b = nullptr;
+    return merged;
+  }
 
 
 
@@ -970,7 +1797,8 @@ namespace CSUF::CPSC131
   // Type of parameter is intentionally a non-constant iterator
   template <typename T, SllPolicy POLICY>   template<typename U>
   SinglyLinkedList<T, POLICY>::Iterator_type<U>::Iterator_type( iterator const & other )      // Notice the parameter type is "iterator", not "Iterator_type"
-    : _nodePtr{ other._nodePtr }
+    : _nodePtr{ other._nodePtr },
+      _index  { other._index   }
   {}
 
 
@@ -983,13 +1811,30 @@ namespace CSUF::CPSC131
 
 
 
+  // Conversion Constructor from pointer-to-Node and slot to iterator (unrolled lists)
+  template <typename T, SllPolicy POLICY>   template<typename U>
+  SinglyLinkedList<T, POLICY>::Iterator_type<U>::Iterator_type( Node * p, std::size_t index )
+    : _nodePtr{ p     },
+      _index  { index }
+  {}
+
+
+
   // operator++   pre-increment
   template <typename T, SllPolicy POLICY>   template<typename U>
   typename SinglyLinkedList<T, POLICY>::template Iterator_type<U> &   SinglyLinkedList<T, POLICY>::Iterator_type<U>::operator++()
   {
     if( _nodePtr == nullptr )   throw std::invalid_argument( exceptionString( "Attempt to increment null iterator" ) );
 
-    _nodePtr = _nodePtr->_next;
+    if constexpr( POLICY == SllPolicy::UNROLLED )
+    {
+      if( ++_index < _nodePtr->_end )   return *this;                                 // the next element is in the same node
+
+      _nodePtr = _nodePtr->_next;                                                     // otherwise it's the first element of the next node
+      _index   = _nodePtr != nullptr  ?  _nodePtr->_begin  :  0;
+    }
+    else   _nodePtr = _nodePtr->_next;
+
     return *this;
   }
 
@@ -1012,7 +1857,8 @@ namespace CSUF::CPSC131
   {
     if( _nodePtr == nullptr )   throw std::invalid_argument( exceptionString( "Attempt to dereference null iterator" ) );
 
-    return _nodePtr->_data;
+    if constexpr( POLICY == SllPolicy::UNROLLED )   return _nodePtr->_elements[_index];
+    else                                            return _nodePtr->_data;
   }
 
 
@@ -1023,7 +1869,7 @@ namespace CSUF::CPSC131
   {
     if( _nodePtr == nullptr )  throw std::invalid_argument( exceptionString( "Attempt to dereference null iterator" ) );
 
-    return &(_nodePtr->_data);
+    return &operator*();
   }
 
 
@@ -1031,7 +1877,7 @@ namespace CSUF::CPSC131
   // operator==
   template <typename T, SllPolicy POLICY>   template<typename U>
   bool SinglyLinkedList<T, POLICY>::Iterator_type<U>::operator==( Iterator_type const & rhs ) const
-  { return _nodePtr == rhs._nodePtr; }
+  { return _nodePtr == rhs._nodePtr  &&  _index == rhs._index; }
 
 
 
@@ -1049,7 +1895,7 @@ namespace CSUF::CPSC131
   ///////////////////  Reverse  ///////////////////////
   // Client facing public function
   template <typename T, SllPolicy POLICY>
-  void SinglyLinkedList<T, POLICY>::reverse()
+  void SinglyLinkedList<T, POLICY>::reverse() requires ONE_ELEMENT_PER_NODE
   {
     auto & head = self->_head;                                                        // an easier to read alias for the head of the list
     auto & tail = self->_tail;                                                        // an easier to read alias for the tail of the list
@@ -1062,7 +1908,7 @@ namespace CSUF::CPSC131
 
   // The private helper function
   template <typename T, SllPolicy POLICY>
-  void SinglyLinkedList<T, POLICY>::reverse( Node * current )
+  void SinglyLinkedList<T, POLICY>::reverse( Node * current ) requires ONE_ELEMENT_PER_NODE
   {
     // Base Case - There is nothing more to do if we're reversing an empty list or we're at the last node in a non-empty list
     if( end() == current || end() == current->_next ) return;
@@ -1080,7 +1926,7 @@ namespace CSUF::CPSC131
   ///////////////////  Add  ///////////////////////
   // Client facing public function
   template <typename T, SllPolicy POLICY>
-  T SinglyLinkedList<T, POLICY>::add() const
+  T SinglyLinkedList<T, POLICY>::add() const requires ONE_ELEMENT_PER_NODE
   {
     return add( self->_head );                                                        // Kick off the recursion starting at the head. Note the call to overloaded, private add function
   }
@@ -1089,7 +1935,7 @@ namespace CSUF::CPSC131
 
   // The private helper function
   template <typename T, SllPolicy POLICY>
-  T SinglyLinkedList<T, POLICY>::add( Node * current ) const
+  T SinglyLinkedList<T, POLICY>::add( Node * current ) const requires ONE_ELEMENT_PER_NODE
   {
     // Base Case - reached the end of the list.  Can't return zero, T may not be an integer type. Return the value initialized
     //             default value instead
@@ -1107,7 +1953,7 @@ namespace CSUF::CPSC131
   ///////////////////  Find  ///////////////////////
   // Client facing public function
   template <typename T, SllPolicy POLICY>
-  typename SinglyLinkedList<T, POLICY>::iterator SinglyLinkedList<T, POLICY>::find( const T & data )
+  typename SinglyLinkedList<T, POLICY>::iterator SinglyLinkedList<T, POLICY>::find( const T & data ) requires ONE_ELEMENT_PER_NODE
   {
     return find( self->_head, data );                                                 // Kick off the recursion starting at the head. Note the call to the overloaded, private find function
   }
@@ -1116,7 +1962,7 @@ namespace CSUF::CPSC131
 
   // The private helper function
   template <typename T, SllPolicy POLICY>
-  typename SinglyLinkedList<T, POLICY>::iterator SinglyLinkedList<T, POLICY>::find( Node * current, const T & data )
+  typename SinglyLinkedList<T, POLICY>::iterator SinglyLinkedList<T, POLICY>::find( Node * current, const T & data ) requires ONE_ELEMENT_PER_NODE
   {
     // Base Case - reached the end of the list without finding what we're looking for
     if( end() == current )   return end();
@@ -1133,7 +1979,7 @@ namespace CSUF::CPSC131
   ///////////////////  Forward Print  ///////////////////////
   // Client facing public function
   template <typename T, SllPolicy POLICY>
-  void SinglyLinkedList<T, POLICY>::forwardPrint( std::ostream & stream ) const
+  void SinglyLinkedList<T, POLICY>::forwardPrint( std::ostream & stream ) const requires ONE_ELEMENT_PER_NODE
   {
     forwardPrint( self->_head, stream );                                              // Kick off the recursion starting at the head. Note the call to the overloaded, private forwardPrint function
   }
@@ -1142,7 +1988,7 @@ namespace CSUF::CPSC131
 
   // The private helper function
   template <typename T, SllPolicy POLICY>
-  void SinglyLinkedList<T, POLICY>::forwardPrint( Node * current, std::ostream & stream ) const
+  void SinglyLinkedList<T, POLICY>::forwardPrint( Node * current, std::ostream & stream ) const requires ONE_ELEMENT_PER_NODE
   {
     // Base Case - reached the end of the list
     if( end() == current )   return;
@@ -1160,7 +2006,7 @@ namespace CSUF::CPSC131
   ///////////////////  Backward Print  ///////////////////////
   // Client facing public function
   template <typename T, SllPolicy POLICY>
-  void SinglyLinkedList<T, POLICY>::backwardPrint( std::ostream & stream ) const
+  void SinglyLinkedList<T, POLICY>::backwardPrint( std::ostream & stream ) const requires ONE_ELEMENT_PER_NODE
   {
     backwardPrint( self->_head, stream );                                             // Kick off the recursion starting at the head. Note the call to the overloaded, private backwardPrint function
   }
@@ -1169,7 +2015,7 @@ namespace CSUF::CPSC131
 
   // The private helper function
   template <typename T, SllPolicy POLICY>
-  void SinglyLinkedList<T, POLICY>::backwardPrint( Node * current, std::ostream & stream ) const
+  void SinglyLinkedList<T, POLICY>::backwardPrint( Node * current, std::ostream & stream ) const requires ONE_ELEMENT_PER_NODE
   {
     // Base Case - reached the end of the list
     if( end() == current )   return;
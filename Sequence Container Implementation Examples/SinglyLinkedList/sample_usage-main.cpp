@@ -1,6 +1,7 @@
 import std;
 import CSUF.CPSC131.Student;
 import CSUF.CPSC131.SinglyLinkedList;
+import CSUF.CPSC131.NodePool;
 
 namespace  // unnamed, anonymous namespace
 {
@@ -76,6 +77,116 @@ namespace  // unnamed, anonymous namespace
                            "{3}\n",
                            ++count, forward.str(), backward.str(), banner );
   }
+
+
+
+  void runNodePoolDriver()
+  {
+    using List = CSUF::CPSC131::SinglyLinkedList<int>;
+
+    // Two lists sharing one pool of nodes, used like a pair of queues
+    auto  pool = std::make_shared<List::node_pool>();
+    List  arrivals( pool ), departures( pool );
+
+    auto report = [&]( std::string_view when )
+    {
+      auto stats = pool->statistics();
+      std::print( std::cout, "{0:>3}:  {1:<28}  blocks: {2:>2}  capacity: {3:>5}  in use: {4:>5}  allocator calls: {5:>2}  returns: {6:>2}\n",
+                             ++count, when, stats.blocks, stats.capacity, stats.inUse, stats.allocatorCalls, stats.allocatorReturns );
+    };
+
+    std::print( std::cout, "\n\n\n"
+                           "Recycling nodes through a shared node pool\n"
+                           "{}\n", banner );
+
+    for( int i = 0;  i < 1'000;  ++i )   arrivals.push_back( i );
+    report( "After 1,000 arrivals" );
+
+    // Steady state:  every node popped is immediately reused by the next push, the allocator is never called
+    for( int i = 0;  i < 100'000;  ++i )
+    {
+      departures.push_back( arrivals.front() );
+      arrivals.pop_front();
+      arrivals.push_back( departures.front() );
+      departures.pop_front();
+    }
+    report( "After 100,000 round trips" );
+
+    while( arrivals.size() > 10 )   arrivals.pop_front();
+    report( "After draining to 10" );
+
+    arrivals.shrink_to_fit();
+    report( "After shrink_to_fit()" );
+    std::print( std::cout, "{}\n", banner );
+  }
+
+
+
+  void runRelinkingDriver()
+  {
+    using List = CSUF::CPSC131::SinglyLinkedList<int, CSUF::CPSC131::SllPolicy::NTL>;
+
+    // Lists sharing a pool can trade nodes, so none of the following allocates, copies, or moves an element
+    auto pool = std::make_shared<List::node_pool>();
+    List odds( pool ), evens( pool );
+    for( int i : { 9, 3, 7, 1, 5, 3, 9 } )   odds .push_front( i );
+    for( int i : { 8, 2, 6, 4, 8, 0    } )   evens.push_front( i );
+
+    std::print( std::cout, "\n\n\n"
+                           "Sorting, merging, and splicing by relinking nodes\n"
+                           "{}\n", banner );
+    std::print( std::cout, "{0:>3}:  Odds:             {1:n:}\n"
+                           "   " ":  Evens:            {2:n:}\n", ++count, odds, evens );
+
+    odds .sort();
+    evens.sort( std::greater<>{} );
+    std::print( std::cout, "{0:>3}:  Sorted:           {1:n:}\n"
+                           "   " ":  Reverse sorted:   {2:n:}\n", ++count, odds, evens );
+
+    odds.unique();
+    evens.remove_if( []( int i ) { return i > 6; } );
+    std::print( std::cout, "{0:>3}:  Unique:           {1:n:}\n"
+                           "   " ":  Without 7+:       {2:n:}\n", ++count, odds, evens );
+
+    evens.reverse();
+    odds.merge( evens );
+    std::print( std::cout, "{0:>3}:  Merged:           {1:n:}\n"
+                           "   " ":  Left behind:      {2:n:}\n", ++count, odds, evens );
+
+    evens.splice_after( evens.cbefore_begin(), odds, std::next( odds.cbegin(), 5 ), odds.cend() );
+    std::print( std::cout, "{0:>3}:  Spliced off:      {1:n:}\n"
+                           "   " ":  Remaining:        {2:n:}\n", ++count, evens, odds );
+
+    // Lists with pools of their own relink nodes too.  The first splice folds one list's pool into the other's, and from then on
+    // the two share it.  The node holding 4 is the very same node, now in the other list
+    List front = { 1, 2, 3 }, back = { 4, 5, 6 };
+    int const * four = &back.front();
+    front.splice_after( std::next( front.cbegin(), 2 ), back );
+    std::print( std::cout, "{0:>3}:  Spliced in:       {1:n:}\n"
+                           "   " ":  Same node:        {2},  sharing a pool:  {3}\n", ++count, front, four == &*std::next( front.cbegin(), 3 ), front.pool() == back.pool() );
+    std::print( std::cout, "{}\n", banner );
+  }
+
+
+
+  void runUnrolledDriver()
+  {
+    using List = CSUF::CPSC131::SinglyLinkedList<int, CSUF::CPSC131::SllPolicy::UNROLLED>;
+
+    // Used as a queue, elements are added to the back and removed from the front of nodes holding several elements each
+    List queue;
+    for( int i = 1;  i <= 100;  ++i )   queue.push_back( i );
+    for( int i = 1;  i <=  40;  ++i )   queue.pop_front();
+    queue.insert_after( std::next( queue.begin(), 4 ), -1 );
+
+    std::print( std::cout, "\n\n\n"
+                           "Unrolled list, {} elements per node\n"
+                           "{}\n"
+                           "{:>3}:  {} elements in {} nodes:  {:n:}\n"
+                           "{}\n",
+                           CSUF::CPSC131::unrolledNodeCapacity<int>, banner,
+                           ++count, queue.size(), queue.pool()->statistics().inUse, queue, banner );
+  }
 }    // anonymous namespace
 
 
@@ -142,6 +253,18 @@ int main()
 
     // Example recursive extensions
     runExtendedInterfaceDriver();
+
+
+    // Example node pool usage
+    runNodePoolDriver();
+
+
+    // Example relinking operations
+    runRelinkingDriver();
+
+
+    // Example unrolled list
+    runUnrolledDriver();
   }
 
   catch( std::exception & ex )
@@ -164,3 +287,8 @@ template class CSUF::CPSC131::SinglyLinkedList<std::string, CSUF::CPSC131::SllPo
 
 template class CSUF::CPSC131::SinglyLinkedList<int,         CSUF::CPSC131::SllPolicy::NTL>;
 template class CSUF::CPSC131::SinglyLinkedList<std::string, CSUF::CPSC131::SllPolicy::NTL>;
+
+template class CSUF::CPSC131::SinglyLinkedList<int,         CSUF::CPSC131::SllPolicy::UNROLLED>;
+template class CSUF::CPSC131::SinglyLinkedList<std::string, CSUF::CPSC131::SllPolicy::UNROLLED>;
+
+template class CSUF::CPSC131::NodePool<16, 8>;
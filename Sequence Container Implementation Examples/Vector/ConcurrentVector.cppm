@@ -0,0 +1,773 @@
+/***********************************************************************************************************************************
+** Class ConcurrentVector - an append-only vector many threads can push_back() onto at the same time
+**
+**  Vector keeps its elements in one array.  Growing means moving every element to a bigger array, invalidating every pointer,
+**  reference, and iterator - and any other thread using one is left reading freed memory.  So a Vector shared by several
+**  threads needs a mutex around everything, and the threads take turns.
+**
+**  A ConcurrentVector never moves an element.  Its storage is a series of blocks, each twice as big as the one before, and
+**  growing just adds the next block.  The blocks already there, and the elements in them, stay put:
+**
+**           block 0             block 1                         block 2
+**          +----+----+         +----+----+----+----+           +----+----+----+----+----+----+----+----+
+**          | e0 | e1 |         | e2 | e3 | e4 | e5 |           | e6 | e7 |    |    |    |    |    |    |
+**          +----+----+         +----+----+----+----+           +----+----+----+----+----+----+----+----+
+**          (shown with a first block of 2, it's really FIRST_BLOCK)
+**
+**  Appending is lock-free:  a thread reserves the next index with a single atomic compare-and-exchange, constructs its element
+**  in that slot while other threads construct theirs, then publishes it.  Elements are published in index order, so size() is
+**  always a safe snapshot - every element below it is completely constructed.  Reading a published element is wait-free, just
+**  two loads and some arithmetic, no matter what the appending threads are doing.
+**
+**  Thread safety:
+**    o  push_back(), emplace_back(), reserve(), and all queries, accessors, and iterators may be used concurrently
+**    o  Construction, assignment, clear(), swap(), and destruction may not - no other thread may be using the vector then
+**    o  Elements themselves are not protected.  Two threads modifying the same element still need to synchronize
+**
+**  Elements are never removed one at a time (there's no pop_back() or erase()), but clear() removes them all at once.
+**
+**  A reserved index can't be handed back, later indexes may already be taken.  So an element that might fail to construct is
+**  constructed aside first and then moved into its slot, which can't throw.  Only if T can't be moved without throwing either
+**  is it constructed in place, and should that throw the slot gets a value-initialized T instead (the exception still reaches
+**  the caller).  Either way, every published slot holds an element.
+***********************************************************************************************************************************/
+module;                                                                   // Global fragment (not part of the module)
+  // Empty
+
+
+
+
+/***********************************************************************************************************************************
+**  Module CSUF.CPSC131.ConcurrentVector Interface
+**
+***********************************************************************************************************************************/
+export module CSUF.CPSC131.ConcurrentVector;                              // Primary Module Interface Definition
+import std;
+import CSUF.CPSC131.exceptionString;
+
+
+export namespace CSUF::CPSC131
+{
+  // Template Class Definition - ConcurrentVector's Abstract Data Type Interface:
+  template<typename T>
+  class ConcurrentVector
+  {
+    template<typename U>
+    friend void swap( ConcurrentVector<U> & lhs,  ConcurrentVector<U> & rhs ) noexcept;
+
+    template<typename U> class Iterator_type;                             // Template class for iterator and const_iterator classes
+
+    public:
+      // Types
+      using iterator       = Iterator_type<T      >;                      // A random access iterator to a read-write element
+      using const_iterator = Iterator_type<T const>;                      // A random access iterator to a read-only element
+
+
+      // Constructors, destructor, and assignments
+      ConcurrentVector            (                                    ) noexcept = default;
+      ConcurrentVector            ( ConcurrentVector const   & original );         // Copies the elements published so far
+      ConcurrentVector            ( ConcurrentVector        && original ) noexcept;
+      ConcurrentVector            ( std::initializer_list<T>   init_list );
+      ConcurrentVector & operator=( ConcurrentVector const   & rhs      );
+      ConcurrentVector & operator=( ConcurrentVector        && rhs      ) noexcept;
+     ~ConcurrentVector            (                                    ) noexcept;
+
+
+      // Queries - safe to call concurrently with appends
+      std::size_t size    () const noexcept;                              // Number of published elements.  Every element in [0, size()) is fully constructed
+      std::size_t capacity() const noexcept;                              // Number of elements the blocks allocated so far hold
+      bool        empty   () const noexcept;
+
+
+      // Iterators - safe to use concurrently with appends.  end() marks size() as it was when end() was called, elements
+      // published later aren't visited
+      iterator       begin ()       noexcept;
+      iterator       end   ()       noexcept;
+      const_iterator begin () const noexcept;
+      const_iterator end   () const noexcept;
+      const_iterator cbegin() const noexcept;
+      const_iterator cend  () const noexcept;
+
+
+      // Accessors - wait-free and safe to call concurrently with appends
+      T const & at        ( std::size_t index ) const;                    // Checks index against size(), throws std::out_of_range
+      T       & at        ( std::size_t index );                          // Checks index against size(), throws std::out_of_range
+      T const & operator[]( std::size_t index ) const;                    // No bounds checking.  Index must be less than a size() already observed
+      T       & operator[]( std::size_t index );                          // No bounds checking.  Index must be less than a size() already observed
+
+      T const & front() const;                                            // Checks size, throws std::range_error
+      T       & front();                                                  // Checks size, throws std::range_error
+      T const & back () const;                                            // The last element published so far.  Checks size, throws std::range_error
+      T       & back ();                                                  // The last element published so far.  Checks size, throws std::range_error
+
+
+      // Modifiers - safe to call concurrently with each other and everything above
+      std::size_t push_back( T const  & value );                          // Returns the index value landed at
+      std::size_t push_back( T       && value );                          // Returns the index value landed at
+
+      template<typename... Args>
+      T &  emplace_back( Args &&... args );                               // Constructs the new element in place, returns a reference that stays valid until clear()
+
+      void reserve( std::size_t newCapacity );                            // Allocates the blocks needed up front, so appends don't have to
+
+
+      // Modifiers - no other thread may use the vector at the same time
+      void clear() noexcept;                                              // Sets size() to zero.  capacity() is unchanged
+
+
+      // Relational Operators - compare snapshots, safe to call concurrently with appends
+      std::weak_ordering operator<=>( ConcurrentVector const & rhs ) const;
+      bool               operator== ( ConcurrentVector const & rhs ) const;
+
+
+
+    private:
+      // Each slot holds enough raw memory for one element (see Vector's RawMemory), plus its state.  Slots are handed out
+      // RESERVED and become CONSTRUCTED once the element is there.  A slot is never published empty, see append().
+      using RawMemory = struct alignas(T) {std::byte bytes[sizeof(T)]; };
+      enum class SlotState : unsigned char { RESERVED, CONSTRUCTED };
+      struct Slot
+      {
+        RawMemory              raw;
+        std::atomic<SlotState> state = SlotState::RESERVED;
+      };
+
+      // Block b holds FIRST_BLOCK * 2^b slots, and starts at index FIRST_BLOCK * (2^b - 1).  There are enough blocks to index
+      // all of std::size_t, but a block is allocated only when the first index in it is reserved (or reserve() asks for it).
+      static constexpr std::size_t FIRST_BLOCK = 16;
+      static constexpr std::size_t MAX_BLOCKS  = std::numeric_limits<std::size_t>::digits - std::countr_zero( FIRST_BLOCK );
+      static_assert( std::has_single_bit( FIRST_BLOCK ), "Block sizes must be powers of two" );
+
+      // Attributes
+      std::array<std::atomic<Slot *>, MAX_BLOCKS> _blocks    = {};        // nullptr until allocated, never moved once allocated
+      std::atomic<std::size_t>                    _reserved  = 0;         // Number of slots handed out
+      std::atomic<std::size_t>                    _published = 0;         // Number of leading slots no longer RESERVED.  This is size()
+
+      // Helper functions
+      static std::size_t blockOf    ( std::size_t index ) noexcept;       // Which block index is in
+      static std::size_t blockStart ( std::size_t block ) noexcept;       // First index in block
+      static std::size_t blockLength( std::size_t block ) noexcept;       // Number of slots in block
+
+      Slot * allocateBlock( std::size_t block );                          // The block, allocating it if no other thread has yet
+      Slot & slot         ( std::size_t index ) const noexcept;           // The slot at index, its block must already be allocated
+      void   publish      (                   ) noexcept;                 // Advances _published over the slots no longer RESERVED
+
+      template<typename... Args>
+      std::size_t append( Args &&... args );                              // Reserves a slot, constructs an element there, and publishes it.  Returns the index
+  };
+
+
+
+
+  // ConcurrentVector's iterators are an index into a vector.  Unlike a pointer, an index doesn't care which block the element is
+  // in, so stepping from one block to the next needs no special handling.
+  template<typename T>
+  template<typename U>
+  class ConcurrentVector<T>::Iterator_type
+  {
+    friend class ConcurrentVector<T>;
+    using Container = std::conditional_t<std::is_const_v<U>, ConcurrentVector<T> const, ConcurrentVector<T>>;
+
+    public:
+      // Iterator Type Traits - Boilerplate stuff so the iterator can be used with the rest of the standard library
+      using iterator_category = std::random_access_iterator_tag;
+      using value_type        = std::remove_const_t<U>;
+      using difference_type   = std::ptrdiff_t;
+      using pointer           = U *;
+      using reference         = U &;
+
+      Iterator_type(                        ) = default;                  // Singular, don't use until assigned
+      Iterator_type( iterator const & other ) : _vector{ other._vector }, _index{ other._index } {}   // Copy constructor when U is non-const, Conversion constructor from non-const to const iterator when U is const
+
+      // Dereferencing and member access operators
+      reference operator* (                        ) const { return (*_vector)[_index];     }
+      pointer   operator->(                        ) const { return &**this;                }
+      reference operator[]( difference_type offset ) const { return *(*this + offset);      }
+
+      // Arithmetic operators move the position by offset elements
+      Iterator_type & operator++(     )  { ++_index;  return *this; }
+      Iterator_type   operator++( int )  { auto temp = *this;  ++_index;  return temp; }
+      Iterator_type & operator--(     )  { --_index;  return *this; }
+      Iterator_type   operator--( int )  { auto temp = *this;  --_index;  return temp; }
+
+      Iterator_type & operator+=( difference_type offset )  { _index += static_cast<std::size_t>( offset );  return *this; }
+      Iterator_type & operator-=( difference_type offset )  { _index -= static_cast<std::size_t>( offset );  return *this; }
+
+      friend Iterator_type   operator+( Iterator_type i,  difference_type offset )  { return i += offset; }
+      friend Iterator_type   operator+( difference_type offset,  Iterator_type i )  { return i += offset; }
+      friend Iterator_type   operator-( Iterator_type i,  difference_type offset )  { return i -= offset; }
+      friend difference_type operator-( Iterator_type const & lhs,  Iterator_type const & rhs )
+      { return static_cast<difference_type>( lhs._index ) - static_cast<difference_type>( rhs._index ); }
+
+      // Relational operators, only meaningful for iterators into the same vector
+      bool                 operator== ( Iterator_type const & rhs ) const  { return _index ==  rhs._index; }
+      std::strong_ordering operator<=>( Iterator_type const & rhs ) const  { return _index <=> rhs._index; }
+
+    private:
+      Iterator_type( Container * vector,  std::size_t index ) : _vector{ vector }, _index{ index } {}
+
+      Container * _vector = nullptr;
+      std::size_t _index  = 0;
+  };  // ConcurrentVector<T>::Iterator_type
+}    // export namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// Not exported but reachable
+/***********************************************************************************************************************************
+************************************************************************************************************************************
+** Implementation
+************************************************************************************************************************************
+***********************************************************************************************************************************/
+namespace CSUF::CPSC131
+{
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Constructors, destructor, and assignments
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // Copy construction
+  template<typename T>
+  ConcurrentVector<T>::ConcurrentVector( ConcurrentVector const & original )
+    : ConcurrentVector()                                                  // Once delegated to, the destructor cleans up should a copy throw
+  {
+    // Only what's been published is copied, original may well be growing while we copy
+    auto const extent = original.size();
+    reserve( extent );
+    for( std::size_t i = 0;  i < extent;  ++i )   emplace_back( original[i] );
+  }
+
+
+
+
+  // Move construction
+  template<typename T>
+  ConcurrentVector<T>::ConcurrentVector( ConcurrentVector && original ) noexcept
+  { swap( *this, original ); }                                            // Starting empty, trade places with original
+
+
+
+
+  // Initialization List construction
+  template<typename T>
+  ConcurrentVector<T>::ConcurrentVector( std::initializer_list<T> init_list )
+    : ConcurrentVector()
+  {
+    reserve( init_list.size() );
+    for( auto && value : init_list )   emplace_back( value );
+  }
+
+
+
+
+  // Copy assignment
+  template<typename T>
+  ConcurrentVector<T> & ConcurrentVector<T>::operator=( ConcurrentVector const & rhs )
+  {
+    if( this != &rhs )
+    {
+      ConcurrentVector temp( rhs );                                       // Copy-and-swap - should the copy throw, *this is unchanged
+      swap( *this, temp );
+    }
+    return *this;
+  }
+
+
+
+
+  // Move assignment
+  template<typename T>
+  ConcurrentVector<T> & ConcurrentVector<T>::operator=( ConcurrentVector && rhs ) noexcept
+  {
+    if( this != &rhs )   swap( *this, rhs );                              // rhs leaves with what we had and releases it when it goes
+    return *this;
+  }
+
+
+
+
+  // Destruction
+  template<typename T>
+  ConcurrentVector<T>::~ConcurrentVector() noexcept
+  {
+    clear();                                                              // Destroy the elements, then
+    for( auto & block : _blocks )   delete[] block.load();                // give the blocks back (deleting nullptr is fine)
+  }
+
+
+
+
+
+
+
+
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Queries
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // size()
+  template<typename T>
+  std::size_t ConcurrentVector<T>::size() const noexcept
+  { return _published.load(); }
+
+
+
+
+  // capacity()
+  template<typename T>
+  std::size_t ConcurrentVector<T>::capacity() const noexcept
+  {
+    // Blocks are allocated in order, so the first one missing marks the end of the capacity
+    std::size_t block = 0;
+    while( block < MAX_BLOCKS  &&  _blocks[block].load() != nullptr )   ++block;
+    return blockStart( block );
+  }
+
+
+
+
+  // empty()
+  template<typename T>
+  bool ConcurrentVector<T>::empty() const noexcept
+  { return size() == 0; }
+
+
+
+
+
+
+
+
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Iterators
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  template<typename T>   typename ConcurrentVector<T>::iterator       ConcurrentVector<T>::begin ()       noexcept { return iterator      ( this, 0      ); }
+  template<typename T>   typename ConcurrentVector<T>::iterator       ConcurrentVector<T>::end   ()       noexcept { return iterator      ( this, size() ); }
+  template<typename T>   typename ConcurrentVector<T>::const_iterator ConcurrentVector<T>::begin () const noexcept { return const_iterator( this, 0      ); }
+  template<typename T>   typename ConcurrentVector<T>::const_iterator ConcurrentVector<T>::end   () const noexcept { return const_iterator( this, size() ); }
+  template<typename T>   typename ConcurrentVector<T>::const_iterator ConcurrentVector<T>::cbegin() const noexcept { return begin();                      }
+  template<typename T>   typename ConcurrentVector<T>::const_iterator ConcurrentVector<T>::cend  () const noexcept { return end();                        }
+
+
+
+
+
+
+
+
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Accessors
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // operator[] const
+  template<typename T>
+  T const & ConcurrentVector<T>::operator[]( std::size_t index ) const
+  { return *std::launder( reinterpret_cast<T const *>( &slot( index ).raw ) ); }
+
+
+
+
+  // operator[]
+  template<typename T>
+  T & ConcurrentVector<T>::operator[]( std::size_t index )
+  { return const_cast<T &>( std::as_const( *this )[index] ); }            // Delegate to the const version, the element itself isn't const
+
+
+
+
+  // at() const
+  template<typename T>
+  T const & ConcurrentVector<T>::at( std::size_t index ) const
+  {
+    auto const extent = size();
+    if( index >= extent )   throw std::out_of_range( exceptionString( std::format( "index ({}) over indexes vector's size ({})", index, extent ) ) );
+    return (*this)[index];
+  }
+
+
+
+
+  // at()
+  template<typename T>
+  T & ConcurrentVector<T>::at( std::size_t index )
+  { return const_cast<T &>( std::as_const( *this ).at( index ) ); }
+
+
+
+
+  // front() const
+  template<typename T>
+  T const & ConcurrentVector<T>::front() const
+  {
+    if( empty() )   throw std::range_error( exceptionString( "Attempt to access data from an empty vector" ) );
+    return (*this)[0];
+  }
+
+
+
+
+  // front()
+  template<typename T>
+  T & ConcurrentVector<T>::front()
+  { return const_cast<T &>( std::as_const( *this ).front() ); }
+
+
+
+
+  // back() const
+  template<typename T>
+  T const & ConcurrentVector<T>::back() const
+  {
+    auto const extent = size();                                           // Look once, size() may change between two looks
+    if( extent == 0 )   throw std::range_error( exceptionString( "Attempt to access data from an empty vector" ) );
+    return (*this)[extent - 1];
+  }
+
+
+
+
+  // back()
+  template<typename T>
+  T & ConcurrentVector<T>::back()
+  { return const_cast<T &>( std::as_const( *this ).back() ); }
+
+
+
+
+
+
+
+
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Modifiers
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // push_back() - copy
+  template<typename T>
+  std::size_t ConcurrentVector<T>::push_back( T const & value )
+  { return append( value ); }
+
+
+
+
+  // push_back() - move
+  template<typename T>
+  std::size_t ConcurrentVector<T>::push_back( T && value )
+  { return append( std::move( value ) ); }
+
+
+
+
+  // emplace_back()
+  template<typename T>
+  template<typename... Args>
+  T & ConcurrentVector<T>::emplace_back( Args &&... args )
+  { return (*this)[ append( std::forward<Args>( args )... ) ]; }          // Ours to return even if not yet published, the slot is constructed and stays put
+
+
+
+
+  // reserve()
+  template<typename T>
+  void ConcurrentVector<T>::reserve( std::size_t newCapacity )
+  {
+    // Allocate blocks in order, exactly as appending would, until there's room for newCapacity elements
+    for( std::size_t block = 0;  block < MAX_BLOCKS  &&  blockStart( block ) < newCapacity;  ++block )   allocateBlock( block );
+  }
+
+
+
+
+  // clear()
+  template<typename T>
+  void ConcurrentVector<T>::clear() noexcept
+  {
+    // Nobody else is using the vector, so there's nothing still RESERVED:  every slot handed out holds a published element
+    auto const extent = _reserved.load();
+    for( std::size_t i = 0;  i < extent;  ++i )
+    {
+      auto & current = slot( i );
+      std::destroy_at( std::launder( reinterpret_cast<T *>( &current.raw ) ) );
+      current.state.store( SlotState::RESERVED );                         // Ready to be handed out again
+    }
+    _reserved .store( 0 );
+    _published.store( 0 );
+  }
+
+
+
+
+  // append()
+  template<typename T>
+  template<typename... Args>
+  std::size_t ConcurrentVector<T>::append( Args &&... args )
+  {
+    // Once reserved, an index is published no matter what, and size() promises every published slot holds an element.  So if
+    // constructing the element might throw, construct it aside first while nothing has been reserved yet, and then move it into
+    // its slot, which can't throw.
+    if constexpr( !std::is_nothrow_constructible_v<T, Args &&...>  &&  std::is_nothrow_move_constructible_v<T> )
+    {
+      T element( std::forward<Args>( args )... );
+      return append( std::move( element ) );
+    }
+    else
+    {
+      // 1) Reserve the next index.  Its block must exist before the index is handed out, otherwise a failed allocation would leave
+      //    behind a reserved index with no slot and the publishing below would wait on it forever.  So look at the next index,
+      //    make sure its block is there, and claim the index only if no other thread claimed it in the meantime.  Losing that race
+      //    just means trying the next index - some thread always wins, so appending as a whole always makes progress (lock-free).
+      auto index = _reserved.load();
+      do
+      {
+        if( blockOf( index ) >= MAX_BLOCKS )   throw std::overflow_error( exceptionString( "Concurrent vectors cannot grow beyond the size of memory" ) );
+        allocateBlock( blockOf( index ) );
+      } while( !_reserved.compare_exchange_weak( index, index + 1 ) );   // On failure, index is reloaded with the current count
+
+      // 2) Construct the element.  Other threads are busy with their own slots, nobody else touches this one.
+      auto & destination = slot( index );
+      auto   element     = reinterpret_cast<T *>( &destination.raw );
+      if constexpr( std::is_nothrow_constructible_v<T, Args &&...> )   std::construct_at( element, std::forward<Args>( args )... );
+      else
+      {
+        // T can't be moved without throwing, so it's constructed in place.  Should that throw, the slot still has to be published
+        // (the elements after it wait on it) and must hold an element, so it gets a value-initialized one
+        static_assert( std::is_nothrow_default_constructible_v<T>, "Elements must be nothrow move or nothrow default constructible" );
+        try
+        {
+          std::construct_at( element, std::forward<Args>( args )... );
+        }
+        catch( ... )
+        {
+          std::construct_at( element );
+          destination.state.store( SlotState::CONSTRUCTED );
+          publish();
+          throw;
+        }
+      }
+
+      // 3) Publish it
+      destination.state.store( SlotState::CONSTRUCTED );
+      publish();
+      return index;
+    }
+  }
+
+
+
+
+  // publish()
+  template<typename T>
+  void ConcurrentVector<T>::publish() noexcept
+  {
+    // Elements finish constructing in any order, but size() may only cover an unbroken run of finished slots.  Every thread that
+    // finishes a slot helps move _published forward over every finished slot it finds, its own or anyone else's, and stops at
+    // the first one still under construction.  For example, threads finishing slots 3 and then 2:
+    //
+    //          published                        published                               published
+    //              v                                v                                       v
+    //   +---+---+---+---+---+       +---+---+---+---+---+               +---+---+---+---+---+
+    //   | C | C | R | C | R |       | C | C | C | C | R |               | C | C | C | C | R |        C = CONSTRUCTED
+    //   +---+---+---+---+---+       +---+---+---+---+---+               +---+---+---+---+---+        R = RESERVED
+    //   slot 3 done, blocked         slot 2 done, ...                   ... and moves past 3 too
+    //
+    // Whoever finishes the blocking slot moves _published past it, so no finished slot is ever left behind.  (The state stores
+    // and these loads are sequentially consistent:  either the thread finishing slot 3 sees _published reach 3, or the thread
+    // finishing slot 2 sees slot 3 finished.)  The compare-and-exchange keeps two helpers from both counting the same slot.
+    auto published = _published.load();
+    while( published < _reserved.load()  &&  slot( published ).state.load() != SlotState::RESERVED )
+    {
+      if( _published.compare_exchange_weak( published, published + 1 ) )   ++published;   // On failure, published is reloaded
+    }
+  }
+
+
+
+
+
+
+
+
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Private Helpers
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // blockOf()
+  template<typename T>
+  std::size_t ConcurrentVector<T>::blockOf( std::size_t index ) noexcept
+  {
+    // Block b starts at FIRST_BLOCK * (2^b - 1), so index / FIRST_BLOCK + 1 lies in [2^b, 2^(b+1)) and b is its highest bit
+    return static_cast<std::size_t>( std::bit_width( index / FIRST_BLOCK + 1 ) ) - 1;
+  }
+
+
+
+
+  // blockStart()
+  template<typename T>
+  std::size_t ConcurrentVector<T>::blockStart( std::size_t block ) noexcept
+  { return FIRST_BLOCK * ( (std::size_t{ 1 } << block) - 1 ); }
+
+
+
+
+  // blockLength()
+  template<typename T>
+  std::size_t ConcurrentVector<T>::blockLength( std::size_t block ) noexcept
+  { return FIRST_BLOCK << block; }
+
+
+
+
+  // allocateBlock()
+  template<typename T>
+  typename ConcurrentVector<T>::Slot * ConcurrentVector<T>::allocateBlock( std::size_t block )
+  {
+    // Several threads may find the same block missing and each allocate one, but only the first to install theirs wins.  The
+    // others give theirs back and use the winner's.  No thread ever waits on another.
+    Slot * existing = _blocks[block].load();
+    if( existing != nullptr )   return existing;
+
+    Slot * fresh = new Slot[ blockLength( block ) ];                      // Raw memory for the elements, every slot RESERVED
+    if( _blocks[block].compare_exchange_strong( existing, fresh ) )   return fresh;
+
+    delete[] fresh;                                                       // Somebody beat us to it
+    return existing;                                                      // On failure, existing was loaded with the winner's block
+  }
+
+
+
+
+  // slot()
+  template<typename T>
+  typename ConcurrentVector<T>::Slot & ConcurrentVector<T>::slot( std::size_t index ) const noexcept
+  {
+    auto const block = blockOf( index );
+    return _blocks[block].load()[ index - blockStart( block ) ];
+  }
+
+
+
+
+
+
+
+
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Relational Operators
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // operator<=>
+  template<typename T>
+  std::weak_ordering ConcurrentVector<T>::operator<=>( ConcurrentVector const & rhs ) const
+  { return std::lexicographical_compare_three_way( begin(), end(), rhs.begin(), rhs.end(), std::compare_weak_order_fallback ); }
+
+
+
+
+  // operator==
+  template<typename T>
+  bool ConcurrentVector<T>::operator==( ConcurrentVector const & rhs ) const
+  { return std::ranges::equal( *this, rhs ); }
+
+
+
+
+
+
+
+
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Non-member functions
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // swap()
+  template<typename T>
+  void swap( ConcurrentVector<T> & lhs,  ConcurrentVector<T> & rhs ) noexcept
+  {
+    // Atomics can't be copied or swapped, only loaded and stored.  That's all right, nobody else may be using either vector now.
+    for( std::size_t block = 0;  block < ConcurrentVector<T>::MAX_BLOCKS;  ++block )   lhs._blocks[block].store( rhs._blocks[block].exchange( lhs._blocks[block].load() ) );
+    lhs._reserved .store( rhs._reserved .exchange( lhs._reserved .load() ) );
+    lhs._published.store( rhs._published.exchange( lhs._published.load() ) );
+  }
+}    // namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+** (C) Copyright 2025 by Thomas Bettens. All Rights Reserved.
+**
+** DISCLAIMER: The participating authors at California State University's Computer Science Department have used their best efforts
+** in preparing this code. These efforts include the development, research, and testing of the theories and programs to determine
+** their effectiveness. The authors make no warranty of any kind, expressed or implied, with regard to these programs or to the
+** documentation contained within. The authors shall not be liable in any event for incidental or consequential damages in
+** connection with, or arising out of, the furnishing, performance, or use of these libraries and programs.  Distribution without
+** written consent from the authors is prohibited.
+***********************************************************************************************************************************/
+
+/**************************************************
+** Last modified:  27-JUL-2025 (Converted to C++ Modules)
+** Last Verified:  27-JUL-2025
+** Verified with:  MS Visual Studio 2022 Version 17.14.9,  Compiler Version 19.44.35213 (/std:c++latest)
+**                 GCC version 15.1.0 (-std=c++23 )
+**                 Clang version 21.0.0 (-std=c++23 -stdlib=libc++)
+***************************************************/
@@ -0,0 +1 @@
+../../Common/CountingResource.cppm
\ No newline at end of file
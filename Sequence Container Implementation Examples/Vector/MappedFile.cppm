@@ -0,0 +1,307 @@
+/***********************************************************************************************************************************
+** Memory mapped files
+**
+**  Mapping a file into memory lets a program use the file's bytes as if they were an ordinary array.  Nothing is read up front,
+**  the operating system pages the file in as it's touched and writes modified pages back to the file on its own schedule (or
+**  when asked to with flush() and sync()).  Processes mapping the same file share the very same pages in the operating system's
+**  page cache, so a large data set opened by many processes occupies physical memory only once.
+**
+**  A MappedFile owns one mapping, and is one of:
+**    1) Nothing at all (default constructed, or moved from)
+**    2) A file mapped READ_WRITE:  changes are written through to the file, and the file grows and shrinks with resize()
+**    3) A file mapped READ_ONLY:   the file is never modified.  Pages are copy-on-write, so changes stay private to this process
+**    4) Anonymous memory:  mapped memory not backed by any file (what a READ_ONLY mapping becomes when it's resized)
+**
+**  Memory mapping is provided through the POSIX interface (Linux, macOS, BSD, WSL, ...).  Elsewhere, mapping a file throws.
+***********************************************************************************************************************************/
+module;                                                                               // Global fragment (not part of the module)
+  #if __has_include( <sys/mman.h> )
+    #define CSUF_CPSC131_HAS_MMAP 1
+    #include <sys/mman.h>                                                             // mmap(), munmap(), msync()
+    #include <sys/stat.h>                                                             // fstat()
+    #include <fcntl.h>                                                                // open()
+    #include <unistd.h>                                                               // ftruncate(), fsync(), close()
+    #include <cerrno>
+  #else
+    #define CSUF_CPSC131_HAS_MMAP 0
+  #endif
+
+
+
+
+/***********************************************************************************************************************************
+**  Module CSUF.CPSC131.MappedFile Interface
+**
+***********************************************************************************************************************************/
+export module CSUF.CPSC131.MappedFile;                                               // Primary Module Interface Definition
+import std;
+import CSUF.CPSC131.exceptionString;
+
+
+export namespace CSUF::CPSC131
+{
+  enum class MapMode { READ_WRITE, READ_ONLY };
+
+
+
+  class MappedFile
+  {
+    public:
+      // Constructors, destructor, and assignments
+      MappedFile            (                                                  ) noexcept = default;   // Nothing mapped
+      explicit MappedFile   ( std::size_t bytes                                );  // Anonymous, zero filled memory
+      MappedFile            ( std::filesystem::path const & path,  MapMode mode );  // The whole file.  READ_WRITE creates the file if it doesn't exist
+      MappedFile            ( MappedFile && donor                              ) noexcept;
+      MappedFile & operator=( MappedFile && rhs                                ) noexcept;
+     ~MappedFile            (                                                  ) noexcept;
+
+      MappedFile            ( MappedFile const & ) = delete;              // A mapping has exactly one owner
+      MappedFile & operator=( MappedFile const & ) = delete;
+
+      // Queries
+      std::byte * data         () const noexcept { return _data;  }       // nullptr if nothing is mapped
+      std::size_t size         () const noexcept { return _bytes; }       // In bytes
+      bool        writesThrough() const noexcept { return _file != -1  &&  _mode == MapMode::READ_WRITE; }  // True if changes end up in a file
+
+      // Modifiers
+      void resize( std::size_t bytes );                                   // Keeps the first min(size(), bytes) bytes, newly added bytes are zero
+      void flush ();                                                      // Schedules modified pages to be written to the file, returns right away
+      void sync  ();                                                      // Writes modified pages to the file, returns once they're stored
+
+    private:
+      void release() noexcept;                                            // Unmaps and closes, leaving nothing mapped
+
+      std::byte * _data  = nullptr;
+      std::size_t _bytes = 0;
+      int         _file  = -1;                                            // File descriptor, -1 if not backed by a file
+      MapMode     _mode  = MapMode::READ_WRITE;
+  };
+}    // export namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// Not exported but reachable
+/***********************************************************************************************************************************
+************************************************************************************************************************************
+** Implementation
+************************************************************************************************************************************
+***********************************************************************************************************************************/
+namespace CSUF::CPSC131
+{
+  #if CSUF_CPSC131_HAS_MMAP
+  // Maps bytes of the file (or anonymous memory if file is -1), throws std::system_error
+  inline std::byte * mapMemory( std::size_t bytes,  int file,  MapMode mode )
+  {
+    int const flags = file == -1                ?  MAP_PRIVATE | MAP_ANONYMOUS
+                    : mode == MapMode::READ_ONLY ?  MAP_PRIVATE                          // Copy-on-write, the file is never changed
+                    :                               MAP_SHARED;                          // Changes are written through to the file
+
+    void * memory = ::mmap( nullptr, bytes, PROT_READ | PROT_WRITE, flags, file, 0 );
+    if( memory == MAP_FAILED )   throw std::system_error( errno, std::generic_category(), exceptionString( "Unable to map memory" ) );
+    return static_cast<std::byte *>( memory );
+  }
+  #endif
+
+
+
+
+  // Anonymous construction
+  inline MappedFile::MappedFile( std::size_t bytes )
+  {
+    #if CSUF_CPSC131_HAS_MMAP
+      if( bytes > 0 )   _data = mapMemory( bytes, -1, MapMode::READ_WRITE );
+      _bytes = bytes;
+    #else
+      if( bytes > 0 )   throw std::system_error( std::make_error_code( std::errc::function_not_supported ), exceptionString( "Memory mapping is not supported on this platform" ) );
+    #endif
+  }
+
+
+
+
+  // File construction
+  inline MappedFile::MappedFile( std::filesystem::path const & path,  MapMode mode )
+    : _mode{ mode }
+  {
+    #if CSUF_CPSC131_HAS_MMAP
+      _file = ::open( path.c_str(), mode == MapMode::READ_ONLY ? O_RDONLY : O_RDWR | O_CREAT, 0644 );
+      if( _file == -1 )   throw std::system_error( errno, std::generic_category(), exceptionString( "Unable to open \"" + path.string() + '"' ) );
+
+      struct ::stat status;
+      if( ::fstat( _file, &status ) == -1 )
+      {
+        auto const error = errno;
+        release();
+        throw std::system_error( error, std::generic_category(), exceptionString( "Unable to size \"" + path.string() + '"' ) );
+      }
+
+      _bytes = static_cast<std::size_t>( status.st_size );
+      try
+      {
+        if( _bytes > 0 )   _data = mapMemory( _bytes, _file, _mode );           // Nothing to map in an empty file
+      }
+      catch( ... )
+      {
+        release();
+        throw;
+      }
+    #else
+      throw std::system_error( std::make_error_code( std::errc::function_not_supported ), exceptionString( "Memory mapping is not supported on this platform, unable to map \"" + path.string() + '"' ) );
+    #endif
+  }
+
+
+
+
+  // Move construction
+  inline MappedFile::MappedFile( MappedFile && donor ) noexcept
+    : _data { std::exchange( donor._data,  nullptr ) },
+      _bytes{ std::exchange( donor._bytes, 0       ) },
+      _file { std::exchange( donor._file,  -1      ) },
+      _mode { donor._mode                            }
+  {}
+
+
+
+
+  // Move assignment
+  inline MappedFile & MappedFile::operator=( MappedFile && rhs ) noexcept
+  {
+    if( this != &rhs )
+    {
+      release();
+      _data  = std::exchange( rhs._data,  nullptr );
+      _bytes = std::exchange( rhs._bytes, 0       );
+      _file  = std::exchange( rhs._file,  -1      );
+      _mode  = rhs._mode;
+    }
+    return *this;
+  }
+
+
+
+
+  // Destruction
+  inline MappedFile::~MappedFile() noexcept
+  { release(); }
+
+
+
+
+  // resize()
+  inline void MappedFile::resize( std::size_t bytes )
+  {
+    #if CSUF_CPSC131_HAS_MMAP
+      if( bytes == _bytes )   return;
+
+      if( writesThrough() )
+      {
+        // The bytes are in the file, so change the file's length and map it again.  The new mapping is made before the old one
+        // is released so that if it fails, nothing is lost.
+        if( bytes > _bytes  &&  ::ftruncate( _file, static_cast<::off_t>( bytes ) ) == -1 )   throw std::system_error( errno, std::generic_category(), exceptionString( "Unable to grow the mapped file" ) );
+
+        std::byte * newData = bytes > 0  ?  mapMemory( bytes, _file, _mode )  :  nullptr;
+        if( _data != nullptr )   ::munmap( _data, _bytes );
+        _data  = newData;
+
+        if( bytes < _bytes )   (void) ::ftruncate( _file, static_cast<::off_t>( bytes ) );   // Should this fail, the file is just longer than it needs to be
+        _bytes = bytes;
+      }
+
+      else
+      {
+        // Anonymous memory (and private copies of read-only files) have nowhere else to keep the bytes, so copy them to a new
+        // anonymous mapping.  A read-only file is left behind, from here on the mapping is anonymous.
+        MappedFile resized( bytes );
+        if( _data != nullptr  &&  bytes > 0 )   std::memcpy( resized._data, _data, std::min( bytes, _bytes ) );
+        *this = std::move( resized );
+      }
+    #else
+      if( bytes > 0 )   throw std::system_error( std::make_error_code( std::errc::function_not_supported ), exceptionString( "Memory mapping is not supported on this platform" ) );
+    #endif
+  }
+
+
+
+
+  // flush()
+  inline void MappedFile::flush()
+  {
+    #if CSUF_CPSC131_HAS_MMAP
+      if( writesThrough()  &&  _data != nullptr  &&  ::msync( _data, _bytes, MS_ASYNC ) == -1 )   throw std::system_error( errno, std::generic_category(), exceptionString( "Unable to flush the mapped file" ) );
+    #endif
+  }
+
+
+
+
+  // sync()
+  inline void MappedFile::sync()
+  {
+    #if CSUF_CPSC131_HAS_MMAP
+      if( !writesThrough() )   return;
+      if( _data != nullptr  &&  ::msync( _data, _bytes, MS_SYNC ) == -1 )   throw std::system_error( errno, std::generic_category(), exceptionString( "Unable to sync the mapped file" ) );
+      if( ::fsync( _file ) == -1 )                                          throw std::system_error( errno, std::generic_category(), exceptionString( "Unable to sync the mapped file" ) );  // The file's length too
+    #endif
+  }
+
+
+
+
+  // release()
+  inline void MappedFile::release() noexcept
+  {
+    #if CSUF_CPSC131_HAS_MMAP
+      if( _data != nullptr )   ::munmap( _data, _bytes );                 // Modified pages of a shared mapping still reach the file eventually
+      if( _file != -1      )   ::close( _file );
+    #endif
+    _data  = nullptr;
+    _bytes = 0;
+    _file  = -1;
+  }
+}    // namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+** (C) Copyright 2025 by Thomas Bettens. All Rights Reserved.
+**
+** DISCLAIMER: The participating authors at California State University's Computer Science Department have used their best efforts
+** in preparing this code. These efforts include the development, research, and testing of the theories and programs to determine
+** their effectiveness. The authors make no warranty of any kind, expressed or implied, with regard to these programs or to the
+** documentation contained within. The authors shall not be liable in any event for incidental or consequential damages in
+** connection with, or arising out of, the furnishing, performance, or use of these libraries and programs.  Distribution without
+** written consent from the authors is prohibited.
+***********************************************************************************************************************************/
+
+/**************************************************
+** Last modified:  27-JUL-2025 (Converted to C++ Modules)
+** Last Verified:  27-JUL-2025
+** Verified with:  MS Visual Studio 2022 Version 17.14.9,  Compiler Version 19.44.35213 (/std:c++latest)
+**                 GCC version 15.1.0 (-std=c++23 )
+**                 Clang version 21.0.0 (-std=c++23 -stdlib=libc++)
+***************************************************/
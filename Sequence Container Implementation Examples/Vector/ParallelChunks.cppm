@@ -0,0 +1,254 @@
+/***********************************************************************************************************************************
+** Chunked parallel execution over contiguous storage
+**
+**  Elements stored contiguously (vectors, arrays, spans) split naturally into contiguous pieces, or chunks, that can be worked on
+**  independently.  Give each thread one chunk and a bulk operation (copy, fill, transform, sort) finishes in a fraction of the
+**  time - as long as there's enough work to pay for starting the threads.  Below a threshold, everything simply stays on the
+**  calling thread.
+**
+**  Usage:
+**     CSUF::CPSC131::parallel::Execution  eightWays{ .threads = 8 };
+**     CSUF::CPSC131::Vector<double>       snapshot( bigVector, eightWays );          // Copy constructs a chunk per thread
+**     CSUF::CPSC131::parallel::sort     ( snapshot, eightWays );
+**     CSUF::CPSC131::parallel::transform( snapshot, []( double x ) { return x * 2; }, eightWays );
+**     CSUF::CPSC131::parallel::for_each_chunk( snapshot, eightWays, []( std::span<double> chunk ) { ... } );
+***********************************************************************************************************************************/
+module;                                                                               // Global fragment (not part of the module)
+  // Empty
+
+
+
+
+/***********************************************************************************************************************************
+**  Module CSUF.CPSC131.ParallelChunks Interface
+**
+***********************************************************************************************************************************/
+export module CSUF.CPSC131.ParallelChunks;                                           // Primary Module Interface Definition
+import std;
+
+
+export namespace CSUF::CPSC131::parallel
+{
+  // How to split up the work
+  struct Execution
+  {
+    std::size_t threads   = 0;                                            // Most threads to use, including the calling thread.  Zero means one per hardware thread
+    std::size_t threshold = 100'000;                                      // Fewer elements than this aren't worth starting threads for
+
+    std::size_t chunks( std::size_t count ) const noexcept;               // How many chunks count elements are split into, zero when count is zero
+  };
+
+
+
+  // One contiguous piece of [0, count), where chunk index's elements are [first, last)
+  struct Chunk
+  {
+    std::size_t index = 0;
+    std::size_t first = 0;
+    std::size_t last  = 0;
+  };
+
+
+
+  // Calls work( Chunk ) once per chunk of [0, count), each on its own thread with the calling thread taking the last chunk itself.
+  // Returns once every chunk is finished.  If any chunk throws, the others still run to completion and then the exception from
+  // the lowest numbered chunk is rethrown.
+  template<typename Work>
+  void for_each_chunk( std::size_t count,  Execution const & execution,  Work && work );
+
+  // Calls work( std::span<T> ) once per chunk of range's elements
+  template<std::ranges::contiguous_range Range, typename Work>
+  void for_each_chunk( Range && range,  Execution const & execution,  Work && work );
+
+
+
+  // Bulk algorithms, each a chunk per thread
+  template<std::ranges::contiguous_range Range, typename T>
+  void fill     ( Range && range,  T const & value,       Execution const & execution = {} );                // Assigns value to every element
+
+  template<std::ranges::contiguous_range Range, typename Operation>
+  void transform( Range && range,  Operation operation,   Execution const & execution = {} );                // Replaces every element x with operation( x )
+
+  template<std::ranges::contiguous_range Range, typename Compare = std::ranges::less>
+  void sort     ( Range && range,  Execution const & execution = {},  Compare compare = {} );                // Sorts chunks concurrently, then merges them pairwise
+}    // export namespace CSUF::CPSC131::parallel
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// Not exported but reachable
+/***********************************************************************************************************************************
+************************************************************************************************************************************
+** Implementation
+************************************************************************************************************************************
+***********************************************************************************************************************************/
+namespace CSUF::CPSC131::parallel
+{
+  // Execution::chunks()
+  inline std::size_t Execution::chunks( std::size_t count ) const noexcept
+  {
+    if( count == 0         )   return 0;
+    if( count <  threshold )   return 1;                                  // Not enough work to share
+
+    std::size_t const available = threads != 0  ?  threads  :  std::max( std::thread::hardware_concurrency(), 1u );
+    return std::min( available, count );                                  // Never more chunks than elements
+  }
+
+
+
+
+  // chunkAt() - chunk i of count elements split into chunks pieces
+  inline Chunk chunkAt( std::size_t count,  std::size_t chunks,  std::size_t i ) noexcept
+  {
+    // Spread the remainder over the first few chunks so no two chunks differ in length by more than one, for example 10 elements
+    // in 4 chunks:
+    //        +---+---+---+---+---+---+---+---+---+---+
+    //        | 0 | 0 | 0 | 1 | 1 | 1 | 2 | 2 | 3 | 3 |
+    //        +---+---+---+---+---+---+---+---+---+---+
+    auto const length = count / chunks,   longer = count % chunks;
+    return Chunk{ i,  i * length + std::min( i, longer ),  (i + 1) * length + std::min( i + 1, longer ) };
+  }
+
+
+
+
+  // for_each_chunk( count, ... )
+  template<typename Work>
+  void for_each_chunk( std::size_t count,  Execution const & execution,  Work && work )
+  {
+    auto const chunks = execution.chunks( count );
+
+    if( chunks == 0 )   return;
+    if( chunks == 1 )   { work( chunkAt( count, 1, 0 ) );  return; }      // Serial, no threads and no exception juggling
+
+    // An exception can't cross from one thread to another on its own, so each chunk catches its own and the calling thread
+    // rethrows it once everybody's done
+    std::vector<std::exception_ptr> failures( chunks );
+    auto const run = [&]( std::size_t i ) noexcept
+    {
+      try           { work( chunkAt( count, chunks, i ) );     }
+      catch( ... )  { failures[i] = std::current_exception(); }
+    };
+
+    {
+      std::vector<std::jthread> workers;                                  // std::jthread joins when destroyed, even if we leave early
+      workers.reserve( chunks - 1 );
+      for( std::size_t i = 0;  i < chunks - 1;  ++i )   workers.emplace_back( run, i );
+      run( chunks - 1 );                                                  // Don't just sit there, take a share of the work
+    }                                                                     // Wait for the workers to finish
+
+    for( auto const & failure : failures )   if( failure )   std::rethrow_exception( failure );
+  }
+
+
+
+
+  // for_each_chunk( range, ... )
+  template<std::ranges::contiguous_range Range, typename Work>
+  void for_each_chunk( Range && range,  Execution const & execution,  Work && work )
+  {
+    std::span elements( range );                                          // Contiguous ranges (including CSUF::CPSC131::Vector) view as a span
+    for_each_chunk( elements.size(), execution, [&]( Chunk chunk ) { work( elements.subspan( chunk.first, chunk.last - chunk.first ) ); } );
+  }
+
+
+
+
+  // fill()
+  template<std::ranges::contiguous_range Range, typename T>
+  void fill( Range && range,  T const & value,  Execution const & execution )
+  { for_each_chunk( range, execution, [&]( auto chunk ) { std::ranges::fill( chunk, value ); } ); }
+
+
+
+
+  // transform()
+  template<std::ranges::contiguous_range Range, typename Operation>
+  void transform( Range && range,  Operation operation,  Execution const & execution )
+  { for_each_chunk( range, execution, [&]( auto chunk ) { std::ranges::transform( chunk, chunk.begin(), operation ); } ); }
+
+
+
+
+  // sort()
+  template<std::ranges::contiguous_range Range, typename Compare>
+  void sort( Range && range,  Execution const & execution,  Compare compare )
+  {
+    // Sort each chunk on its own thread, then merge neighboring sorted runs pairwise, halving the number of runs each round.  The
+    // merges of a round don't overlap, so they too run concurrently.  For example, 4 chunks:
+    //
+    //     sort:     [ a ]  [ b ]  [ c ]  [ d ]        4 threads
+    //     merge:    [  a + b   ]  [  c + d   ]        2 threads
+    //     merge:    [      a + b + c + d      ]       1 thread
+    std::span  elements( range );
+    auto const chunks = execution.chunks( elements.size() );
+    if( chunks <= 1 )   { std::ranges::sort( elements, compare );  return; }
+
+    for_each_chunk( elements, execution, [&]( auto chunk ) { std::ranges::sort( chunk, compare ); } );
+
+    std::vector<std::size_t> boundaries;                                  // Run i is [boundaries[i], boundaries[i+1]), the same chunks just sorted
+    for( std::size_t i = 0;  i <= chunks;  ++i )   boundaries.push_back( chunkAt( elements.size(), chunks, i ).first );
+
+    while( boundaries.size() > 2 )                                        // More than one run left
+    {
+      auto const pairs = (boundaries.size() - 1) / 2;
+      for_each_chunk( pairs, Execution{ pairs, 1 }, [&]( Chunk chunk )
+      {
+        for( auto pair = chunk.first;  pair != chunk.last;  ++pair )
+        {
+          auto const base = elements.begin();
+          std::inplace_merge( base + boundaries[2*pair], base + boundaries[2*pair + 1], base + boundaries[2*pair + 2], compare );
+        }
+      } );
+
+      std::vector<std::size_t> merged;                                    // Every other boundary disappears, plus the end if it's still needed
+      for( std::size_t i = 0;  i < boundaries.size();  i += 2 )   merged.push_back( boundaries[i] );
+      if( merged.back() != boundaries.back() )   merged.push_back( boundaries.back() );
+      boundaries = std::move( merged );
+    }
+  }
+}    // namespace CSUF::CPSC131::parallel
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+** (C) Copyright 2025 by Thomas Bettens. All Rights Reserved.
+**
+** DISCLAIMER: The participating authors at California State University's Computer Science Department have used their best efforts
+** in preparing this code. These efforts include the development, research, and testing of the theories and programs to determine
+** their effectiveness. The authors make no warranty of any kind, expressed or implied, with regard to these programs or to the
+** documentation contained within. The authors shall not be liable in any event for incidental or consequential damages in
+** connection with, or arising out of, the furnishing, performance, or use of these libraries and programs.  Distribution without
+** written consent from the authors is prohibited.
+***********************************************************************************************************************************/
+
+/**************************************************
+** Last modified:  27-JUL-2025 (Converted to C++ Modules)
+** Last Verified:  27-JUL-2025
+** Verified with:  MS Visual Studio 2022 Version 17.14.9,  Compiler Version 19.44.35213 (/std:c++latest)
+**                 GCC version 15.1.0 (-std=c++23 )
+**                 Clang version 21.0.0 (-std=c++23 -stdlib=libc++)
+***************************************************/
@@ -0,0 +1,645 @@
+/***********************************************************************************************************************************
+** Vectorized (SIMD) search and comparison kernels used by class Vector and class BTree
+**
+**  A scan over contiguous arithmetic elements (find, count, compare, min/max) is limited by how fast memory can be read, not by
+**  how fast it can be examined - provided the examining isn't done one element and one branch at a time.  SIMD (Single
+**  Instruction, Multiple Data) registers hold several elements at once, 16 bytes for SSE2 and 32 bytes for AVX2, and a single
+**  instruction compares every lane.  The lanes' results are then gathered into an ordinary integer bit mask, one bit per byte,
+**  where a zero mask means "nothing interesting here, keep going".
+**
+**  Every x86-64 processor has SSE2, but AVX2 must be asked about at run time.  The answer is looked up once and remembered.  Other
+**  processors (e.g., ARM) get the plain scalar standard algorithms.  The kernels give exactly the same answers the standard
+**  algorithms do, including for floating point NaNs and signed zeros.
+***********************************************************************************************************************************/
+module;                                                                               // Global fragment (not part of the module)
+  #if defined( __x86_64__ ) || defined( _M_X64 )
+    #define CSUF_CPSC131_SIMD_X86 1
+    #include <immintrin.h>                                                            // SSE2 and AVX2 intrinsics
+
+    // GCC and Clang compile a function for the baseline processor unless told otherwise, MSVC lets any function use any
+    // instruction.  Either way, AVX2 instructions are executed only after asking the processor if it has them.
+    #if defined( _MSC_VER ) && !defined( __clang__ )
+      #include <intrin.h>                                                             // __cpuid(), __cpuidex()
+      #define CSUF_CPSC131_TARGET_AVX2
+    #else
+      #define CSUF_CPSC131_TARGET_AVX2  __attribute__(( target( "avx2" ) ))
+    #endif
+  #else
+    #define CSUF_CPSC131_SIMD_X86 0
+  #endif
+
+
+
+
+/***********************************************************************************************************************************
+**  Module CSUF.CPSC131.SimdKernels Interface
+**
+***********************************************************************************************************************************/
+export module CSUF.CPSC131.SimdKernels;                                              // Primary Module Interface Definition
+import std;
+
+
+export namespace CSUF::CPSC131::simd
+{
+  // Element types the kernels handle.  Each is compared by value, lane by lane, with no user defined operator== to call.
+  template<typename T>
+  concept Vectorizable =    ( std::integral<T>  &&  !std::same_as<T, bool> )
+                         ||   std::same_as<T, float>
+                         ||   std::same_as<T, double>
+                         ||   std::same_as<T, std::byte>;
+
+
+  // Same results as the standard algorithms of the same name
+  template<Vectorizable T>  T const * find       ( T const * first,  T const * last,  T value ) noexcept;
+  template<Vectorizable T>  std::size_t count    ( T const * first,  T const * last,  T value ) noexcept;
+  template<Vectorizable T>  T const * min_element( T const * first,  T const * last           ) noexcept;
+  template<Vectorizable T>  T const * max_element( T const * first,  T const * last           ) noexcept;
+
+  // Index of the first position where lhs[i] == rhs[i] is false, or n if there is none
+  template<Vectorizable T>  std::size_t mismatch ( T const * lhs,    T const * rhs,   std::size_t n ) noexcept;
+
+  // How many elements are less than (or less than or equal to) value.  In a sorted range that's the index std::lower_bound (or
+  // std::upper_bound) returns, found without a single unpredictable branch
+  template<Vectorizable T>  std::size_t count_less      ( T const * first,  T const * last,  T value ) noexcept;
+  template<Vectorizable T>  std::size_t count_less_equal( T const * first,  T const * last,  T value ) noexcept;
+}    // export namespace CSUF::CPSC131::simd
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// Not exported but reachable
+/***********************************************************************************************************************************
+************************************************************************************************************************************
+** Template Implementation
+************************************************************************************************************************************
+***********************************************************************************************************************************/
+namespace CSUF::CPSC131::simd
+{
+  // std::byte isn't an arithmetic type (it has no operator<), but it is an unsigned char in every way that matters here
+  template<typename T>
+  using Scalar = std::conditional_t<std::same_as<T, std::byte>, unsigned char, T>;
+
+
+
+  #if CSUF_CPSC131_SIMD_X86
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Instruction sets
+  //
+  // The two instruction sets are used exactly the same way, only the register width differs.  Each comparison returns a register
+  // with every bit of a lane set where the comparison is true, and every bit cleared where it's false.  mask() then collects
+  // one bit from each byte, so a T occupying n bytes contributes n consecutive mask bits.
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // Detects AVX2 the first time it's asked, and remembers the answer
+  inline bool hasAvx2() noexcept
+  {
+    static bool const supported = []() noexcept
+    {
+      #if defined( _MSC_VER ) && !defined( __clang__ )
+        int info[4];
+        __cpuid( info, 0 );
+        if( info[0] < 7 )   return false;                                            // Processor too old to even answer the question
+
+        __cpuid( info, 1 );
+        bool const osSavesAvx = ( info[2] & (1 << 27) )  &&  ( _xgetbv( 0 ) & 0x6 ) == 0x6;   // The operating system must preserve the wide registers too
+
+        __cpuidex( info, 7, 0 );
+        return osSavesAvx  &&  ( info[1] & (1 << 5) ) != 0;
+      #else
+        return __builtin_cpu_supports( "avx2" ) != 0;
+      #endif
+    }();
+
+    return supported;
+  }
+
+
+
+
+  // 128-bit registers (16 bytes), always available on x86-64
+  struct Sse2
+  {
+    using Register = __m128i;
+    static constexpr std::size_t WIDTH    = 16;                               // Bytes per register
+    static constexpr unsigned    ALL_TRUE = 0xFFFF;                           // mask() when every lane compares true
+
+    static Register load  ( void const * p ) noexcept { return _mm_loadu_si128( static_cast<Register const *>( p ) ); }  // Unaligned loads, elements can start anywhere
+    static void     store ( void * p,  Register r ) noexcept { _mm_storeu_si128( static_cast<Register *>( p ), r ); }
+    static unsigned mask  ( Register r ) noexcept { return static_cast<unsigned>( _mm_movemask_epi8( r ) ); }
+    static Register either( Register a,  Register b ) noexcept { return _mm_or_si128( a, b ); }
+    static Register select( Register m,  Register a,  Register b ) noexcept { return _mm_or_si128( _mm_and_si128( m, a ), _mm_andnot_si128( m, b ) ); }  // m ? a : b, lane by lane
+
+    template<typename T>
+    static Register splat( T value ) noexcept                             // Every lane gets a copy of value
+    {
+      if      constexpr( sizeof( T ) == 1 )  return _mm_set1_epi8  ( std::bit_cast<char>     ( value ) );
+      else if constexpr( sizeof( T ) == 2 )  return _mm_set1_epi16 ( std::bit_cast<short>    ( value ) );
+      else if constexpr( sizeof( T ) == 4 )  return _mm_set1_epi32 ( std::bit_cast<int>      ( value ) );
+      else                                   return _mm_set1_epi64x( std::bit_cast<long long>( value ) );
+    }
+
+    template<typename T>
+    static Register equal( Register a,  Register b ) noexcept             // a == b
+    {
+      if      constexpr( std::same_as<T, float > )  return _mm_castps_si128( _mm_cmpeq_ps( _mm_castsi128_ps( a ), _mm_castsi128_ps( b ) ) );
+      else if constexpr( std::same_as<T, double> )  return _mm_castpd_si128( _mm_cmpeq_pd( _mm_castsi128_pd( a ), _mm_castsi128_pd( b ) ) );
+      else if constexpr( sizeof( T ) == 1 )         return _mm_cmpeq_epi8 ( a, b );
+      else if constexpr( sizeof( T ) == 2 )         return _mm_cmpeq_epi16( a, b );
+      else if constexpr( sizeof( T ) == 4 )         return _mm_cmpeq_epi32( a, b );
+      else
+      {
+        auto const halves = _mm_cmpeq_epi32( a, b );                      // SSE2 has no 64-bit compare, so both 32-bit halves must match
+        return _mm_and_si128( halves, _mm_shuffle_epi32( halves, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+      }
+    }
+
+    template<typename T>
+    static constexpr bool CAN_ORDER = !( std::integral<T> && sizeof( T ) == 8 );  // SSE2 has no 64-bit integer less-than
+
+    template<typename T>
+    static Register less( Register a,  Register b ) noexcept              // a < b
+    {
+      if      constexpr( std::same_as<T, float > )  return _mm_castps_si128( _mm_cmplt_ps( _mm_castsi128_ps( a ), _mm_castsi128_ps( b ) ) );
+      else if constexpr( std::same_as<T, double> )  return _mm_castpd_si128( _mm_cmplt_pd( _mm_castsi128_pd( a ), _mm_castsi128_pd( b ) ) );
+      else if constexpr( std::is_unsigned_v<T> )
+      {
+        // Only signed compares exist.  Flipping the sign bit maps 0 to the smallest signed value and the largest unsigned value
+        // to the largest signed value, preserving the order
+        auto const flip = splat( static_cast<T>( T{ 1 } << (sizeof( T ) * 8 - 1) ) );
+        return less<std::make_signed_t<T>>( _mm_xor_si128( a, flip ), _mm_xor_si128( b, flip ) );
+      }
+      else if constexpr( sizeof( T ) == 1 )         return _mm_cmpgt_epi8 ( b, a );
+      else if constexpr( sizeof( T ) == 2 )         return _mm_cmpgt_epi16( b, a );
+      else                                          return _mm_cmpgt_epi32( b, a );
+    }
+
+    template<typename T>
+    static Register unordered( Register a ) noexcept                      // a is NaN (never true for integers)
+    {
+      if      constexpr( std::same_as<T, float > )  return _mm_castps_si128( _mm_cmpunord_ps( _mm_castsi128_ps( a ), _mm_castsi128_ps( a ) ) );
+      else if constexpr( std::same_as<T, double> )  return _mm_castpd_si128( _mm_cmpunord_pd( _mm_castsi128_pd( a ), _mm_castsi128_pd( a ) ) );
+      else                                          return _mm_setzero_si128();
+    }
+  };
+
+
+
+
+  // 256-bit registers (32 bytes), available on most processors since about 2013
+  struct Avx2
+  {
+    using Register = __m256i;
+    static constexpr std::size_t WIDTH    = 32;                               // Bytes per register
+    static constexpr unsigned    ALL_TRUE = 0xFFFF'FFFF;                      // mask() when every lane compares true
+
+    CSUF_CPSC131_TARGET_AVX2 static Register load  ( void const * p ) noexcept { return _mm256_loadu_si256( static_cast<Register const *>( p ) ); }
+    CSUF_CPSC131_TARGET_AVX2 static void     store ( void * p,  Register r ) noexcept { _mm256_storeu_si256( static_cast<Register *>( p ), r ); }
+    CSUF_CPSC131_TARGET_AVX2 static unsigned mask  ( Register r ) noexcept { return static_cast<unsigned>( _mm256_movemask_epi8( r ) ); }
+    CSUF_CPSC131_TARGET_AVX2 static Register either( Register a,  Register b ) noexcept { return _mm256_or_si256( a, b ); }
+    CSUF_CPSC131_TARGET_AVX2 static Register select( Register m,  Register a,  Register b ) noexcept { return _mm256_blendv_epi8( b, a, m ); }  // m ? a : b, lane by lane
+
+    template<typename T>
+    CSUF_CPSC131_TARGET_AVX2 static Register splat( T value ) noexcept
+    {
+      if      constexpr( sizeof( T ) == 1 )  return _mm256_set1_epi8  ( std::bit_cast<char>     ( value ) );
+      else if constexpr( sizeof( T ) == 2 )  return _mm256_set1_epi16 ( std::bit_cast<short>    ( value ) );
+      else if constexpr( sizeof( T ) == 4 )  return _mm256_set1_epi32 ( std::bit_cast<int>      ( value ) );
+      else                                   return _mm256_set1_epi64x( std::bit_cast<long long>( value ) );
+    }
+
+    template<typename T>
+    CSUF_CPSC131_TARGET_AVX2 static Register equal( Register a,  Register b ) noexcept
+    {
+      if      constexpr( std::same_as<T, float > )  return _mm256_castps_si256( _mm256_cmp_ps( _mm256_castsi256_ps( a ), _mm256_castsi256_ps( b ), _CMP_EQ_OQ ) );
+      else if constexpr( std::same_as<T, double> )  return _mm256_castpd_si256( _mm256_cmp_pd( _mm256_castsi256_pd( a ), _mm256_castsi256_pd( b ), _CMP_EQ_OQ ) );
+      else if constexpr( sizeof( T ) == 1 )         return _mm256_cmpeq_epi8 ( a, b );
+      else if constexpr( sizeof( T ) == 2 )         return _mm256_cmpeq_epi16( a, b );
+      else if constexpr( sizeof( T ) == 4 )         return _mm256_cmpeq_epi32( a, b );
+      else                                          return _mm256_cmpeq_epi64( a, b );
+    }
+
+    template<typename T>
+    static constexpr bool CAN_ORDER = true;
+
+    template<typename T>
+    CSUF_CPSC131_TARGET_AVX2 static Register less( Register a,  Register b ) noexcept
+    {
+      if      constexpr( std::same_as<T, float > )  return _mm256_castps_si256( _mm256_cmp_ps( _mm256_castsi256_ps( a ), _mm256_castsi256_ps( b ), _CMP_LT_OQ ) );
+      else if constexpr( std::same_as<T, double> )  return _mm256_castpd_si256( _mm256_cmp_pd( _mm256_castsi256_pd( a ), _mm256_castsi256_pd( b ), _CMP_LT_OQ ) );
+      else if constexpr( std::is_unsigned_v<T> )
+      {
+        auto const flip = splat( static_cast<T>( T{ 1 } << (sizeof( T ) * 8 - 1) ) );     // See Sse2::less()
+        return less<std::make_signed_t<T>>( _mm256_xor_si256( a, flip ), _mm256_xor_si256( b, flip ) );
+      }
+      else if constexpr( sizeof( T ) == 1 )         return _mm256_cmpgt_epi8 ( b, a );
+      else if constexpr( sizeof( T ) == 2 )         return _mm256_cmpgt_epi16( b, a );
+      else if constexpr( sizeof( T ) == 4 )         return _mm256_cmpgt_epi32( b, a );
+      else                                          return _mm256_cmpgt_epi64( b, a );
+    }
+
+    template<typename T>
+    CSUF_CPSC131_TARGET_AVX2 static Register unordered( Register a ) noexcept
+    {
+      if      constexpr( std::same_as<T, float > )  return _mm256_castps_si256( _mm256_cmp_ps( _mm256_castsi256_ps( a ), _mm256_castsi256_ps( a ), _CMP_UNORD_Q ) );
+      else if constexpr( std::same_as<T, double> )  return _mm256_castpd_si256( _mm256_cmp_pd( _mm256_castsi256_pd( a ), _mm256_castsi256_pd( a ), _CMP_UNORD_Q ) );
+      else                                          return _mm256_setzero_si256();
+    }
+  };
+
+
+
+
+
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Kernels
+  //
+  // Each kernel is written twice, once per instruction set, because GCC and Clang will only compile AVX2 instructions into a
+  // function that's been marked as allowed to use them.  Other than that mark, the SSE2 and AVX2 versions are identical.  Each
+  // processes as many whole registers as it can, and then hands the few elements left over to the scalar standard algorithm.
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // find()
+  template<typename T>
+  T const * findSse2( T const * first,  T const * last,  T value ) noexcept
+  {
+    constexpr std::ptrdiff_t LANES  = Sse2::WIDTH / sizeof( T );
+    auto const               needle = Sse2::splat( value );
+
+    for( ;  last - first >= LANES;  first += LANES )
+    {
+      auto const found = Sse2::mask( Sse2::equal<T>( Sse2::load( first ), needle ) );
+      if( found != 0 )   return first + std::countr_zero( found ) / sizeof( T );    // The lowest set bit belongs to the first match
+    }
+    return std::find( first, last, value );
+  }
+
+  template<typename T>
+  CSUF_CPSC131_TARGET_AVX2 T const * findAvx2( T const * first,  T const * last,  T value ) noexcept
+  {
+    constexpr std::ptrdiff_t LANES  = Avx2::WIDTH / sizeof( T );
+    auto const               needle = Avx2::splat( value );
+
+    for( ;  last - first >= LANES;  first += LANES )
+    {
+      auto const found = Avx2::mask( Avx2::equal<T>( Avx2::load( first ), needle ) );
+      if( found != 0 )   return first + std::countr_zero( found ) / sizeof( T );
+    }
+    return std::find( first, last, value );
+  }
+
+
+
+
+  // count()
+  template<typename T>
+  std::size_t countSse2( T const * first,  T const * last,  T value ) noexcept
+  {
+    constexpr std::ptrdiff_t LANES  = Sse2::WIDTH / sizeof( T );
+    auto const               needle = Sse2::splat( value );
+    std::size_t              bits   = 0;                                      // Each match sets sizeof(T) bits
+
+    for( ;  last - first >= LANES;  first += LANES )   bits += std::popcount( Sse2::mask( Sse2::equal<T>( Sse2::load( first ), needle ) ) );
+    return bits / sizeof( T ) + static_cast<std::size_t>( std::count( first, last, value ) );
+  }
+
+  template<typename T>
+  CSUF_CPSC131_TARGET_AVX2 std::size_t countAvx2( T const * first,  T const * last,  T value ) noexcept
+  {
+    constexpr std::ptrdiff_t LANES  = Avx2::WIDTH / sizeof( T );
+    auto const               needle = Avx2::splat( value );
+    std::size_t              bits   = 0;
+
+    for( ;  last - first >= LANES;  first += LANES )   bits += std::popcount( Avx2::mask( Avx2::equal<T>( Avx2::load( first ), needle ) ) );
+    return bits / sizeof( T ) + static_cast<std::size_t>( std::count( first, last, value ) );
+  }
+
+
+
+
+  // mismatch()
+  template<typename T>
+  std::size_t mismatchSse2( T const * lhs,  T const * rhs,  std::size_t n ) noexcept
+  {
+    constexpr std::size_t LANES = Sse2::WIDTH / sizeof( T );
+    std::size_t           i     = 0;
+
+    for( ;  n - i >= LANES;  i += LANES )
+    {
+      auto const same = Sse2::mask( Sse2::equal<T>( Sse2::load( lhs + i ), Sse2::load( rhs + i ) ) );
+      if( same != Sse2::ALL_TRUE )   return i + std::countr_one( same ) / sizeof( T );   // The lowest clear bit belongs to the first difference
+    }
+    while( i < n  &&  lhs[i] == rhs[i] )   ++i;
+    return i;
+  }
+
+  template<typename T>
+  CSUF_CPSC131_TARGET_AVX2 std::size_t mismatchAvx2( T const * lhs,  T const * rhs,  std::size_t n ) noexcept
+  {
+    constexpr std::size_t LANES = Avx2::WIDTH / sizeof( T );
+    std::size_t           i     = 0;
+
+    for( ;  n - i >= LANES;  i += LANES )
+    {
+      auto const same = Avx2::mask( Avx2::equal<T>( Avx2::load( lhs + i ), Avx2::load( rhs + i ) ) );
+      if( same != Avx2::ALL_TRUE )   return i + std::countr_one( same ) / sizeof( T );
+    }
+    while( i < n  &&  lhs[i] == rhs[i] )   ++i;
+    return i;
+  }
+
+
+
+
+  // count_less() and count_less_equal()
+  //
+  // Less-than-or-equal is tested as less-than or equal, never as not-greater-than, so a NaN is counted exactly as the scalar
+  // comparison counts it:  never
+  template<bool OR_EQUAL, typename T>
+  std::size_t countLessSse2( T const * first,  T const * last,  T value ) noexcept
+  {
+    auto const below = []( T x, T v ) { return OR_EQUAL ? x <= v : x < v; };
+
+    if constexpr( !Sse2::CAN_ORDER<T> )   return static_cast<std::size_t>( std::count_if( first, last, [&]( T x ) { return below( x, value ); } ) );   // SSE2 has no 64-bit integer less-than
+    else
+    {
+      constexpr std::ptrdiff_t LANES  = Sse2::WIDTH / sizeof( T );
+      auto const               bound  = Sse2::splat( value );
+      std::size_t              bits   = 0;                                    // Each element counted sets sizeof(T) bits
+
+      for( ;  last - first >= LANES;  first += LANES )
+      {
+        auto const x = Sse2::load( first );
+        bits += std::popcount( Sse2::mask( OR_EQUAL ? Sse2::either( Sse2::less<T>( x, bound ), Sse2::equal<T>( x, bound ) )
+                                                    :               Sse2::less<T>( x, bound ) ) );
+      }
+      return bits / sizeof( T ) + static_cast<std::size_t>( std::count_if( first, last, [&]( T x ) { return below( x, value ); } ) );
+    }
+  }
+
+  template<bool OR_EQUAL, typename T>
+  CSUF_CPSC131_TARGET_AVX2 std::size_t countLessAvx2( T const * first,  T const * last,  T value ) noexcept
+  {
+    auto const below = []( T x, T v ) { return OR_EQUAL ? x <= v : x < v; };
+
+    constexpr std::ptrdiff_t LANES  = Avx2::WIDTH / sizeof( T );
+    auto const               bound  = Avx2::splat( value );
+    std::size_t              bits   = 0;
+
+    for( ;  last - first >= LANES;  first += LANES )
+    {
+      auto const x = Avx2::load( first );
+      bits += std::popcount( Avx2::mask( OR_EQUAL ? Avx2::either( Avx2::less<T>( x, bound ), Avx2::equal<T>( x, bound ) )
+                                                  :               Avx2::less<T>( x, bound ) ) );
+    }
+    return bits / sizeof( T ) + static_cast<std::size_t>( std::count_if( first, last, [&]( T x ) { return below( x, value ); } ) );
+  }
+
+
+
+
+  // min_element() and max_element()
+  //
+  // Keep a register's worth of running minimums (or maximums), one per lane, then reduce those few to the single answer.  The
+  // first element equal to that answer is exactly the one std::min_element() returns.  NaNs are the exception:  they compare
+  // neither less nor greater, so where one sits changes the standard algorithm's answer.  If there's a NaN anywhere, let the
+  // standard algorithm answer.
+  template<bool SMALLEST, typename T>
+  T const * extremeSse2( T const * first,  T const * last ) noexcept
+  {
+    constexpr std::ptrdiff_t LANES  = Sse2::WIDTH / sizeof( T );
+    auto      const          better = []( T a, T b ) { return SMALLEST ? a < b : b < a; };
+
+    if constexpr( !Sse2::CAN_ORDER<T> )   return std::min_element( first, last, better );   // SSE2 has no 64-bit integer less-than
+    else
+    {
+      if( last - first < LANES )   return std::min_element( first, last, better );
+
+      auto best = Sse2::load( first );
+      auto nans = Sse2::unordered<T>( best );
+      auto p    = first + LANES;
+      for( ;  last - p >= LANES;  p += LANES )
+      {
+        auto const next = Sse2::load( p );
+        nans = Sse2::either( nans, Sse2::unordered<T>( next ) );
+        best = SMALLEST ? Sse2::select( Sse2::less<T>( next, best ), next, best )
+                        : Sse2::select( Sse2::less<T>( best, next ), next, best );
+      }
+      if( Sse2::mask( nans ) != 0  ||  std::any_of( p, last, []( T x ) { return x != x; } ) )   return std::min_element( first, last, better );
+
+      T lanes[LANES];
+      Sse2::store( lanes, best );
+      T const answer = std::min( *std::min_element( std::begin( lanes ), std::end( lanes ), better ),
+                                 p == last ? lanes[0] : *std::min_element( p, last, better ), better );
+      return findSse2( first, last, answer );
+    }
+  }
+
+  template<bool SMALLEST, typename T>
+  CSUF_CPSC131_TARGET_AVX2 T const * extremeAvx2( T const * first,  T const * last ) noexcept
+  {
+    constexpr std::ptrdiff_t LANES  = Avx2::WIDTH / sizeof( T );
+    auto      const          better = []( T a, T b ) { return SMALLEST ? a < b : b < a; };
+
+    if( last - first < LANES )   return std::min_element( first, last, better );
+
+    auto best = Avx2::load( first );
+    auto nans = Avx2::unordered<T>( best );
+    auto p    = first + LANES;
+    for( ;  last - p >= LANES;  p += LANES )
+    {
+      auto const next = Avx2::load( p );
+      nans = Avx2::either( nans, Avx2::unordered<T>( next ) );
+      best = SMALLEST ? Avx2::select( Avx2::less<T>( next, best ), next, best )
+                      : Avx2::select( Avx2::less<T>( best, next ), next, best );
+    }
+    if( Avx2::mask( nans ) != 0  ||  std::any_of( p, last, []( T x ) { return x != x; } ) )   return std::min_element( first, last, better );
+
+    T lanes[LANES];
+    Avx2::store( lanes, best );
+    T const answer = std::min( *std::min_element( std::begin( lanes ), std::end( lanes ), better ),
+                               p == last ? lanes[0] : *std::min_element( p, last, better ), better );
+    return findAvx2( first, last, answer );
+  }
+  #endif    // CSUF_CPSC131_SIMD_X86
+
+
+
+
+
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Dispatch - pick the widest instruction set the processor has
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // find()
+  template<Vectorizable T>
+  T const * find( T const * first,  T const * last,  T value ) noexcept
+  {
+    using S = Scalar<T>;
+    auto const f = reinterpret_cast<S const *>( first ),  l = reinterpret_cast<S const *>( last );
+    auto const v = std::bit_cast<S>( value );
+
+    #if CSUF_CPSC131_SIMD_X86
+      return reinterpret_cast<T const *>( hasAvx2() ? findAvx2( f, l, v ) : findSse2( f, l, v ) );
+    #else
+      return reinterpret_cast<T const *>( std::find( f, l, v ) );
+    #endif
+  }
+
+
+
+
+  // count()
+  template<Vectorizable T>
+  std::size_t count( T const * first,  T const * last,  T value ) noexcept
+  {
+    using S = Scalar<T>;
+    auto const f = reinterpret_cast<S const *>( first ),  l = reinterpret_cast<S const *>( last );
+    auto const v = std::bit_cast<S>( value );
+
+    #if CSUF_CPSC131_SIMD_X86
+      return hasAvx2() ? countAvx2( f, l, v ) : countSse2( f, l, v );
+    #else
+      return static_cast<std::size_t>( std::count( f, l, v ) );
+    #endif
+  }
+
+
+
+
+  // min_element()
+  template<Vectorizable T>
+  T const * min_element( T const * first,  T const * last ) noexcept
+  {
+    using S = Scalar<T>;
+    auto const f = reinterpret_cast<S const *>( first ),  l = reinterpret_cast<S const *>( last );
+
+    #if CSUF_CPSC131_SIMD_X86
+      return reinterpret_cast<T const *>( hasAvx2() ? extremeAvx2<true>( f, l ) : extremeSse2<true>( f, l ) );
+    #else
+      return reinterpret_cast<T const *>( std::min_element( f, l ) );
+    #endif
+  }
+
+
+
+
+  // max_element()
+  template<Vectorizable T>
+  T const * max_element( T const * first,  T const * last ) noexcept
+  {
+    using S = Scalar<T>;
+    auto const f = reinterpret_cast<S const *>( first ),  l = reinterpret_cast<S const *>( last );
+
+    #if CSUF_CPSC131_SIMD_X86
+      return reinterpret_cast<T const *>( hasAvx2() ? extremeAvx2<false>( f, l ) : extremeSse2<false>( f, l ) );
+    #else
+      return reinterpret_cast<T const *>( std::max_element( f, l ) );
+    #endif
+  }
+
+
+
+
+  // mismatch()
+  template<Vectorizable T>
+  std::size_t mismatch( T const * lhs,  T const * rhs,  std::size_t n ) noexcept
+  {
+    using S = Scalar<T>;
+    auto const l = reinterpret_cast<S const *>( lhs ),  r = reinterpret_cast<S const *>( rhs );
+
+    #if CSUF_CPSC131_SIMD_X86
+      return hasAvx2() ? mismatchAvx2( l, r, n ) : mismatchSse2( l, r, n );
+    #else
+      return static_cast<std::size_t>( std::mismatch( l, l + n, r ).first - l );
+    #endif
+  }
+
+
+
+
+  // count_less()
+  template<Vectorizable T>
+  std::size_t count_less( T const * first,  T const * last,  T value ) noexcept
+  {
+    using S = Scalar<T>;
+    auto const f = reinterpret_cast<S const *>( first ),  l = reinterpret_cast<S const *>( last );
+    auto const v = std::bit_cast<S>( value );
+
+    #if CSUF_CPSC131_SIMD_X86
+      return hasAvx2() ? countLessAvx2<false>( f, l, v ) : countLessSse2<false>( f, l, v );
+    #else
+      return static_cast<std::size_t>( std::count_if( f, l, [v]( S x ) { return x < v; } ) );
+    #endif
+  }
+
+
+
+
+  // count_less_equal()
+  template<Vectorizable T>
+  std::size_t count_less_equal( T const * first,  T const * last,  T value ) noexcept
+  {
+    using S = Scalar<T>;
+    auto const f = reinterpret_cast<S const *>( first ),  l = reinterpret_cast<S const *>( last );
+    auto const v = std::bit_cast<S>( value );
+
+    #if CSUF_CPSC131_SIMD_X86
+      return hasAvx2() ? countLessAvx2<true>( f, l, v ) : countLessSse2<true>( f, l, v );
+    #else
+      return static_cast<std::size_t>( std::count_if( f, l, [v]( S x ) { return x <= v; } ) );
+    #endif
+  }
+}    // namespace CSUF::CPSC131::simd
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+** (C) Copyright 2025 by Thomas Bettens. All Rights Reserved.
+**
+** DISCLAIMER: The participating authors at California State University's Computer Science Department have used their best efforts
+** in preparing this code. These efforts include the development, research, and testing of the theories and programs to determine
+** their effectiveness. The authors make no warranty of any kind, expressed or implied, with regard to these programs or to the
+** documentation contained within. The authors shall not be liable in any event for incidental or consequential damages in
+** connection with, or arising out of, the furnishing, performance, or use of these libraries and programs.  Distribution without
+** written consent from the authors is prohibited.
+***********************************************************************************************************************************/
+
+/**************************************************
+** Last modified:  27-JUL-2025 (Converted to C++ Modules)
+** Last Verified:  27-JUL-2025
+** Verified with:  MS Visual Studio 2022 Version 17.14.9,  Compiler Version 19.44.35213 (/std:c++latest)
+**                 GCC version 15.1.0 (-std=c++23 )
+**                 Clang version 21.0.0 (-std=c++23 -stdlib=libc++)
+***************************************************/
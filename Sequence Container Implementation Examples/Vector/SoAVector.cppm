@@ -0,0 +1,654 @@
+/***********************************************************************************************************************************
+** Class SoAVector - a struct-of-arrays (columnar) vector of records
+**
+**  A Vector<Student> is an array of structs:  each element holds a student's name, ID, and semesters side by side, and the
+**  elements sit one after the other.  That's perfect when a whole student is wanted at once.  But a loop looking only at the
+**  semesters still drags every student's name (a 32 byte std::string object) through the cache, just to skip over it.
+**
+**  An SoAVector turns that inside out into a struct of arrays.  Each field gets its own Vector, a column, and a record (a row) is
+**  the elements at the same index in every column:
+**
+**        Vector<Student>  (array of structs)              SoAVector<std::string, std::size_t, unsigned>  (struct of arrays)
+**       +-------------------------+                       +-------+-------+-------+
+**       | name | id | semesters  |  row 0                 | name0 | name1 | name2 |     column 0
+**       +-------------------------+                       +-------+-------+-------+
+**       | name | id | semesters  |  row 1                 |  id0  |  id1  |  id2  |     column 1
+**       +-------------------------+                       +-------+-------+-------+
+**       | name | id | semesters  |  row 2                 | sem0  | sem1  | sem2  |     column 2
+**       +-------------------------+                       +-------+-------+-------+
+**
+**  A scan over one field now reads just that field's bytes, densely packed - and since a column is a Vector, searches over
+**  arithmetic fields are vectorized (see SimdKernels.cppm).  The price is paid when a whole record is wanted:  its fields are
+**  in as many different places as there are columns.
+**
+**  There's no row object in memory to refer to, so indexing and iterators hand out a proxy reference instead:  a std::tuple of
+**  references, one into each column.  Reading, assigning through, and structured bindings all work as expected:
+**       for( auto [name, id, semesters] : students )   ++semesters;          // name, id, and semesters refer into the columns
+**
+**  But note that a proxy is not a real reference.  auto row = students[0] copies the references, not the fields.
+***********************************************************************************************************************************/
+module;                                                                   // Global fragment (not part of the module)
+  // Empty
+
+
+
+
+/***********************************************************************************************************************************
+**  Module CSUF.CPSC131.SoAVector Interface
+**
+***********************************************************************************************************************************/
+export module CSUF.CPSC131.SoAVector;                                     // Primary Module Interface Definition
+import std;
+import CSUF.CPSC131.exceptionString;
+import CSUF.CPSC131.Vector;
+
+
+export namespace CSUF::CPSC131
+{
+  // Template Class Definition - SoAVector's Abstract Data Type Interface:
+  template<typename... Fields>
+  class SoAVector
+  {
+    static_assert( sizeof...( Fields ) > 0, "A record needs at least one field" );
+
+    template<bool CONST> class Iterator_type;                             // Template class for iterator and const_iterator classes
+
+    public:
+      // Types
+      using value_type      = std::tuple<Fields...>;                      // A row by value
+      using reference       = std::tuple<Fields       &...>;              // A row by (proxy) reference, one reference into each column
+      using const_reference = std::tuple<Fields const &...>;
+      using iterator        = Iterator_type<false>;                       // A random access iterator to read-write rows
+      using const_iterator  = Iterator_type<true >;                       // A random access iterator to read-only rows
+
+      template<std::size_t FIELD>
+      using field_type      = std::tuple_element_t<FIELD, value_type>;
+
+
+      // Constructors, destructor, and assignments
+      // Compiler synthesized copy and move constructors, assignments, and destructor are just what we want - each column is a Vector
+      // that knows how to copy, move, and destroy itself
+      SoAVector( std::size_t size = 0 );                                  // size default constructed rows
+      SoAVector( std::initializer_list<value_type> init_list );
+
+
+      // Queries
+      std::size_t size    () const noexcept;
+      std::size_t capacity() const noexcept;                              // Rows that fit without any column reallocating
+      bool        empty   () const noexcept;
+
+
+      // Capacity management
+      void reserve      ( std::size_t newCapacity );                      // Reserves newCapacity in every column
+      void shrink_to_fit(                         );
+
+
+      // Iterators
+      iterator       begin ()       noexcept;
+      iterator       end   ()       noexcept;
+      const_iterator begin () const noexcept;
+      const_iterator end   () const noexcept;
+      const_iterator cbegin() const noexcept;
+      const_iterator cend  () const noexcept;
+
+
+      // Accessors - rows
+      const_reference at        ( std::size_t index ) const;              // Checks bounds, throws std::out_of_range
+      reference       at        ( std::size_t index );                    // Checks bounds, throws std::out_of_range
+      const_reference operator[]( std::size_t index ) const;              // No bounds checking
+      reference       operator[]( std::size_t index );                    // No bounds checking
+
+      const_reference front() const;                                      // Checks bounds, throws std::range_error
+      reference       front();                                            // Checks bounds, throws std::range_error
+      const_reference back () const;                                      // Checks bounds, throws std::range_error
+      reference       back ();                                            // Checks bounds, throws std::range_error
+
+
+      // Accessors - columns.  Column-wise scans touch only the one field they need
+      template<std::size_t FIELD>  Vector<field_type<FIELD>> const & column        () const noexcept;   // The whole column, including Vector's (vectorized) searches
+      template<std::size_t FIELD>  std::span<field_type<FIELD>>      writableColumn()       noexcept;   // Read-write access to the fields, but not to the column's size
+
+
+      // Modifiers - a row is added to (or removed from) every column, or to none of them
+      void push_back( value_type const  & row );
+      void push_back( value_type       && row );
+      void pop_back (                         );                          // Checks size, throws std::underflow_error
+
+      template<typename... Args>  requires( sizeof...( Args ) == sizeof...( Fields ) )
+      reference emplace_back( Args &&... fields );                        // Constructs each field in place in its column, one argument per field
+
+      iterator erase ( const_iterator position );                         // Checks bounds, throws std::out_of_range
+      void     resize( std::size_t    newSize  );                         // Default constructs or destroys rows at the back
+      void     clear (                         ) noexcept;
+
+
+      // Relational Operators
+      std::weak_ordering operator<=>( SoAVector const & rhs ) const;      // Row by row, field by field
+      bool               operator== ( SoAVector const & rhs ) const;      // Column by column
+
+
+
+    private:
+      // Attributes
+      std::tuple<Vector<Fields>...> _columns;                             // Column FIELD holds every row's FIELD'th field.  All columns are always the same size
+
+      // Helper functions
+      template<typename Function>
+      void forEachColumn( Function function );                            // Calls function( column ) for each column, first to last
+  };
+
+
+
+
+  // SoAVector's iterators are a row index.  Dereferencing one builds the proxy reference to that row on the fly.
+  template<typename... Fields>
+  template<bool CONST>
+  class SoAVector<Fields...>::Iterator_type
+  {
+    friend class SoAVector<Fields...>;
+    friend class Iterator_type<!CONST>;
+    using Container = std::conditional_t<CONST, SoAVector<Fields...> const, SoAVector<Fields...>>;
+
+    public:
+      // Iterator Type Traits - Boilerplate stuff so the iterator can be used with the rest of the standard library.  A legacy
+      // (pre-C++20) iterator past input iterator must return a real reference, so to legacy code this is an input iterator.  To
+      // C++20 ranges, which understand proxy references, it's random access.
+      using iterator_concept  = std::random_access_iterator_tag;
+      using iterator_category = std::input_iterator_tag;
+      using value_type        = SoAVector<Fields...>::value_type;
+      using difference_type   = std::ptrdiff_t;
+      using pointer           = void;                                     // There's no row in memory to point to
+      using reference         = std::conditional_t<CONST, SoAVector<Fields...>::const_reference, SoAVector<Fields...>::reference>;
+
+      Iterator_type(                        ) = default;                  // Singular, don't use until assigned
+      Iterator_type( iterator const & other ) : _vector{ other._vector }, _index{ other._index } {}   // Copy constructor when CONST is false, Conversion constructor from non-const to const iterator when CONST is true
+
+      // Dereferencing operators
+      reference operator* (                        ) const { return (*_vector)[_index];        }
+      reference operator[]( difference_type offset ) const { return *(*this + offset);         }
+
+      // Arithmetic operators move the position by offset rows
+      Iterator_type & operator++(     )  { ++_index;  return *this; }
+      Iterator_type   operator++( int )  { auto temp = *this;  ++_index;  return temp; }
+      Iterator_type & operator--(     )  { --_index;  return *this; }
+      Iterator_type   operator--( int )  { auto temp = *this;  --_index;  return temp; }
+
+      Iterator_type & operator+=( difference_type offset )  { _index += static_cast<std::size_t>( offset );  return *this; }
+      Iterator_type & operator-=( difference_type offset )  { _index -= static_cast<std::size_t>( offset );  return *this; }
+
+      friend Iterator_type   operator+( Iterator_type i,  difference_type offset )  { return i += offset; }
+      friend Iterator_type   operator+( difference_type offset,  Iterator_type i )  { return i += offset; }
+      friend Iterator_type   operator-( Iterator_type i,  difference_type offset )  { return i -= offset; }
+      friend difference_type operator-( Iterator_type const & lhs,  Iterator_type const & rhs )
+      { return static_cast<difference_type>( lhs._index ) - static_cast<difference_type>( rhs._index ); }
+
+      // Relational operators, only meaningful for iterators into the same vector
+      bool                 operator== ( Iterator_type const & rhs ) const  { return _index ==  rhs._index; }
+      std::strong_ordering operator<=>( Iterator_type const & rhs ) const  { return _index <=> rhs._index; }
+
+    private:
+      Iterator_type( Container * vector,  std::size_t index ) : _vector{ vector }, _index{ index } {}
+
+      Container * _vector = nullptr;
+      std::size_t _index  = 0;
+  };  // SoAVector<Fields...>::Iterator_type
+}    // export namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// Not exported but reachable
+/***********************************************************************************************************************************
+************************************************************************************************************************************
+** Implementation
+************************************************************************************************************************************
+***********************************************************************************************************************************/
+namespace CSUF::CPSC131
+{
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Constructors, destructor, and assignments
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // Default construction
+  template<typename... Fields>
+  SoAVector<Fields...>::SoAVector( std::size_t size )
+    : _columns{ Vector<Fields>( size )... }
+  {}
+
+
+
+
+  // Initialization List construction
+  template<typename... Fields>
+  SoAVector<Fields...>::SoAVector( std::initializer_list<value_type> init_list )
+  {
+    reserve( init_list.size() );
+    for( auto const & row : init_list )   push_back( row );
+  }
+
+
+
+
+
+
+
+
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Queries
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // size()
+  template<typename... Fields>
+  std::size_t SoAVector<Fields...>::size() const noexcept
+  { return std::get<0>( _columns ).size(); }                              // All columns are the same size, ask any of them
+
+
+
+
+  // capacity()
+  template<typename... Fields>
+  std::size_t SoAVector<Fields...>::capacity() const noexcept
+  { return std::apply( []( auto const &... column ) { return std::min( { column.capacity()... } ); }, _columns ); }
+
+
+
+
+  // empty()
+  template<typename... Fields>
+  bool SoAVector<Fields...>::empty() const noexcept
+  { return size() == 0; }
+
+
+
+
+
+
+
+
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Capacity management
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // reserve()
+  template<typename... Fields>
+  void SoAVector<Fields...>::reserve( std::size_t newCapacity )
+  { forEachColumn( [newCapacity]( auto & column ) { column.reserve( newCapacity ); } ); }
+
+
+
+
+  // shrink_to_fit()
+  template<typename... Fields>
+  void SoAVector<Fields...>::shrink_to_fit()
+  { forEachColumn( []( auto & column ) { column.shrink_to_fit(); } ); }
+
+
+
+
+
+
+
+
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Iterators
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  template<typename... Fields>   typename SoAVector<Fields...>::iterator       SoAVector<Fields...>::begin ()       noexcept { return iterator      ( this, 0      ); }
+  template<typename... Fields>   typename SoAVector<Fields...>::iterator       SoAVector<Fields...>::end   ()       noexcept { return iterator      ( this, size() ); }
+  template<typename... Fields>   typename SoAVector<Fields...>::const_iterator SoAVector<Fields...>::begin () const noexcept { return const_iterator( this, 0      ); }
+  template<typename... Fields>   typename SoAVector<Fields...>::const_iterator SoAVector<Fields...>::end   () const noexcept { return const_iterator( this, size() ); }
+  template<typename... Fields>   typename SoAVector<Fields...>::const_iterator SoAVector<Fields...>::cbegin() const noexcept { return begin();                      }
+  template<typename... Fields>   typename SoAVector<Fields...>::const_iterator SoAVector<Fields...>::cend  () const noexcept { return end();                        }
+
+
+
+
+
+
+
+
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Accessors
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // operator[] const
+  template<typename... Fields>
+  typename SoAVector<Fields...>::const_reference SoAVector<Fields...>::operator[]( std::size_t index ) const
+  { return std::apply( [index]( auto const &... column ) { return const_reference( column[index]... ); }, _columns ); }
+
+
+
+
+  // operator[]
+  template<typename... Fields>
+  typename SoAVector<Fields...>::reference SoAVector<Fields...>::operator[]( std::size_t index )
+  { return std::apply( [index]( auto &... column ) { return reference( column[index]... ); }, _columns ); }
+
+
+
+
+  // at() const
+  template<typename... Fields>
+  typename SoAVector<Fields...>::const_reference SoAVector<Fields...>::at( std::size_t index ) const
+  {
+    if( index >= size() )   throw std::out_of_range( exceptionString( std::format( "index ({}) over indexes vector's size ({})", index, size() ) ) );
+    return (*this)[index];
+  }
+
+
+
+
+  // at()
+  template<typename... Fields>
+  typename SoAVector<Fields...>::reference SoAVector<Fields...>::at( std::size_t index )
+  {
+    if( index >= size() )   throw std::out_of_range( exceptionString( std::format( "index ({}) over indexes vector's size ({})", index, size() ) ) );
+    return (*this)[index];
+  }
+
+
+
+
+  // front() const
+  template<typename... Fields>
+  typename SoAVector<Fields...>::const_reference SoAVector<Fields...>::front() const
+  {
+    if( empty() )   throw std::range_error( exceptionString( "Attempt to access data from an empty vector" ) );
+    return (*this)[0];
+  }
+
+
+
+
+  // front()
+  template<typename... Fields>
+  typename SoAVector<Fields...>::reference SoAVector<Fields...>::front()
+  {
+    if( empty() )   throw std::range_error( exceptionString( "Attempt to access data from an empty vector" ) );
+    return (*this)[0];
+  }
+
+
+
+
+  // back() const
+  template<typename... Fields>
+  typename SoAVector<Fields...>::const_reference SoAVector<Fields...>::back() const
+  {
+    if( empty() )   throw std::range_error( exceptionString( "Attempt to access data from an empty vector" ) );
+    return (*this)[size() - 1];
+  }
+
+
+
+
+  // back()
+  template<typename... Fields>
+  typename SoAVector<Fields...>::reference SoAVector<Fields...>::back()
+  {
+    if( empty() )   throw std::range_error( exceptionString( "Attempt to access data from an empty vector" ) );
+    return (*this)[size() - 1];
+  }
+
+
+
+
+  // column()
+  template<typename... Fields>
+  template<std::size_t FIELD>
+  Vector<typename SoAVector<Fields...>::template field_type<FIELD>> const & SoAVector<Fields...>::column() const noexcept
+  { return std::get<FIELD>( _columns ); }
+
+
+
+
+  // writableColumn()
+  template<typename... Fields>
+  template<std::size_t FIELD>
+  std::span<typename SoAVector<Fields...>::template field_type<FIELD>> SoAVector<Fields...>::writableColumn() noexcept
+  {
+    // A span lets the fields be changed in place but, unlike the Vector itself, can't change how many there are.  One column
+    // growing or shrinking on its own would tear every row after it apart.
+    auto & column = std::get<FIELD>( _columns );
+    return { column.begin(), column.end() };
+  }
+
+
+
+
+
+
+
+
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Modifiers
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // push_back() - copy
+  template<typename... Fields>
+  void SoAVector<Fields...>::push_back( value_type const & row )
+  { std::apply( [this]( auto const &... fields ) { emplace_back( fields... ); }, row ); }
+
+
+
+
+  // push_back() - move
+  template<typename... Fields>
+  void SoAVector<Fields...>::push_back( value_type && row )
+  { std::apply( [this]( auto &&... fields ) { emplace_back( std::move( fields )... ); }, std::move( row ) ); }
+
+
+
+
+  // emplace_back()
+  template<typename... Fields>
+  template<typename... Args>  requires( sizeof...( Args ) == sizeof...( Fields ) )
+  typename SoAVector<Fields...>::reference SoAVector<Fields...>::emplace_back( Args &&... fields )
+  {
+    // Append each field to its column, first to last.  Should one of them throw, the columns already appended to must give their
+    // new field back, otherwise the columns would no longer line up.
+    //
+    //             column 0    column 1    column 2
+    //               +---+       +---+       +---+
+    //               | a |       | b |       | c |
+    //               +---+       +---+       +---+
+    //               | d |       | e |         X       <-- constructing f throws, so pop e and d
+    //               +---+       +---+
+    std::size_t appended = 0;
+    try
+    {
+      [&]<std::size_t... FIELD>( std::index_sequence<FIELD...> )
+      { ( ( std::get<FIELD>( _columns ).emplace_back( std::forward<Args>( fields ) ),  ++appended ), ... ); }   // Comma fold, evaluated left to right
+      ( std::index_sequence_for<Fields...>{} );
+    }
+    catch( ... )
+    {
+      forEachColumn( [&appended]( auto & column ) { if( appended > 0 )   { column.pop_back();  --appended; } } );
+      throw;
+    }
+
+    return back();
+  }
+
+
+
+
+  // pop_back()
+  template<typename... Fields>
+  void SoAVector<Fields...>::pop_back()
+  {
+    if( empty() )   throw std::underflow_error( exceptionString( "Attempt to remove an element from an empty vector" ) );
+    forEachColumn( []( auto & column ) { column.pop_back(); } );
+  }
+
+
+
+
+  // erase()
+  template<typename... Fields>
+  typename SoAVector<Fields...>::iterator SoAVector<Fields...>::erase( const_iterator position )
+  {
+    if( position._vector != this  ||  position._index >= size() )   throw std::out_of_range( exceptionString( "Position outside of bounds of the vector" ) );
+
+    forEachColumn( [index = position._index]( auto & column ) { column.erase( column.begin() + index ); } );
+    return iterator( this, position._index );
+  }
+
+
+
+
+  // resize()
+  template<typename... Fields>
+  void SoAVector<Fields...>::resize( std::size_t newSize )
+  {
+    // Every field must be default constructible before any column changes, so growing either succeeds everywhere or (should a
+    // constructor throw) the columns that already grew are put back
+    auto const oldSize = size();
+    try
+    {
+      forEachColumn( [newSize]( auto & column ) { column.resize( newSize ); } );
+    }
+    catch( ... )
+    {
+      forEachColumn( [oldSize]( auto & column ) { if( column.size() > oldSize )   column.resize( oldSize ); } );
+      throw;
+    }
+  }
+
+
+
+
+  // clear()
+  template<typename... Fields>
+  void SoAVector<Fields...>::clear() noexcept
+  { forEachColumn( []( auto & column ) { column.clear(); } ); }
+
+
+
+
+
+
+
+
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Relational Operators
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // operator<=>
+  template<typename... Fields>
+  std::weak_ordering SoAVector<Fields...>::operator<=>( SoAVector const & rhs ) const
+  {
+    // Order like a vector of records would, row by row, and within a row, field by field
+    return std::lexicographical_compare_three_way( begin(), end(), rhs.begin(), rhs.end(),
+                                                   []( const_reference lhsRow,  const_reference rhsRow ) { return std::compare_weak_order_fallback( lhsRow, rhsRow ); } );
+  }
+
+
+
+
+  // operator==
+  template<typename... Fields>
+  bool SoAVector<Fields...>::operator==( SoAVector const & rhs ) const
+  {
+    // Equality doesn't care about order, so compare a whole column at a time - that's each Vector's operator==, vectorized for
+    // arithmetic fields.  The first column that differs settles it.
+    return _columns == rhs._columns;
+  }
+
+
+
+
+
+
+
+
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Private Helpers
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // forEachColumn()
+  template<typename... Fields>
+  template<typename Function>
+  void SoAVector<Fields...>::forEachColumn( Function function )
+  { std::apply( [&function]( auto &... column ) { ( function( column ), ... ); }, _columns ); }
+}    // namespace CSUF::CPSC131
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+/***********************************************************************************************************************************
+** (C) Copyright 2025 by Thomas Bettens. All Rights Reserved.
+**
+** DISCLAIMER: The participating authors at California State University's Computer Science Department have used their best efforts
+** in preparing this code. These efforts include the development, research, and testing of the theories and programs to determine
+** their effectiveness. The authors make no warranty of any kind, expressed or implied, with regard to these programs or to the
+** documentation contained within. The authors shall not be liable in any event for incidental or consequential damages in
+** connection with, or arising out of, the furnishing, performance, or use of these libraries and programs.  Distribution without
+** written consent from the authors is prohibited.
+***********************************************************************************************************************************/
+
+/**************************************************
+** Last modified:  27-JUL-2025 (Converted to C++ Modules)
+** Last Verified:  27-JUL-2025
+** Verified with:  MS Visual Studio 2022 Version 17.14.9,  Compiler Version 19.44.35213 (/std:c++latest)
+**                 GCC version 15.1.0 (-std=c++23 )
+**                 Clang version 21.0.0 (-std=c++23 -stdlib=libc++)
+***************************************************/
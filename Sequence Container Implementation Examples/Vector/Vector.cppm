@@ -17,6 +17,19 @@
 **  attempt to exceed capacity is detected.  An extendable capacity vector will acquire additional capacity if an attempt to exceed
 **  current capacity is detected making for an "unlimited" capacity.
 **
+**  A third flavor, the inline (or small buffer) vector, is an extendable vector with room for a few elements built right into the
+**  vector object itself.  As long as the elements fit, there's no dynamic memory allocation at all.  Once they don't, it moves
+**  them to the heap and carries on like any other extendable vector.
+**
+**  A fourth flavor, the memory mapped vector, is an extendable vector of trivially copyable elements whose array lives in memory
+**  mapped pages.  Opened on a file, the elements are the file's contents:  they're there the next time the file is opened, no
+**  reading or writing (serializing) required, and the operating system brings in only the pages actually touched.
+**
+**  FIXED and EXTENDABLE vectors can also be used during constant evaluation:  constructed, filled, searched, and iterated over at
+**  compile time.  Memory allocated during constant evaluation must be released before it ends, so to embed what was computed in the
+**  program, copy the elements into something like a std::array.  (INLINE and MAPPED vectors, and the parallel operations, are run
+**  time only.)
+**
 **  A vector reserves space for "Capacity" elements.  Elements are constructed on that space when inserted into the
 **  vector destructed when removed from the vector without releasing the space thus
 **  maintaining capacity whist decreasing size.
@@ -34,46 +47,146 @@ module;                                                                   // Glo
 export module CSUF.CPSC131.Vector;                                        // Primary Module Interface Definition
 import std;
 import CSUF.CPSC131.exceptionString;
+import CSUF.CPSC131.SimdKernels;
+import CSUF.CPSC131.ParallelChunks;
+import CSUF.CPSC131.MappedFile;
 
 
 export namespace CSUF::CPSC131
 {
   // Template Class Definition - Vector's Abstract Data Type Interface:
-  enum class VectorPolicy {FIXED, EXTENDABLE};
+  enum class VectorPolicy {FIXED, EXTENDABLE, INLINE, MAPPED};            // INLINE vectors are EXTENDABLE, but the first INLINE_CAPACITY elements live inside the vector object
+                                                                          // MAPPED vectors are EXTENDABLE, but the elements live in a memory mapped (optionally file backed) array
+
+
+
+  // Growth Policies - how much capacity an EXTENDABLE vector acquires when it runs out of room
+  //
+  // Growing by a constant factor keeps push_back() amortized constant time.  The larger the factor, the fewer times elements get
+  // moved but the more memory sits idle.  A factor less than the golden ratio (about 1.6) has another benefit:  after a few
+  // reallocations the blocks previously released add up to enough memory to satisfy the next request, so the allocator can reuse
+  // them.  Doubling always asks for more than everything released before it put together.  Growing by a fixed increment wastes
+  // the least memory, but insertion degrades to amortized linear time - use it only when the final size is about known.
+  //
+  // A growth policy is any default constructible function object given the current capacity and the minimum capacity required,
+  // returning the new capacity.  The vector never accepts less than the required capacity, no matter what the policy returns.
+  template<typename G>
+  concept VectorGrowthPolicy = std::default_initializable<G>  &&  requires( G const growth, std::size_t capacity )
+  {
+    { growth( capacity, capacity ) } -> std::convertible_to<std::size_t>;
+  };
+
+  template<std::size_t NUMERATOR, std::size_t DENOMINATOR = 1, std::size_t INITIAL = 8>
+  struct GrowByFactor                                                     // new capacity = current capacity * NUMERATOR / DENOMINATOR
+  {
+    static_assert( NUMERATOR > DENOMINATOR, "The growth factor must be greater than one" );
+
+    constexpr std::size_t operator()( std::size_t currentCapacity, std::size_t ) const noexcept
+    {
+      if( currentCapacity == 0 )                                                       return INITIAL;
+      if( currentCapacity > std::numeric_limits<std::size_t>::max() / NUMERATOR )     return std::numeric_limits<std::size_t>::max();  // saturate rather than wrap around
+      return std::max( currentCapacity * NUMERATOR / DENOMINATOR,  currentCapacity + 1 );
+    }
+  };
 
-  template<typename T, VectorPolicy POLICY = VectorPolicy::EXTENDABLE>
+  template<std::size_t INCREMENT>
+  struct GrowByIncrement                                                  // new capacity = current capacity + INCREMENT
+  {
+    static_assert( INCREMENT > 0, "The growth increment must be greater than zero" );
+
+    constexpr std::size_t operator()( std::size_t currentCapacity, std::size_t ) const noexcept
+    { return currentCapacity + INCREMENT; }
+  };
+
+  using GrowByDoubling     = GrowByFactor<2>;                             // The traditional choice, and the default
+  using GrowByOneAndAHalf  = GrowByFactor<3, 2>;                          // Trades a few more reallocations for less idle memory and reusable blocks
+
+
+
+  // Relocating an object means move constructing it somewhere else and then destroying the original.  For a trivially relocatable
+  // type that pair of operations amounts to nothing more than copying the object's bytes, so Vector can slide whole blocks of
+  // elements around with std::memcpy and std::memmove instead of moving and destroying them one at a time.  Every trivially
+  // copyable type qualifies.  So do many others (e.g., a type holding a std::unique_ptr), but the compiler can't tell, so opt
+  // your own types in by specializing this variable template:
+  //     template<>  constexpr bool CSUF::CPSC131::is_trivially_relocatable<MyType> = true;
+  //
+  // Beware:  a type that keeps a pointer into itself (e.g., many std::string implementations' short string buffer) is NOT
+  // trivially relocatable.
+  template<typename T>
+  constexpr bool is_trivially_relocatable = std::is_trivially_copyable_v<T>;
+
+
+
+
+  // The ALLOCATOR supplies (and takes back) the raw memory elements are constructed on.  The default, std::allocator<T>, goes to
+  // the global heap just like new[] and delete[] do.  A std::pmr::polymorphic_allocator<T> (see CSUF::CPSC131::pmr::Vector
+  // below) instead draws from whatever std::pmr::memory_resource it's given:  a monotonic arena released all at once, a pool, a
+  // counting wrapper, etc.  Note that only the array comes from the allocator, elements are constructed on it directly.
+  //
+  // INLINE_CAPACITY is the number of elements an INLINE vector holds without asking the allocator for anything, and must be zero
+  // for all other policies.  See InlineVector below for the convenient way to spell it.
+  //
+  // MAPPED vectors get their array from the operating system's memory mapping instead, so they never use the ALLOCATOR.
+  template<typename T, VectorPolicy POLICY = VectorPolicy::EXTENDABLE, VectorGrowthPolicy GROWTH = GrowByDoubling, typename ALLOCATOR = std::allocator<T>, std::size_t INLINE_CAPACITY = 0>
   class Vector
   {
-    template<typename U, VectorPolicy P>
-    friend void swap( Vector<U, P> & lhs, Vector<U, P> & rhs ) noexcept;  // The expected way to make a program-defined type swappable is to provide a non-member function swap in the same namespace as the type.
-                                                                          // (https://en.cppreference.com/w/cpp/algorithm/swap)
+    template<typename U, VectorPolicy P, VectorGrowthPolicy G, typename A, std::size_t N>
+    friend constexpr void swap( Vector<U, P, G, A, N> & lhs, Vector<U, P, G, A, N> & rhs ) noexcept( P != VectorPolicy::INLINE );  // The expected way to make a program-defined type swappable is to provide a non-member function swap in the same namespace as the type.
+                                                                                                                       // (https://en.cppreference.com/w/cpp/algorithm/swap)
+    static_assert( std::is_same_v<typename ALLOCATOR::value_type, T>, "The allocator must allocate objects of the vector's element type" );
+    static_assert( (POLICY == VectorPolicy::INLINE) == (INLINE_CAPACITY > 0), "INLINE vectors need an INLINE_CAPACITY, and only INLINE vectors may have one" );
+    static_assert( POLICY != VectorPolicy::MAPPED  ||  std::is_trivially_copyable_v<T>, "MAPPED vectors keep their elements' bytes in a file, so the elements must be trivially copyable (no pointers to the heap, no virtual functions, ...)" );
+
+    using AllocatorTraits = std::allocator_traits<ALLOCATOR>;              // Allocators are used through their traits, which fill in anything an allocator doesn't define
+
     public :
       // Types
       using iterator       = T*;                                          // A vector's iterator is-a raw pointer-to-T
       using const_iterator = T const *;                                   // Modifiable pointer to constant T.  Not to be confused with "const iterator" which is a const pointer to a modifiable T
+      using allocator_type = ALLOCATOR;
 
 
       // Constructors, destructor, and assignments
-      Vector            ( std::size_t                size = 0,   std::size_t capacity = 0 );          // Default constructor  Capacity defaults to size
-      Vector            ( Vector const             & original                             );          // Copy constructor  (Same POLICY)
-      Vector            ( Vector                  && original                             ) noexcept; // Move constructor  (Same POLICY)
-      Vector            ( std::initializer_list<T>   init_list                            );          // initialization list constructor
-      Vector & operator=( Vector const             & rhs                                  );          // Copy assignment   (Same POLICY)
-      Vector & operator=( Vector                  && rhs                                  ) noexcept; // Move assignment   (Same POLICY)
+      constexpr Vector            ( std::size_t                size = 0,   std::size_t capacity = 0,  ALLOCATOR const & allocator = ALLOCATOR() );  // Default constructor  Capacity defaults to size
+      constexpr Vector            ( Vector const             & original                             );          // Copy constructor  (Same POLICY)
+      constexpr Vector            ( Vector                  && original                             ) noexcept( POLICY != VectorPolicy::INLINE || std::is_nothrow_move_constructible_v<T> );  // Move constructor  (Same POLICY)
+      constexpr Vector            ( std::initializer_list<T>   init_list,                             ALLOCATOR const & allocator = ALLOCATOR() );  // initialization list constructor
+      constexpr Vector & operator=( Vector const             & rhs                                  );          // Copy assignment   (Same POLICY)
+      constexpr Vector & operator=( Vector                  && rhs                                  ) noexcept( POLICY != VectorPolicy::INLINE
+                                                                                                             && (   AllocatorTraits::propagate_on_container_move_assignment::value
+                                                                                                                 || AllocatorTraits::is_always_equal::value ) );  // Move assignment   (Same POLICY)
+
+      constexpr explicit Vector   ( ALLOCATOR const          & allocator                            );          // Empty vector drawing memory from allocator
+      constexpr Vector            ( Vector const             & original,  ALLOCATOR const & allocator );        // Copy constructor drawing memory from allocator
+      constexpr Vector            ( Vector                  && original,  ALLOCATOR const & allocator );        // Move constructor drawing memory from allocator (moves element by element if the allocators differ)
+                Vector            ( Vector const             & original,  parallel::Execution const & execution );  // Copy constructor copying a chunk of elements per thread
+
+                explicit Vector   ( std::filesystem::path const & file,  MapMode mode = MapMode::READ_WRITE ) requires( POLICY == VectorPolicy::MAPPED );  // Elements are file's contents.  READ_WRITE creates the file if needed, READ_ONLY never changes it
 
       // Not implemented, for now ...
-      template<VectorPolicy P>          Vector   ( Vector<T, P> const  & original )          = delete;// Copy constructor  (Mixed POLICY)
-      template<VectorPolicy P>          Vector   ( Vector<T, P>       && original ) noexcept = delete;// Move constructor  (Mixed POLICY)
-      template<VectorPolicy P> Vector & operator=( Vector<T, P> const  & rhs      )          = delete;// Copy assignment   (Mixed POLICY)
-      template<VectorPolicy P> Vector & operator=( Vector<T, P>       && rhs      ) noexcept = delete;// Move assignment   (Mixed POLICY)
+      template<VectorPolicy P, VectorGrowthPolicy G, typename A, std::size_t N>          Vector   ( Vector<T, P, G, A, N> const  & original )          = delete;// Copy constructor  (Mixed POLICY)
+      template<VectorPolicy P, VectorGrowthPolicy G, typename A, std::size_t N>          Vector   ( Vector<T, P, G, A, N>       && original ) noexcept = delete;// Move constructor  (Mixed POLICY)
+      template<VectorPolicy P, VectorGrowthPolicy G, typename A, std::size_t N> Vector & operator=( Vector<T, P, G, A, N> const  & rhs      )          = delete;// Copy assignment   (Mixed POLICY)
+      template<VectorPolicy P, VectorGrowthPolicy G, typename A, std::size_t N> Vector & operator=( Vector<T, P, G, A, N>       && rhs      ) noexcept = delete;// Move assignment   (Mixed POLICY)
 
-     ~Vector() noexcept;
+      constexpr ~Vector() noexcept;
 
 
       // Queries
-      std::size_t size    () const noexcept;
-      std::size_t capacity() const noexcept;
-      bool        empty   () const noexcept;
+      constexpr std::size_t size         () const noexcept;
+      constexpr std::size_t capacity     () const noexcept;
+      constexpr bool        empty        () const noexcept;
+      constexpr ALLOCATOR   get_allocator() const noexcept;
+
+
+      // Capacity management
+      constexpr void reserve      ( std::size_t newCapacity );            // Grows capacity to at least newCapacity in one step.  FIXED vectors can't grow and throw std::overflow_error
+      constexpr void shrink_to_fit(                         );            // Releases unused capacity (EXTENDABLE vectors only, FIXED capacity never changes)
+
+
+      // Persistence (MAPPED vectors only, does nothing unless opened READ_WRITE on a file)
+      void flush() requires( POLICY == VectorPolicy::MAPPED );            // Records size() in the file and schedules the elements to be written, returns right away
+      void sync () requires( POLICY == VectorPolicy::MAPPED );            // Records size() in the file and writes the elements, returns once they're stored
 
 
       // Iterators
@@ -86,39 +199,65 @@ export namespace CSUF::CPSC131
 
 
       // Accessors
-      T const & at        ( std::size_t index ) const;                    // Read-only access to the vector's contents.  Checks bounds, throws std::range_error
-      T       & at        ( std::size_t index );                          // Read-write access to the vector's contents.  Checks bounds, throws std::out_of_range
-      T const & operator[]( std::size_t index ) const;                    // Read-only access to the vector's contents.  No bounds checking
-      T       & operator[]( std::size_t index );                          // Read-write access to the vector's contents.  No bounds checking
+      constexpr T const & at        ( std::size_t index ) const;          // Read-only access to the vector's contents.  Checks bounds, throws std::range_error
+      constexpr T       & at        ( std::size_t index );                // Read-write access to the vector's contents.  Checks bounds, throws std::out_of_range
+      constexpr T const & operator[]( std::size_t index ) const;          // Read-only access to the vector's contents.  No bounds checking
+      constexpr T       & operator[]( std::size_t index );                // Read-write access to the vector's contents.  No bounds checking
 
-      T const & front() const;                                            // Read-only access to the vector's front value.  Checks bounds, throws std::range_error
-      T       & front();                                                  // Read-write access to the vector's front value.  Checks bounds, throws std::range_error
-      T const & back () const;                                            // Read-only access to the vector's back value.  Checks bounds, throws std::range_error
-      T       & back ();                                                  // Read-write access to the vector's back value.  Checks bounds, throws std::range_error
+      constexpr T const & front() const;                                  // Read-only access to the vector's front value.  Checks bounds, throws std::range_error
+      constexpr T       & front();                                        // Read-write access to the vector's front value.  Checks bounds, throws std::range_error
+      constexpr T const & back () const;                                  // Read-only access to the vector's back value.  Checks bounds, throws std::range_error
+      constexpr T       & back ();                                        // Read-write access to the vector's back value.  Checks bounds, throws std::range_error
+
+
+      // Searches - vectorized (SIMD) for arithmetic element types, see SimdKernels.cppm
+      constexpr iterator       find       ( T const & value );            // First element equal to value, end() if there is none
+      constexpr const_iterator find       ( T const & value ) const;      // First element equal to value, end() if there is none
+      constexpr std::size_t    count      ( T const & value ) const;      // Number of elements equal to value
+      constexpr bool           contains   ( T const & value ) const;
+      constexpr const_iterator min_element(                 ) const;      // First smallest element, end() if the vector is empty
+      constexpr const_iterator max_element(                 ) const;      // First largest element, end() if the vector is empty
 
 
       // Modifiers
-      void push_back( T const & value );                                  // Checks capacity, throws std::overflow_error
-      void pop_back (                 );                                  // Checks size, throws std::underflow_error
+      constexpr void push_back( T const  & value );                       // Checks capacity, throws std::overflow_error
+      constexpr void push_back( T       && value );                       // Checks capacity, throws std::overflow_error
+      constexpr void pop_back (                  );                       // Checks size, throws std::underflow_error
+
+      template<typename... Args>
+      constexpr T &  emplace_back( Args &&... args );                     // Constructs the new element in place at the back.  Checks capacity, throws std::overflow_error
+
+      constexpr iterator erase ( iterator       position );                     // Checks bounds, throws std::out_of_range
+      constexpr iterator erase ( const_iterator position );                     // Checks bounds, throws std::out_of_range
+      constexpr iterator erase ( const_iterator first,  const_iterator last );  // Removes [first, last) shifting the tail only once.  Checks bounds, throws std::out_of_range
 
-      iterator erase ( iterator       position );                         // Checks bounds, throws std::out_of_range
-      iterator erase ( const_iterator position );                         // Checks bounds, throws std::out_of_range
+      constexpr iterator insert( iterator       beforePosition,  T const  & value );// Checks capacity, throws std::overflow_error
+      constexpr iterator insert( const_iterator beforePosition,  T const  & value );// Checks capacity, throws std::overflow_error
+      constexpr iterator insert( iterator       beforePosition,  T       && value );// Checks capacity, throws std::overflow_error
+      constexpr iterator insert( const_iterator beforePosition,  T       && value );// Checks capacity, throws std::overflow_error
 
-      iterator insert( iterator       beforePosition,  T const &value );  // Checks capacity, throws std::overflow_error
-      iterator insert( const_iterator beforePosition,  T const &value );  // Checks capacity, throws std::overflow_error
+      template<std::input_iterator InputIterator>                         // Inserts copies of [first, last) growing capacity at most once and shifting the tail once.
+      constexpr iterator insert( const_iterator beforePosition,  InputIterator first,  InputIterator last );  // [first, last) must not refer to this vector.  Checks capacity, throws std::overflow_error
 
-      void clear() noexcept;                                              // Sets size() to zero.  capacity() is unchanged
+      template<typename... Args>
+      constexpr iterator emplace( const_iterator beforePosition,  Args &&... args );// Constructs the new element in place.  Checks capacity, throws std::overflow_error
+
+      constexpr void resize( std::size_t newSize                  );      // Default constructs or destroys elements at the back.  Checks capacity, throws std::overflow_error
+      constexpr void resize( std::size_t newSize,  T const & value );     // Copies value into, or destroys elements at, the back.  Checks capacity, throws std::overflow_error
+      void resize( std::size_t newSize,  T const & value,  parallel::Execution const & execution );  // Same, but the new elements are copied a chunk per thread
+
+      constexpr void clear() noexcept;                                    // Sets size() to zero.  capacity() is unchanged
 
 
       // Relational Operators
-      std::weak_ordering operator<=>( Vector const & rhs ) const;
-      bool               operator== ( Vector const & rhs ) const;
+      constexpr std::weak_ordering operator<=>( Vector const & rhs ) const;
+      constexpr bool               operator== ( Vector const & rhs ) const;
 
 
 
     private:
-      // Design choice:  Use raw memory.  Note, however, that when the smart pointer "_array" is destroyed or reset, the allocated
-      // raw memory is released, but objects placed in that raw memory are NOT destroyed.
+      // Design choice:  Use raw memory.  Note, however, that when the raw memory "_array" points to is returned to the allocator,
+      // objects placed in that raw memory are NOT destroyed.
       //
       // Another design option is to use an array of std::optional<T>. This has the advantage having objects destroyed when "_array"
       // is destroyed and makes the implementing code simpler, but incurs 4 to 8 bytes (1 byte to hold the status, and the rest due
@@ -137,18 +276,100 @@ export namespace CSUF::CPSC131
       // example, could change from O(n) to O(1).  Such optimization can be sprinkled through the implementing code, which I've done.
       //   std::unique_ptr< T[] > _array  = nullptr;                      // Considered and discarded
       //
+      // Earlier versions held a std::unique_ptr<RawMemory[]>, but that ties the vector to new[] and delete[].  An allocator hands
+      // out the very same thing, uninitialized memory for n objects, from wherever it likes.  Note that std::make_unique<RawMemory[]>(n)
+      // (value initialization) also zero fills that memory - a complete waste since nothing is there until constructed.  An
+      // allocator doesn't.
+      //
       using RawMemory = struct alignas(T) {std::byte bytes[sizeof(T)]; }; // Enough properly aligned uninitialized (raw) memory for one object of type T
                                                                           // See https://en.cppreference.com/w/cpp/language/alignas
                                                                           //     https://en.cppreference.com/w/cpp/types/aligned_storage (deprecated in C++23)
       // Attributes
-      // Note:  Physical ordering of _size, _capacity, and _array is required for construction and must be maintained
-      std::size_t                   _size     = 0;                        // Number of elements in the data structure
-      std::size_t                   _capacity = 0;                        // Length of the array
-      std::unique_ptr<RawMemory[]>  _array    = nullptr;                  // Smart pointer to dynamically allocated array
+      // Note:  Physical ordering of _allocator, _size, _capacity, and _array is required for construction and must be maintained
+      [[no_unique_address]] ALLOCATOR _allocator;                         // Stateless allocators (e.g., std::allocator) take up no space
+      std::size_t                     _size     = 0;                      // Number of elements in the data structure
+      std::size_t                     _capacity = 0;                      // Length of the array
+      T *                             _array    = nullptr;                // Pointer to the allocator supplied array (or _inline), nullptr when capacity is zero
+
+      // INLINE vectors carry room for INLINE_CAPACITY elements around with them.  While the elements fit, _array points here and no
+      // dynamic memory is used at all.  Other vectors get an empty placeholder that takes up no space.
+      struct NoInlineStorage {};
+      using  InlineStorage = std::conditional_t<INLINE_CAPACITY == 0, NoInlineStorage, std::array<RawMemory, INLINE_CAPACITY>>;
+      [[no_unique_address]] InlineStorage _inline;
+
+      // MAPPED vectors own a memory mapping with a small header in front of the array.  The header identifies the file's content
+      // and records the vector's size, so the elements can be found again the next time the file is opened.  The header is padded
+      // to a full cache line, which also keeps the elements that follow it aligned.
+      //           +----------+------+------+------+------+------+
+      //           |  header  |  e1  |  e2  |  e3  |      |      |    file (or anonymous memory) size = header + capacity elements
+      //           +----------+------+------+------+------+------+
+      //           0          64
+      struct NoMappedStorage {};
+      using  MappedStorage = std::conditional_t<POLICY == VectorPolicy::MAPPED, MappedFile, NoMappedStorage>;
+      [[no_unique_address]] MappedStorage _mapping;
+
+      struct alignas(64) MappedHeader
+      {
+        char          magic[8]    = { 'C', 'S', 'U', 'F', '1', '3', '1', 'V' };
+        std::uint64_t elementSize = sizeof( T );                          // Guards against opening a file of some other element type
+        std::uint64_t size        = 0;                                    // Number of elements, recorded by flush(), sync(), and the destructor
+      };
+      static_assert( POLICY != VectorPolicy::MAPPED  ||  alignof( T ) <= alignof( MappedHeader ), "MAPPED vector elements can't be aligned beyond 64 bytes" );
 
       // Helper functions
-      void reserve( std::size_t newCapacity );                            // Helper function to change capacity (extendable vector only)
+      struct AllocateOnly {};                                             // Tag selecting the constructor below
+      constexpr Vector( AllocateOnly,  std::size_t capacity,  ALLOCATOR const & allocator );  // Obtains an empty array, all other constructors delegate to this one
+
+      constexpr T *         allocate    ( std::size_t capacity         );           // Raw memory for capacity elements from _allocator (or _inline if they fit), nullptr if capacity is zero
+      constexpr void        deallocate  (                              ) noexcept;  // Returns the array (not the elements!) to _allocator
+      constexpr T *         inlineArray (                              ) noexcept;  // INLINE vector's built-in array, nullptr for other vectors
+      constexpr bool        isInline    (                              ) const noexcept;  // True if the elements currently live in the built-in array
+      constexpr T *         mappedArray (                              ) noexcept;  // MAPPED vector's array, just past the header, nullptr for other vectors
+      constexpr void        recordSize  (                              ) noexcept;  // Writes _size into a MAPPED vector's header
+      constexpr std::size_t nextCapacity( std::size_t requiredCapacity ) const;     // Asks the GROWTH policy how big to grow, but never less than required
+      constexpr void        reallocate  ( std::size_t newCapacity      );           // Moves the elements to a new array of exactly newCapacity (must be at least _size)
+
+      template<typename Construct>                                        // Adds count elements at the back, a chunk per thread.  construct( destination, first, last )
+      void constructConcurrently( std::size_t count,  parallel::Execution const & execution,  Construct construct );   // builds new elements [first, last) starting at destination
   };
+
+
+
+  // Vectors drawing their memory from a std::pmr::memory_resource, for example:
+  //     std::pmr::monotonic_buffer_resource  arena;
+  //     CSUF::CPSC131::pmr::Vector<int>       v( &arena );             // v's array comes from, and is given back to, arena
+  namespace pmr
+  {
+    template<typename T, VectorPolicy POLICY = VectorPolicy::EXTENDABLE, VectorGrowthPolicy GROWTH = GrowByDoubling>
+    using Vector = CSUF::CPSC131::Vector<T, POLICY, GROWTH, std::pmr::polymorphic_allocator<T>>;
+  }
+
+
+
+  // Vectors holding up to N elements inside themselves, for example:
+  //     CSUF::CPSC131::InlineVector<Student, 16>  v;                    // No dynamic memory until the 17th student arrives
+  template<typename T, std::size_t N, VectorGrowthPolicy GROWTH = GrowByDoubling, typename ALLOCATOR = std::allocator<T>>
+  using InlineVector = Vector<T, VectorPolicy::INLINE, GROWTH, ALLOCATOR, N>;
+
+
+
+  // Vectors whose elements live in memory mapped pages, for example:
+  //     CSUF::CPSC131::MappedVector<double>  samples( "samples.dat" );  // Whatever was in samples.dat, ready to go
+  //     samples.push_back( 98.6 );                                      // samples.dat grows along with the vector
+  // Vectors not opened on a file get anonymous mapped memory.  So do copies, even copies of vectors opened on a file.
+  template<typename T, VectorGrowthPolicy GROWTH = GrowByDoubling>
+  using MappedVector = Vector<T, VectorPolicy::MAPPED, GROWTH>;
+
+
+
+  // Removes every element equal to value, or for which predicate returns true, compacting the vector in a single pass.  Returns
+  // the number of elements removed.  For example:
+  //     erase_if( students, []( Student const & s ) { return s.semesters() > 12; } );
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY, typename U>
+  constexpr std::size_t erase   ( Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY> & vector,  U const & value );
+
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY, typename Predicate>
+  constexpr std::size_t erase_if( Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY> & vector,  Predicate predicate );
 }    // export namespace CSUF::CPSC131
 
 
@@ -175,66 +396,294 @@ export namespace CSUF::CPSC131
 ***********************************************************************************************************************************/
 namespace CSUF::CPSC131
 {
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Constant evaluation stand-ins
+  //
+  // Vectors can be built, searched, and modified during constant evaluation, say to compute a lookup table at compile time.  But
+  // the standard's uninitialized memory algorithms don't become constexpr until C++26, and copying an object's bytes (std::memmove,
+  // std::memcpy) is never allowed at compile time.  These do the very same thing:  at run time they hand the work to the standard
+  // versions, at compile time they construct (and for relocate, destroy) one element at a time with std::construct_at.
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // Copy constructs [first, last) in the raw memory starting at destination
+  template<typename InputIterator, typename T>
+  constexpr T * uninitializedCopy( InputIterator first,  InputIterator last,  T * destination )
+  {
+    if !consteval { return std::uninitialized_copy( first, last, destination ); }
+
+    for( ;  first != last;  ++first, ++destination )   std::construct_at( destination, *first );
+    return destination;
+  }
+
+
+
+
+  // Move constructs [first, last) in the raw memory starting at destination
+  template<typename T>
+  constexpr T * uninitializedMove( T * first,  T * last,  T * destination )
+  {
+    if !consteval { return std::uninitialized_move( first, last, destination ); }
+
+    for( ;  first != last;  ++first, ++destination )   std::construct_at( destination, std::move( *first ) );
+    return destination;
+  }
+
+
+
+
+  // Value (default) constructs objects in the raw memory [first, last)
+  template<typename T>
+  constexpr void uninitializedValueConstruct( T * first,  T * last )
+  {
+    if !consteval { std::uninitialized_value_construct( first, last );  return; }
+
+    for( ;  first != last;  ++first )   std::construct_at( first );
+  }
+
+
+
+
+  // Copy constructs value in each slot of the raw memory [first, last)
+  template<typename T>
+  constexpr void uninitializedFill( T * first,  T * last,  T const & value )
+  {
+    if !consteval { std::uninitialized_fill( first, last, value );  return; }
+
+    for( ;  first != last;  ++first )   std::construct_at( first, value );
+  }
+
+
+
+
+  // Relocates the trivially relocatable objects [first, last) to the raw memory starting at destination, leaving raw memory behind.
+  // Like std::move, the destination may overlap the end of [first, last) but not the beginning (i.e., shifting left is fine).
+  template<typename T>
+  constexpr T * relocate( T * first,  T * last,  T * destination ) noexcept
+  {
+    if !consteval
+    {
+      if( first != last )   std::memmove( static_cast<void *>( destination ), static_cast<void const *>( first ), (last - first) * sizeof( T ) );
+      return destination + (last - first);
+    }
+
+    for( ;  first != last;  ++first, ++destination )
+    {
+      std::construct_at( destination, std::move( *first ) );
+      std::destroy_at( first );
+    }
+    return destination;
+  }
+
+
+
+
+  // Relocates the trivially relocatable objects [first, last) to the raw memory ending at destinationLast, leaving raw memory
+  // behind.  Like std::move_backward, the destination may overlap the beginning of [first, last) (i.e., shifting right is fine).
+  template<typename T>
+  constexpr T * relocateBackward( T * first,  T * last,  T * destinationLast ) noexcept
+  {
+    if !consteval { return relocate( first, last, destinationLast - (last - first) ); }   // std::memmove doesn't care which way they overlap
+
+    while( first != last )
+    {
+      std::construct_at( --destinationLast, std::move( *--last ) );
+      std::destroy_at( last );
+    }
+    return destinationLast;
+  }
+
+
+
+
+
+
+
+
+
+
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
   // Constructors, destructor, and assignments
   //
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-  // Default constructor (both parameters are defaulted in function's declaration)
-  template <typename T, VectorPolicy POLICY>
-  Vector<T, POLICY>::Vector( std::size_t size, std::size_t capacity )
-    : _size    { size },
-      _capacity{ size > capacity  ?  size  :  (POLICY == VectorPolicy::FIXED && capacity == 0  ? 64 : capacity) },    // Capacity can never be less than size, and a Fixed Capacity Vector can never be 0
-      _array   { std::make_unique<RawMemory[]>( _capacity ) }             // Pre-allocate an array of raw memory
+  // Allocate only construction (private) - all other constructors delegate to this one
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::Vector( AllocateOnly,  std::size_t capacity,  ALLOCATOR const & allocator )
+    : _allocator{ allocator                                  },
+      _size     { 0                                          },           // Delegating constructors add the elements
+      _capacity { std::max( capacity, INLINE_CAPACITY )      },           // INLINE vectors always have at least their built-in capacity
+      _array    { POLICY == VectorPolicy::MAPPED  ?  nullptr  :  allocate( _capacity ) }   // Pre-allocate an array of raw memory
+  {
+    // A MAPPED vector's array lives in _mapping, which is declared (and so constructed) after _array.  Mapping it in the
+    // initialization list would be overwritten as soon as _mapping is default initialized, so it's mapped here instead.
+    if constexpr( POLICY == VectorPolicy::MAPPED )   _array = allocate( _capacity );
+
+    // Once a delegated to constructor finishes, the object officially exists.  So if constructing elements in the delegating
+    // constructor's body throws, the destructor runs and the array goes back to the allocator - no leak, no try/catch needed.
+  }
+
+
+
+
+  // Default constructor (all parameters are defaulted in function's declaration)
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::Vector( std::size_t size, std::size_t capacity, ALLOCATOR const & allocator )
+    : Vector( AllocateOnly{},
+              size > capacity  ?  size  :  (POLICY == VectorPolicy::FIXED && capacity == 0  ? 64 : capacity),    // Capacity can never be less than size, and a Fixed Capacity Vector can never be 0
+              allocator )
+  {
+    uninitializedValueConstruct( begin(), begin() + size );               // Default construct size new elements placing them in _array's pre-allocated memory
+    _size = size;                                                         // See https://en.cppreference.com/w/cpp/memory/uninitialized_value_construct
+  }
+
+
+
+
+  // Copy construction in parallel (Same POLICY)
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::Vector( const Vector & original,  parallel::Execution const & execution )
+    : Vector( AllocateOnly{},
+              POLICY == VectorPolicy::FIXED ? original._capacity : original._size,
+              AllocatorTraits::select_on_container_copy_construction( original._allocator ) )
+  {
+    // Same as the copy constructor, except each thread copies its own chunk of the elements.  Note that T's copy constructor runs
+    // on several threads at once, so it must not touch anything shared (e.g., an unprotected class attribute counting instances).
+    constructConcurrently( original._size, execution, [&original]( T * destination,  std::size_t first,  std::size_t last )
+    { std::uninitialized_copy( original.begin() + first, original.begin() + last, destination ); } );
+  }
+
+
+
+
+  // Allocator construction
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::Vector( ALLOCATOR const & allocator )
+    : Vector( 0, 0, allocator )
+  {}
+
+
+
+
+  // File construction (MAPPED POLICY)
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::Vector( std::filesystem::path const & file,  MapMode mode ) requires( POLICY == VectorPolicy::MAPPED )
+    : Vector( AllocateOnly{}, 0, ALLOCATOR() )
   {
-    std::uninitialized_value_construct_n( begin(), _size );               // Default construct _size new elements placing them in _array's pre-allocated memory
-  }                                                                       // See https://en.cppreference.com/w/cpp/memory/uninitialized_value_construct_n
+    MappedFile mapping( file, mode );
+
+    if( mapping.size() == 0 )                                             // A brand new (or empty) file
+    {
+      if( mode == MapMode::READ_ONLY )   return;                          // Nothing to read, and we mustn't write, so just stay empty
+      mapping.resize( sizeof( MappedHeader ) );
+      ::new( static_cast<void *>( mapping.data() ) ) MappedHeader{};
+    }
+
+    else
+    {
+      // Everything in the file is taken at its word, so first make sure it's a file we wrote for elements just like ours and
+      // that it really is as long as the header says it is
+      MappedHeader const expected{};
+      auto const *       header = reinterpret_cast<MappedHeader const *>( mapping.data() );
+
+      if(    mapping.size() < sizeof( MappedHeader )
+          || !std::ranges::equal( header->magic, expected.magic )
+          || header->elementSize != sizeof( T )
+          || header->size > (mapping.size() - sizeof( MappedHeader )) / sizeof( T ) )
+      {
+        throw std::runtime_error( exceptionString( '"' + file.string() + "\" doesn't hold a vector of elements this size" ) );
+      }
+      _size = header->size;                                               // Trivially copyable, so the bytes already are the elements
+    }
+
+    _capacity = (mapping.size() - sizeof( MappedHeader )) / sizeof( T );
+    _mapping  = std::move( mapping );
+    _array    = mappedArray();
+  }
 
 
 
   // Copy construction (Same POLICY)
-  template <typename T, VectorPolicy POLICY>
-  Vector<T, POLICY>::Vector( const Vector & original )
-    : _size    { original._size },
-      _capacity{ POLICY == VectorPolicy::EXTENDABLE ? original._size : original._capacity },    // Let extendable vectors shrink-to-fit
-      _array   { std::make_unique<RawMemory[]>( _capacity ) }                                   // Pre-allocate an array of raw memory
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::Vector( const Vector & original )
+    : Vector( original, AllocatorTraits::select_on_container_copy_construction( original._allocator ) )   // The allocator decides what a copy of it should be
+  {}
+
+
+
+
+  // Copy construction with allocator (Same POLICY)
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::Vector( const Vector & original,  ALLOCATOR const & allocator )
+    : Vector( AllocateOnly{}, POLICY == VectorPolicy::FIXED ? original._capacity : original._size, allocator )    // Let extendable (and inline) vectors shrink-to-fit
   {
-    std::uninitialized_copy( original.begin(), original.end(), begin() ); // Deep copy - copy elements from original placing them in _array's pre-allocated memory
-  }                                                                       // See https://en.cppreference.com/w/cpp/memory/uninitialized_copy
+    uninitializedCopy( original.begin(), original.end(), begin() );       // Deep copy - copy elements from original placing them in _array's pre-allocated memory
+    _size = original._size;                                               // See https://en.cppreference.com/w/cpp/memory/uninitialized_copy
+  }
 
 
 
 
   // Move construction (Same POLICY)
-  template <typename T, VectorPolicy POLICY>
-  Vector<T, POLICY>::Vector( Vector && original ) noexcept
-    : _size    { original._size               },                          // Steal the resources from original
-      _capacity{ original._capacity           },
-      _array   { std::move( original._array ) }                           // Shallow copy - move the pointer, not what the pointer points to
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::Vector( Vector && original ) noexcept( POLICY != VectorPolicy::INLINE || std::is_nothrow_move_constructible_v<T> )
+    : Vector( std::move( original ), original._allocator )                // The array travels with the allocator that can release it.  A copy of
+  {}                                                                      // an allocator always compares equal to it, so this never throws
+
+
+
+
+  // Move construction with allocator (Same POLICY)
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::Vector( Vector && original,  ALLOCATOR const & allocator )
+    : Vector( AllocateOnly{}, 0, allocator )
   {
-    original._size     = 0;                                               // Leave original in an undetermined but valid state
-    original._capacity = POLICY == VectorPolicy::EXTENDABLE ? 0 : original._capacity;
-    original._array    = std::make_unique<RawMemory[]>( original._capacity );
+    // Our allocator can release original's array, so steal it.  Unless it's the array built into original, of course, that one
+    // can't leave original.
+    if( _allocator == original._allocator  &&  !original.isInline() )
+    {
+      _size     = std::exchange( original._size,  0       );              // Steal the resources from original
+      _capacity = original._capacity;
+      _array    = std::exchange( original._array, nullptr );              // Shallow copy - move the pointer, not what the pointer points to
+      if constexpr( POLICY == VectorPolicy::MAPPED )   _mapping = std::move( original._mapping );   // along with the mapping it points into
+
+      // Leave original in an undetermined but valid state.  FIXED vectors always have their capacity, the others start over with
+      // their minimum (zero, or the built-in capacity)
+      std::size_t const capacity = POLICY == VectorPolicy::FIXED ? original._capacity : INLINE_CAPACITY;
+      original._array    = original.allocate( capacity );
+      original._capacity = capacity;
+    }
+
+    else                                                                  // It can't, so use our own array and move the elements one at a time
+    {
+      std::size_t const capacity = std::max( POLICY == VectorPolicy::FIXED ? original._capacity : original._size,  INLINE_CAPACITY );
+      if( capacity != _capacity )
+      {
+        _array    = allocate( capacity );                                 // The array we have is either nothing or built-in, nothing to release
+        _capacity = capacity;
+      }
+      uninitializedMove( original.begin(), original.end(), begin() );
+      _size = original._size;
+    }
   }
 
 
 
+
   // Initialization List construction
-  template<typename T, VectorPolicy POLICY>
-  Vector<T, POLICY>::Vector( std::initializer_list<T> init_list )
-    : _size    { init_list.size()                           },
-      _capacity{ init_list.size()                           },
-      _array   { std::make_unique<RawMemory[]>( _capacity ) }             // Pre-allocate an array of raw memory
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::Vector( std::initializer_list<T> init_list,  ALLOCATOR const & allocator )
+    : Vector( AllocateOnly{}, init_list.size(), allocator )
   {
-    std::uninitialized_copy(init_list.begin(), init_list.end(), begin()); // Deep copy - copy elements from initializer list placing them in _array's pre-allocated memory
-  }                                                                       // See https://en.cppreference.com/w/cpp/memory/uninitialized_copy (initializer lists have constant element and cannot be moved)
+    uninitializedCopy( init_list.begin(), init_list.end(), begin() );     // Deep copy - copy elements from initializer list placing them in _array's pre-allocated memory
+    _size = init_list.size();                                             // See https://en.cppreference.com/w/cpp/memory/uninitialized_copy (initializer lists have constant element and cannot be moved)
+  }
 
 
 
 
   // Copy assignment (Same POLICY)
-  template<typename T, VectorPolicy POLICY>
-  Vector<T, POLICY> & Vector<T, POLICY>::operator=( Vector const & rhs )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY> & Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::operator=( Vector const & rhs )
   {
     // Note: The copy-swap idiom was considered and rejected for efficiency and to protect the capacity of FIXED capacity vectors
     //       from changing. If we allowed fixed capacity vectors to assume the capacity of the right hand side this whole function
@@ -259,14 +708,33 @@ namespace CSUF::CPSC131
     if( this == &rhs )    return *this;                                   // Self assignment guard
 
 
+    // Some allocators ask to be copied along with the elements.  If ours is different, our array must first be returned to the
+    // allocator it came from.
+    if constexpr( AllocatorTraits::propagate_on_container_copy_assignment::value )
+    {
+      if( _allocator != rhs._allocator )
+      {
+        std::size_t const capacity = POLICY == VectorPolicy::FIXED ? _capacity : INLINE_CAPACITY;   // FIXED vectors keep their capacity
+        clear();
+        deallocate();
+        _array     = nullptr;
+        _capacity  = 0;
+        _allocator = rhs._allocator;
+        _array     = allocate( capacity );
+        _capacity  = capacity;
+      }
+      else   _allocator = rhs._allocator;
+    }
+
+
     std::size_t extent = 0;                                               // Determine how many elements to copy
-    if constexpr( POLICY == VectorPolicy::EXTENDABLE )
+    if constexpr( POLICY != VectorPolicy::FIXED )
     {
       extent = rhs._size;                                                 // The number of elements to be copied from the rhs
       if( extent > _capacity )
       {
         clear();                                                          // Avoid moving elements to a bigger array, they're going to be overwritten anyway
-        reserve( extent );                                                // EXTENDABLE vectors can grow
+        reserve( extent );                                                // EXTENDABLE (and INLINE) vectors can grow
       }
     }
     else  extent = std::min( _capacity, rhs._size );                      // FIXED capacity vectors are capped
@@ -275,7 +743,7 @@ namespace CSUF::CPSC131
     if (_size < extent)                                                   // Copy assign up to _size elements, then construct the rest
     {
       std::copy_n( rhs.begin(), _size, begin() );
-      std::uninitialized_copy( rhs.begin() + _size, rhs.begin() + extent, begin() + _size );
+      uninitializedCopy( rhs.begin() + _size, rhs.begin() + extent, begin() + _size );
     }
     else                                                                  // Copy assign up to extent elements,  then destroy the rest
     {
@@ -291,29 +759,54 @@ namespace CSUF::CPSC131
 
 
   // Move assignment (Same POLICY)
-  template<typename T, VectorPolicy POLICY>
-  Vector<T, POLICY> & Vector<T, POLICY>::operator=( Vector && rhs ) noexcept
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY> & Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::operator=( Vector && rhs ) noexcept( POLICY != VectorPolicy::INLINE
+                                                                                                                                                   && (   AllocatorTraits::propagate_on_container_move_assignment::value
+                                                                                                                                                       || AllocatorTraits::is_always_equal::value ) )
   {
     if( this == &rhs )    return *this;                                   // Self assignment guard
 
 
-    if( POLICY == VectorPolicy::EXTENDABLE  ||  _capacity == rhs._capacity )
+    // Arrays can simply be exchanged as long as each one stays with an allocator able to release it.  That's the case when the
+    // allocators are equal, or when the allocators are exchanged right along with the arrays.  An array built into a vector, on
+    // the other hand, can never be exchanged.
+    constexpr bool propagate = AllocatorTraits::propagate_on_container_move_assignment::value;
+
+    if(    ( POLICY != VectorPolicy::FIXED  ||  _capacity == rhs._capacity )
+        && ( propagate  ||  _allocator == rhs._allocator )
+        && !isInline()  &&  !rhs.isInline() )
     {
-      swap( *this, rhs );                                                 // Shallow copy (exchange) each attribute
+      using std::swap;
+      if constexpr( propagate )   swap( _allocator, rhs._allocator );
+      swap( _size,     rhs._size     );                                   // Shallow copy (exchange) each attribute
+      swap( _capacity, rhs._capacity );
+      swap( _array,    rhs._array    );
+      if constexpr( POLICY == VectorPolicy::MAPPED )   swap( _mapping, rhs._mapping );
     }
 
-    else
+    else                                                                  // Otherwise the elements must be moved one at a time
     {
-      std::size_t extent = std::min( _capacity, rhs._size );              // The number of elements to be copied from the rhs
+      std::size_t extent = 0;                                             // Determine how many elements to move
+      if constexpr( POLICY != VectorPolicy::FIXED )
+      {
+        extent = rhs._size;
+        if( extent > _capacity )
+        {
+          clear();
+          reserve( extent );
+        }
+      }
+      else  extent = std::min( _capacity, rhs._size );                    // FIXED capacity vectors are capped
+
       if (_size < extent)                                                 // Move assign up to _size elements, then construct the rest
       {
         std::move              ( rhs.begin(),         rhs.begin() + _size,  begin()         );
-        std::uninitialized_move( rhs.begin() + _size, rhs.begin() + extent, begin() + _size );
+        uninitializedMove      ( rhs.begin() + _size, rhs.begin() + extent, begin() + _size );
       }
       else                                                                // Move assign up to extent elements,  then destroy the rest
       {
-        std::move   ( rhs.begin(),      begin() + extent, begin() );
-        std::destroy( begin() + extent, begin() + _size           );
+        std::move   ( rhs.begin(),      rhs.begin() + extent, begin() );
+        std::destroy( begin() + extent, begin() + _size               );
       }
       _size = extent;
     }
@@ -325,9 +818,13 @@ namespace CSUF::CPSC131
 
 
   // Destruction
-  template<typename T, VectorPolicy POLICY>
-  Vector<T, POLICY>::~Vector() noexcept
-  { clear(); }
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::~Vector() noexcept
+  {
+    recordSize();                                                         // A file backed vector's size must outlive the vector
+    clear();                                                              // Destroy the elements, then
+    deallocate();                                                         // give the raw memory back
+  }
 
 
 
@@ -346,24 +843,32 @@ namespace CSUF::CPSC131
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
   // size() const
-  template<typename T, VectorPolicy POLICY>
-  std::size_t   Vector<T, POLICY>::size() const noexcept
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr std::size_t   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::size() const noexcept
   { return _size; }
 
 
 
 
   // capacity() const
-  template<typename T, VectorPolicy POLICY>
-  std::size_t   Vector<T, POLICY>::capacity() const noexcept
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr std::size_t   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::capacity() const noexcept
   { return _capacity; }
 
 
 
 
+  // get_allocator() const
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr ALLOCATOR   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::get_allocator() const noexcept
+  { return _allocator; }
+
+
+
+
   // empty() const
-  template<typename T, VectorPolicy POLICY>
-  bool   Vector<T, POLICY>::empty() const noexcept
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr bool   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::empty() const noexcept
   { return size() == 0; }
 
 
@@ -375,6 +880,77 @@ namespace CSUF::CPSC131
 
 
 
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Capacity management
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // reserve()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr void   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::reserve( std::size_t newCapacity )
+  {
+    // Callers who know (or can estimate) how many elements are coming can pay for a single reallocation up front instead of the
+    // log(n) reallocations, each moving every element, that growing one push_back() at a time costs.  Asking for less than the
+    // current capacity is not an error, it just doesn't do anything.
+    if( newCapacity <= _capacity )   return;
+
+    if constexpr( POLICY == VectorPolicy::FIXED )   throw std::overflow_error( exceptionString( std::format( "Fixed capacity vectors cannot grow\n"
+                                                                                                             "   Capacity:           {}\n"
+                                                                                                             "   Capacity Requested: {}",
+                                                                                                             _capacity, newCapacity ) ) );
+    else   reallocate( newCapacity );
+  }
+
+
+
+
+  // shrink_to_fit()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr void   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::shrink_to_fit()
+  {
+    // A FIXED capacity vector's capacity is, well, fixed.  Nothing to do.  An EXTENDABLE vector gives back what it's not using.  An
+    // INLINE vector can't give back its built-in array, but moves back into it once the elements fit again.
+    if constexpr( POLICY != VectorPolicy::FIXED )
+    {
+      std::size_t const newCapacity = std::max( _size, INLINE_CAPACITY );
+      if( _capacity > newCapacity )   reallocate( newCapacity );
+    }
+  }
+
+
+
+
+
+  // flush()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  void   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::flush() requires( POLICY == VectorPolicy::MAPPED )
+  {
+    // The elements' pages reach the file on their own sooner or later.  The size, however, is written to the header only when
+    // asked (or when the vector goes away), otherwise every push_back() would have to touch the header too.
+    recordSize();
+    _mapping.flush();
+  }
+
+
+
+
+  // sync()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  void   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::sync() requires( POLICY == VectorPolicy::MAPPED )
+  {
+    recordSize();
+    _mapping.sync();
+  }
+
+
+
+
+
+
+
+
+
+
 
 
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -383,51 +959,52 @@ namespace CSUF::CPSC131
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
   // begin()
-  template <typename T, VectorPolicy POLICY>
-  constexpr typename Vector<T, POLICY>::iterator Vector<T, POLICY>::begin() noexcept
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::iterator Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::begin() noexcept
   {
-    // access and return pointer-to-array-of-elements held by unique_ptr without changing ownership
-    return reinterpret_cast<T *>( _array.get() );                         // Cast pointer-to-uninitialized memory to a pointer-to-T
+    // The allocator already hands out pointer-to-T, no casting required.  (Until an element is constructed there, though, what it
+    // points to is just raw memory)
+    return _array;
  }
 
 
 
 
   // end()
-  template<typename T, VectorPolicy POLICY>
-  constexpr typename Vector<T, POLICY>::iterator Vector<T, POLICY>::end() noexcept
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::iterator Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::end() noexcept
   { return begin() + size(); }                                            // Note the pointer arithmetic used
 
 
 
 
   // begin() const
-  template<typename T, VectorPolicy POLICY>
-  constexpr typename Vector<T, POLICY>::const_iterator Vector<T, POLICY>::begin() const noexcept
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::const_iterator Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::begin() const noexcept
   { return const_cast<Vector *>( this )->begin(); }                       // To ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
                                                                           // Can't just return begin(), that'd be an infinite loop
 
 
 
   // end() const
-  template<typename T, VectorPolicy POLICY>
-  constexpr typename Vector<T, POLICY>::const_iterator Vector<T, POLICY>::end() const noexcept
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::const_iterator Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::end() const noexcept
   { return const_cast<Vector *>( this )->end(); }                         // To ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
                                                                           // Can't just return end(), that'd be an infinite loop
 
 
 
   // cbegin() const
-  template<typename T, VectorPolicy POLICY>
-  constexpr typename Vector<T, POLICY>::const_iterator Vector<T, POLICY>::cbegin() const noexcept
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::const_iterator Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::cbegin() const noexcept
   { return begin(); }                                                     // To ensure consistent behavior and to implement the logic in one place, delegate to begin()
 
 
 
 
   // cend() const
-  template<typename T, VectorPolicy POLICY>
-  constexpr typename Vector<T, POLICY>::const_iterator Vector<T, POLICY>::cend() const noexcept
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::const_iterator Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::cend() const noexcept
   { return end(); }                                                       // To ensure consistent behavior and to implement the logic in one place, delegate to end()
 
 
@@ -447,16 +1024,16 @@ namespace CSUF::CPSC131
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
   // at() const
-  template<typename T, VectorPolicy POLICY>
-  const T &   Vector<T, POLICY>::at( std::size_t index ) const
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr const T &   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::at( std::size_t index ) const
   { return const_cast<Vector *>( this )->at( index ); }                   // To ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
 
 
 
 
   // at()
-  template <typename T, VectorPolicy POLICY>
-  T &   Vector<T, POLICY>::at( std::size_t index )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr T &   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::at( std::size_t index )
   {
     if( index >= _size )   throw std::out_of_range( exceptionString( std::format( "index ({}) over indexes vector's size ({})", index, _size ) ) );
 
@@ -469,48 +1046,48 @@ namespace CSUF::CPSC131
 
 
   // operator[] const
-  template<typename T, VectorPolicy POLICY>
-  const T &   Vector<T, POLICY>::operator[]( std::size_t index ) const
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr const T &   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::operator[]( std::size_t index ) const
   { return const_cast<Vector &>( *this )[ index ]; }                      // To ensure consistent behavior and to implement the logic in one place, delegate to non-cost version
 
 
 
 
   // operator[]
-  template<typename T, VectorPolicy POLICY>
-  T &   Vector<T, POLICY>::operator[]( std::size_t index )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr T &   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::operator[]( std::size_t index )
   { return begin()[ index ]; }                                            // Note: array bounds intentionally not checked
 
 
 
 
   // front() const
-  template<typename T, VectorPolicy POLICY>
-  T const &   Vector<T, POLICY>::front() const
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr T const &   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::front() const
   { return at( 0 ); }
 
 
 
 
   // front()
-  template<typename T, VectorPolicy POLICY>
-  T & Vector<T, POLICY>::front()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr T & Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::front()
   { return at( 0 ); }
 
 
 
 
   // back() const
-  template<typename T, VectorPolicy POLICY>
-  T const &   Vector<T, POLICY>::back() const
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr T const &   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::back() const
   { return at( size()-1 ); }
 
 
 
 
   // back()
-  template<typename T, VectorPolicy POLICY>
-  T & Vector<T, POLICY>::back()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr T & Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::back()
   { return at( size()-1 ); }
 
 
@@ -525,51 +1102,152 @@ namespace CSUF::CPSC131
 
 
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-  // Modifiers
+  // Searches
   //
+  // Element types the SIMD kernels understand (integers, floating point, and std::byte) are examined a whole register's worth at
+  // a time, everything else one element at a time by the standard algorithms.  The choice is made at compile time, so a vector
+  // of Students pays nothing for the option.  During constant evaluation the standard algorithms are always used.
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-  // push_back()
-  template<typename T, VectorPolicy POLICY>
-  void    Vector<T, POLICY>::push_back( T const & value )
-  { insert( end(), value ); }                                             // Delegate to insert() leveraging error checking - insert before the end
+  // find() const
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::const_iterator   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::find( T const & value ) const
+  {
+    if constexpr( simd::Vectorizable<T> )
+    {
+      if !consteval { return simd::find( begin(), end(), value ); }       // The SIMD kernels are for run time only
+    }
+    return std::find( begin(), end(), value );
+  }
 
 
 
 
-  // pop_back()
-  template<typename T, VectorPolicy POLICY>
-  void Vector<T, POLICY>::pop_back()
-  { erase( end()-1 ); }                                                   // Delegate to erase() leveraging error checking - erase the last element, which is one before the end, or begin() + (size-1)
+  // find()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::iterator   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::find( T const & value )
+  { return const_cast<iterator>( std::as_const( *this ).find( value ) ); }  // To implement the logic in one place, delegate to the const version
 
 
 
 
-  // erase( iterator )
-  template<typename T, VectorPolicy POLICY>
-  typename Vector<T, POLICY>::iterator    Vector<T, POLICY>::erase( iterator position )
+  // count() const
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr std::size_t   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::count( T const & value ) const
   {
-    // Summary:
-    // 1      Take the element at "position" out of the Vector by shifting everything to the left
-    // 2      Destroy the leftover element at the end, if necessary
-    // 3      decrement the vector's size
+    if constexpr( simd::Vectorizable<T> )
+    {
+      if !consteval { return simd::count( begin(), end(), value ); }
+    }
+    return static_cast<std::size_t>( std::count( begin(), end(), value ) );
+  }
 
 
-    if( position >= end() || position < begin() )   throw std::out_of_range( exceptionString( "Position outside of bounds of the vector" ) );
 
-    // Removes element at "position". Elements from higher positions are shifted back to fill gap. Vector size is decremented.
-    //
-    // Remove and close the resulting gap by left shifting elements and decrement the number of elements in the container, for
-    // example, remove element 2 (e2):
-    //
-    //         begin()  position                     size / end()
-    //             v       v                           v
-    //           +------+------+------+------+------+------+
-    //  BEFORE   |  e1  |  e2  |  e3  |  e4  | e5   |      |   capacity=6
-    //           +------+------+------+------+------+------+   .
-    //              |             /      /      /              .
-    //              |         (step 1)  /      /               .
-    //              |           /   (step 2)  /                .
+
+  // contains() const
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr bool   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::contains( T const & value ) const
+  { return find( value ) != end(); }
+
+
+
+
+  // min_element() const
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::const_iterator   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::min_element() const
+  {
+    if constexpr( simd::Vectorizable<T> )
+    {
+      if !consteval { return simd::min_element( begin(), end() ); }
+    }
+    return std::min_element( begin(), end() );
+  }
+
+
+
+
+  // max_element() const
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::const_iterator   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::max_element() const
+  {
+    if constexpr( simd::Vectorizable<T> )
+    {
+      if !consteval { return simd::max_element( begin(), end() ); }
+    }
+    return std::max_element( begin(), end() );
+  }
+
+
+
+
+
+
+
+
+
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Modifiers
+  //
+  ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+  // push_back( T const & )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr void    Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::push_back( T const & value )
+  { insert( end(), value ); }                                             // Delegate to insert() leveraging error checking - insert before the end
+
+
+
+
+  // push_back( T && )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr void    Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::push_back( T && value )
+  { insert( end(), std::move( value ) ); }                                // Delegate to insert() leveraging error checking - insert before the end
+
+
+
+
+  // emplace_back()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>   template<typename... Args>
+  constexpr T &    Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::emplace_back( Args &&... args )
+  { return *emplace( end(), std::forward<Args>( args )... ); }            // Delegate to emplace() leveraging error checking - construct before the end
+
+
+
+
+  // pop_back()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr void Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::pop_back()
+  { erase( end()-1 ); }                                                   // Delegate to erase() leveraging error checking - erase the last element, which is one before the end, or begin() + (size-1)
+
+
+
+
+  // erase( iterator )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::iterator    Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::erase( iterator position )
+  {
+    // Summary:
+    // 1      Take the element at "position" out of the Vector by shifting everything to the left
+    // 2      Destroy the leftover element at the end, if necessary
+    // 3      decrement the vector's size
+
+
+    if( position >= end() || position < begin() )   throw std::out_of_range( exceptionString( "Position outside of bounds of the vector" ) );
+
+    // Removes element at "position". Elements from higher positions are shifted back to fill gap. Vector size is decremented.
+    //
+    // Remove and close the resulting gap by left shifting elements and decrement the number of elements in the container, for
+    // example, remove element 2 (e2):
+    //
+    //         begin()  position                     size / end()
+    //             v       v                           v
+    //           +------+------+------+------+------+------+
+    //  BEFORE   |  e1  |  e2  |  e3  |  e4  | e5   |      |   capacity=6
+    //           +------+------+------+------+------+------+   .
+    //              |             /      /      /              .
+    //              |         (step 1)  /      /               .
+    //              |           /   (step 2)  /                .
     //              |          /      /   (step 3)             .
     //              |         /      /      /                  .
     //              v        v      v      v                   .
@@ -579,12 +1257,22 @@ namespace CSUF::CPSC131
     //               ^      ^                    ^
     //           begin()  position             size / end()
 
+    // Trivially relocatable elements take a short cut:  destroy the one going away, then slide the bytes of everything after it
+    // one slot to the left in a single memmove.  Nothing is move assigned, and no leftover element at the end needs destroying.
+    if constexpr( is_trivially_relocatable<T> )
+    {
+      std::destroy_at( position );
+      relocate( position + 1, end(), position );
+      --_size;
+      return position;
+    }
+
     // Pick one!  Several coding options to left shift elements are shown here, but only one is used at a time.  These options
     // provide alternatives for students to see and use in their own code.  Students should pick just one of these options, and
     // of course do not include the "if constexpr (...)" statement
 
     // Option 1:  Write your own loop using indexes
-    if constexpr( false )
+    else if constexpr( false )
     {
       const auto        array        = begin();
       const std::size_t erasurePoint = position - begin();    // Convert iterator to index.  Another valid technique:  auto erasurePoint = std::distance( begin(), position )
@@ -628,24 +1316,114 @@ namespace CSUF::CPSC131
 
 
   // erase( const_iterator )
-  template<typename T, VectorPolicy POLICY>
-  typename Vector<T, POLICY>::iterator    Vector<T, POLICY>::erase( const_iterator position )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::iterator    Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::erase( const_iterator position )
   { return erase( const_cast<iterator>(position) ); }                     // To ensure consistent behavior and to implement the logic in one place, delegate to the non-const iterator version
 
 
 
 
-  // insert( iterator )
-  template <typename T, VectorPolicy POLICY>
-  typename Vector<T, POLICY>::iterator    Vector<T, POLICY>::insert( iterator position,  T const & value )
+  // erase( const_iterator, const_iterator )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::iterator    Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::erase( const_iterator first,  const_iterator last )
+  {
+    // Summary:
+    // 1      Take the elements in [first, last) out of the Vector by shifting everything after them to the left, all at once
+    // 2      Destroy the leftover elements at the end, if necessary
+    // 3      decrease the vector's size by the number of elements removed
+    //
+    // Erasing the same elements one at a time shifts the tail once per element, O(n) each time.  Shifting it once by the whole
+    // distance costs the same as erasing just one of them.  For example, remove elements 2 through 3 (e2 and e3):
+    //
+    //         begin()  first        last                size / end()
+    //             v       v           v                   v
+    //           +------+------+------+------+------+------+
+    //  BEFORE   |  e1  |  e2  |  e3  |  e4  | e5   |      |   capacity=6
+    //           +------+------+------+------+------+------+
+    //              |             ______/      /
+    //              |      ______/      ______/
+    //              v     v            v
+    //           +------+------+------+------+------+------+
+    //  AFTER    |  e1  |  e4  |  e5  |      |      |      |   capacity=6
+    //           +------+------+------+------+------+------+
+    //               ^      ^           ^
+    //           begin()  first       size / end()
+
+    if( first < begin() || first > last || last > end() )   throw std::out_of_range( exceptionString( "Range outside of bounds of the vector" ) );
+
+    auto const position = begin() + (first - begin());                    // Convert to a modifiable iterator without casting away const
+    auto const count    = static_cast<std::size_t>( last - first );
+    if( count == 0 )   return position;
+
+    // Trivially relocatable elements take the same short cut erase( iterator ) does:  destroy the ones going away, then slide the
+    // bytes of the tail left in a single memmove.
+    if constexpr( is_trivially_relocatable<T> )
+    {
+      std::destroy( position, position + count );
+      relocate( position + count, end(), position );
+    }
+
+    // Everything else is moved left the whole distance in one pass, leaving count moved-from objects at the end to be destroyed
+    else
+    {
+      auto const newEnd = std::move( position + count, end(), position ); // Move everything from "last" up to but not including "end()" to a new place starting at "first"
+      std::destroy( newEnd, end() );                                      // Destroy the objects which are no longer part of the vector
+    }
+
+    _size -= count;                                                       // Changing _size also changes end()
+    return position;
+  }
+
+
+
+
+  // insert( iterator, T const & )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::iterator    Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::insert( iterator position,  T const & value )
+  { return emplace( position, value ); }                                  // A copy is just one more way to construct the new element in place, so delegate to emplace()
+
+
+
+
+  // insert( const_iterator, T const & )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::iterator    Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::insert( const_iterator position,  T const & value )
+  { return insert( const_cast<iterator>(position), value ); }             // To ensure consistent behavior and to implement the logic in one place, delegate to the non-const iterator version
+
+
+
+
+  // insert( iterator, T && )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::iterator    Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::insert( iterator position,  T && value )
+  { return emplace( position, std::move( value ) ); }                     // Steal the value's resources (e.g., a Student's name) instead of making a deep copy
+
+
+
+
+  // insert( const_iterator, T && )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::iterator    Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::insert( const_iterator position,  T && value )
+  { return insert( const_cast<iterator>(position), std::move( value ) ); }// To ensure consistent behavior and to implement the logic in one place, delegate to the non-const iterator version
+
+
+
+
+  // emplace()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>   template<typename... Args>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::iterator    Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::emplace( const_iterator beforePosition,  Args &&... args )
   {
     // Summary:
     // 1      If there is insufficient capacity for an additional element
     // 1.1      If capacity is FIXED, then throw an exception.
     // 1.2      Otherwise get more capacity
     // 2      Make room (that is, open a gap) for the new element by shifting everything to the right
-    // 3      Fill the gap with a copy of the element and increment the vector's size
+    // 3      Construct the new element from "args" in the gap and increment the vector's size
+    //
+    // Unlike insert( position, value ) of days gone by, the new element is built from the arguments right where it will live.  When
+    // the caller hands us a temporary (or the arguments of one of T's constructors) no extra copy is ever made.
 
+    iterator position = const_cast<iterator>( beforePosition );           // We're going to modify the vector through this position
 
     if( position > end() || position < begin() )   throw std::out_of_range( exceptionString( "Position outside of bounds of the vector" ) );
 
@@ -664,9 +1442,15 @@ namespace CSUF::CPSC131
         // all iterators (pointers) that may point to an element inside the array.  To account for this, the "position" is converted
         // to an index before reserving more capacity, and then restored afterwards by converting the index to an iterator
         // (pointer).
+        //
+        // The same is true for the arguments.  They may very well refer to an element of this vector (e.g., v.push_back( v[0] )),
+        // so construct the new element before the old array goes away.  Once there is room, moving it into place is cheap.
+        T value( std::forward<Args>( args )... );
         std::size_t index = position - begin();                           // Convert iterator to index
-        reserve( _capacity == 0 ? 8 : 2 * _capacity );                    // Double non-zero capacity
+        reserve( nextCapacity( _size + 1 ) );                             // Grow as directed by the GROWTH policy
         position = begin() + index;                                       // Convert index to iterator
+
+        return emplace( position, std::move( value ) );                   // There is now sufficient capacity, so this call never comes back here
       }
     }
 
@@ -693,12 +1477,36 @@ namespace CSUF::CPSC131
     //           begin()  position                   size / end()
 
     if( position == end() )
-    {                                                                     // Nothing to move, so just place the value at the end. Because
-      std::construct_at( end(),   value );                                // _array[_size] (i.e. *end()) contains uninitialized memory, the object
-    }                                                                     // placed there must be constructed.
+    {                                                                     // Nothing to move, so just construct the value at the end. Because
+      std::construct_at( end(),   std::forward<Args>( args )... );        // _array[_size] (i.e. *end()) contains uninitialized memory, the object
+    }                                                                     // placed there must be constructed - and constructed right there, in place.
+
+    else if constexpr( is_trivially_relocatable<T> )
+    {
+      // Build the new element off to the side (arguments may refer to an element about to be shifted), slide the bytes of the
+      // tail one slot to the right in a single memmove, then relocate the new element's bytes into the gap.  No element is move
+      // constructed, move assigned, or destroyed along the way, and nothing after the construction can throw.
+      if consteval
+      {
+        T value( std::forward<Args>( args )... );                         // Raw bytes can't pose as a T during constant evaluation, so the
+        relocateBackward( position, end(), end() + 1 );                   // new element is an ordinary local there, moved into the gap
+        std::construct_at( position, std::move( value ) );
+      }
+      else
+      {
+        RawMemory newElement;
+        T * value = std::construct_at( reinterpret_cast<T *>( &newElement ), std::forward<Args>( args )... );
+
+        std::memmove( static_cast<void *>( position + 1 ), static_cast<void const *>( position ), (end() - position) * sizeof( T ) );
+        std::memcpy ( static_cast<void *>( position     ), static_cast<void const *>( value    ), sizeof( T )                      );
+      }
+    }
 
     else
     {
+      T value( std::forward<Args>( args )... );                           // Arguments may refer to an element about to be shifted, so build the
+                                                                          // new element first
+
       std::construct_at( end(),   std::move( *(end()-1) ) );              // Move the last element over 1 slot.  Because _array[_size] (i.e. *end())
                                                                           // contains uninitialized memory, the object placed there must be
                                                                           // constructed.
@@ -746,7 +1554,7 @@ namespace CSUF::CPSC131
 
 
       // All options then need to actually insert the element and adjust the size
-      *position = value;                                                  // Fill the empty slot with a copy of "value"
+      *position = std::move( value );                                     // Fill the empty slot by moving the new element into it
     }
 
     // Don't forget to adjust the vector's size
@@ -759,17 +1567,202 @@ namespace CSUF::CPSC131
 
 
 
-  // insert( const_iterator )
-  template<typename T, VectorPolicy POLICY>
-  typename Vector<T, POLICY>::iterator    Vector<T, POLICY>::insert( const_iterator position,  T const & value )
-  { return insert( const_cast<iterator>(position), value ); }             // To ensure consistent behavior and to implement the logic in one place, delegate to the non-const iterator version
+  // insert( const_iterator, first, last )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>   template<std::input_iterator InputIterator>
+  constexpr typename Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::iterator    Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::insert( const_iterator beforePosition,  InputIterator first,  InputIterator last )
+  {
+    // Inserting k elements one at a time shifts the tail k times, and may reallocate several times along the way.  Inserting them
+    // as a group grows the capacity at most once and shifts the tail exactly once, turning O(n * k) into O(n + k).
+
+    iterator position = const_cast<iterator>( beforePosition );           // We're going to modify the vector through this position
+
+    if( position > end() || position < begin() )   throw std::out_of_range( exceptionString( "Position outside of bounds of the vector" ) );
+
+    std::size_t const index = position - begin();                         // Convert iterator to index, capacity may change below
+
+
+    // Single pass input ranges (e.g., reading from a stream) can't tell us how many elements are coming until we've consumed them.
+    // Append each to the back (amortized constant time), then rotate the whole group into place in one linear pass.
+    if constexpr( !std::forward_iterator<InputIterator> )
+    {
+      std::size_t const oldSize = _size;
+      try
+      {
+        for( ; first != last; ++first )    emplace_back( *first );
+      }
+      catch( ... )                                                        // e.g., a FIXED vector runs out of room part way through
+      {
+        std::destroy( begin() + oldSize, end() );                         // Take back what was appended, the rest is untouched
+        _size = oldSize;
+        throw;
+      }
+      std::rotate( begin() + index, begin() + oldSize, end() );
+      return begin() + index;
+    }
+
+    else
+    {
+      std::size_t const count = static_cast<std::size_t>( std::distance( first, last ) );
+      if( count == 0 )   return position;
+
+      if( _size + count > _capacity )
+      {
+        if constexpr( POLICY == VectorPolicy::FIXED )   throw std::overflow_error( exceptionString( std::format( "Insufficient capacity to add {} more elements\n"
+                                                                                                                 "   Size:      {}\n"
+                                                                                                                 "   Capacity:  {}",
+                                                                                                                 count, _size, _capacity ) ) );
+        else
+        {
+          reserve( nextCapacity( _size + count ) );                       // One reallocation, no matter how many elements are coming
+          position = begin() + index;                                     // Convert index to iterator
+        }
+      }
+
+
+      // Open a gap "count" elements wide, for example, insert 2 values before element 3 (e3).  Some of the tail lands in raw memory
+      // beyond end() and must be constructed, the rest lands on existing (moved from) elements and is assigned.
+      //
+      //          begin()  position             size / end()
+      //              v      v                    v
+      //           +------+------+------+------+------+------+------+
+      //  BEFORE   |  e1  |  e3  |  e4  |  e5  |      |      |      |  capacity=7
+      //           +------+------+------+------+------+------+------+
+      //              |      |      |      |
+      //              |      |      |      +-------------+
+      //              |      |      +-------------+      |
+      //              |      +-------------+      |      |
+      //              v                    v      v      v
+      //           +------+------+------+------+------+------+------+
+      //  AFTER    |  e1  |  v1  |  v2  |  e3  |  e4  |  e5  |      |  capacity=7
+      //           +------+------+------+------+------+------+------+
+      //              ^      ^                                  ^
+      //           begin()  position                      size / end()
+
+      std::size_t const tail = end() - position;                          // Number of elements that must shift to the right
+
+      if constexpr( is_trivially_relocatable<T> )                         // Relocate the whole tail at once leaving raw memory behind
+      {
+        relocateBackward( position, end(), end() + count );
+        try
+        {
+          uninitializedCopy( first, last, position );                     // Then construct the new values in the gap
+        }
+        catch( ... )
+        {
+          relocate( position + count, end() + count, position );          // Close the gap again
+          throw;
+        }
+      }
+      else
+      {
+        // Elements constructed beyond end() aren't counted by _size until the very end.  Should a move, copy, or assignment throw
+        // before then, they must be destroyed here or no one ever will.  The elements before end() are all still valid objects,
+        // if perhaps moved from, so the vector is left usable (the basic guarantee).
+        std::size_t constructed = 0;                                      // Number of elements constructed beyond end() so far
+        try
+        {
+          if( tail > count )                                              // The gap lies entirely within the existing elements
+          {
+            uninitializedMove      ( end() - count, end(),         end() );   // The last "count" elements move into raw memory, so construct them
+            constructed = count;
+            std::move_backward     ( position,      end() - count, end() );   // The rest move onto moved from objects, so assign them
+            std::copy              ( first,         last,          position );// Then overwrite the gap with the new values
+          }
+          else                                                            // The gap reaches into raw memory
+          {
+            auto middle = std::next( first, tail );
+            uninitializedCopy      ( middle,   last,  end()                  );  // New values landing beyond end() must be constructed
+            constructed = count - tail;
+            uninitializedMove      ( position, end(), end() + (count - tail) );  // The entire tail moves into raw memory too
+            constructed = count;
+            std::copy              ( first,    middle, position              );  // New values landing on the (moved from) tail are assigned
+          }
+        }
+        catch( ... )
+        {
+          std::destroy( end(), end() + constructed );
+          throw;
+        }
+      }
+
+      _size += count;                                                     // Changing _size also changes end()
+      return position;
+    }
+  }
+
+
+
+
+  // resize( size )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr void    Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::resize( std::size_t newSize )
+  {
+    if( newSize <= _size )
+    {
+      std::destroy( begin() + newSize, end() );                           // Shrinking destroys the elements beyond the new size but keeps the capacity
+      _size = newSize;
+      return;
+    }
+
+    if( newSize > _capacity )   reserve( POLICY == VectorPolicy::FIXED ? newSize : nextCapacity( newSize ) );  // FIXED vectors throw
+    uninitializedValueConstruct( end(), begin() + newSize );              // Default construct the new elements in raw memory
+    _size = newSize;                                                      // Changing _size also changes end()
+  }
+
+
+
+
+  // resize( size, value )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr void    Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::resize( std::size_t newSize,  T const & value )
+  {
+    if( newSize <= _size )
+    {
+      std::destroy( begin() + newSize, end() );                           // Shrinking destroys the elements beyond the new size but keeps the capacity
+      _size = newSize;
+      return;
+    }
+
+    if( newSize > _capacity )
+    {
+      T copy( value );                                                    // value may refer to one of our elements, which is about to be relocated
+      reserve( POLICY == VectorPolicy::FIXED ? newSize : nextCapacity( newSize ) );  // FIXED vectors throw
+      uninitializedFill( end(), begin() + newSize, copy );
+    }
+    else   uninitializedFill( end(), begin() + newSize, value );          // Copy construct the new elements in raw memory
+    _size = newSize;                                                      // Changing _size also changes end()
+  }
+
+
+
+
+  // resize( size, value, execution )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  void    Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::resize( std::size_t newSize,  T const & value,  parallel::Execution const & execution )
+  {
+    if( newSize <= _size )   { resize( newSize, value );  return; }       // Shrinking only destroys elements, nothing to share
+
+    auto const fill = [&, count = newSize - _size]( T const & from )
+    {
+      constructConcurrently( count, execution, [&from]( T * destination,  std::size_t first,  std::size_t last )
+      { std::uninitialized_fill( destination, destination + (last - first), from ); } );
+    };
+
+    if( newSize > _capacity )
+    {
+      T copy( value );                                                    // value may refer to one of our elements, which is about to be relocated
+      reserve( POLICY == VectorPolicy::FIXED ? newSize : nextCapacity( newSize ) );  // FIXED vectors throw
+      fill( copy );
+    }
+    else   fill( value );
+  }
 
 
 
 
   // clear()
-  template<typename T, VectorPolicy POLICY>
-  void    Vector<T, POLICY>::clear() noexcept
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr void    Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::clear() noexcept
   {
     std::destroy( begin(), end() );
     //for( auto && current : *this ) current.~T();
@@ -789,48 +1782,199 @@ namespace CSUF::CPSC131
   //
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-  // reserve()
-  template<typename T, VectorPolicy POLICY>
-  void   Vector<T, POLICY>::reserve( std::size_t newCapacity )
-  {
-    if( newCapacity > _capacity )
-    {
-      // More capacity requested.  Get a bigger array, move the stuff from the smaller to bigger array, and then adopt the bigger
-      // array and capacity.  For example:
-      //          begin()               size=3/end()
-      //              v                    v
-      //           +------+------+------+
-      //  BEFORE   |  e1  |  e2  |  e3  |                       capacity=3
-      //           +------+------+------+
-      //              |      |      |
-      //              |      |      |
-      //              v      v      v
-      //           +------+------+------+------+------+------+
-      //  AFTER    |  e1  |  e2  |  e3  |      |      |      |  capacity=6
-      //           +------+------+------+------+------+------+
-      //              ^                    ^
-      //           begin()              size=3/end()
-      //
-      auto newArray = std::make_unique<RawMemory[]>( newCapacity );       // get a bigger array
+  // constructConcurrently()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>   template<typename Construct>
+  void   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::constructConcurrently( std::size_t count,  parallel::Execution const & execution,  Construct construct )
+  {
+    // The raw memory after end() is split into contiguous chunks, one per thread, and each thread constructs its chunk's elements:
+    //
+    //         begin()      end()                                       end() + count
+    //             v          v                                              v
+    //           +----+----+----+----+----+----+----+----+----+----+----+----+
+    //           | e1 | e2 |  thread 0      |  thread 1      |  thread 2      |
+    //           +----+----+----+----+----+----+----+----+----+----+----+----+
+    //
+    // If any thread fails, the standard uninitialized algorithms have already destroyed what that thread built, but the chunks
+    // other threads finished are ours to destroy.  _size doesn't change until every chunk is done, so until then the vector
+    // doesn't know those elements exist.
+    auto const base = end();
+    std::vector<parallel::Chunk> finished( execution.chunks( count ) );   // Empty chunks (first == last) for those not finished
+
+    try
+    {
+      parallel::for_each_chunk( count, execution, [&]( parallel::Chunk chunk )
+      {
+        construct( base + chunk.first, chunk.first, chunk.last );
+        finished[chunk.index] = chunk;                                    // Each thread writes only its own slot
+      } );
+    }
+    catch( ... )
+    {
+      for( auto const & chunk : finished )   std::destroy( base + chunk.first, base + chunk.last );
+      throw;
+    }
 
-      // Move values from smaller array into the bigger new array
-      std::uninitialized_move( begin(), end(), reinterpret_cast<T *>( newArray.get() ) );
+    _size += count;                                                       // Changing _size also changes end()
+  }
+
+
+
+
+
+  // nextCapacity()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr std::size_t   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::nextCapacity( std::size_t requiredCapacity ) const
+  {
+    // The GROWTH policy decides how aggressively to grow, but whatever it says, the vector must end up with room for what's
+    // needed right now.  Otherwise a policy returning too little would have us reallocating forever.
+    return std::max<std::size_t>( requiredCapacity, GROWTH{}( _capacity, requiredCapacity ) );
+  }
+
+
+
+
+  // reallocate()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr void   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::reallocate( std::size_t newCapacity )
+  {
+    // Get a differently sized array (bigger when reserving, smaller when shrinking to fit), move the stuff from the old to new
+    // array, and then adopt the new array and capacity.  For example:
+    //          begin()               size=3/end()
+    //              v                    v
+    //           +------+------+------+
+    //  BEFORE   |  e1  |  e2  |  e3  |                       capacity=3
+    //           +------+------+------+
+    //              |      |      |
+    //              |      |      |
+    //              v      v      v
+    //           +------+------+------+------+------+------+
+    //  AFTER    |  e1  |  e2  |  e3  |      |      |      |  capacity=6
+    //           +------+------+------+------+------+------+
+    //              ^                    ^
+    //           begin()              size=3/end()
+    //
+    if constexpr( POLICY == VectorPolicy::MAPPED )
+    {
+      // Trivially copyable elements are just bytes, so resizing the mapping carries them along.  A file backed mapping doesn't
+      // even copy those, the file simply gets longer (or shorter) and is mapped again.
+      if( _mapping.data() == nullptr )   _array = allocate( newCapacity );  // Nothing mapped yet, so no elements either (MAPPED vectors have no built-in array)
+      else
+      {
+        _mapping.resize( sizeof( MappedHeader ) + newCapacity * sizeof( T ) );
+        _array = mappedArray();
+      }
+      _capacity = newCapacity;
+      return;
+    }
+
+    T * newArray = allocate( newCapacity );                               // get a new array
+
+    if constexpr( is_trivially_relocatable<T> )
+    {
+      // Relocate all the values with one block copy.  The originals are simply forgotten, there's nothing left to destroy.
+      // (std::realloc could sometimes even skip the copy by growing in place, but only for memory std::malloc handed out.)
+      relocate( begin(), end(), newArray );
+    }
+    else
+    {
+      // Move values from the old array into the new array.  Should that throw, the new array must not be leaked.
+      try
+      {
+        uninitializedMove( begin(), end(), newArray );
+      }
+      catch( ... )
+      {
+        AllocatorTraits::deallocate( _allocator, newArray, newCapacity );
+        throw;
+      }
 
       // Destroy the remnants of the old objects.
       std::destroy( begin(), end() );
-      //for( auto && current : *this ) current.~T();                      // Uses begin() and end() of original, smaller array
+      //for( auto && current : *this ) current.~T();                      // Uses begin() and end() of original array
+    }
 
-      // Release the smaller array and adopt the new bigger array.  Smart pointer assignment releases the smaller array's
-      // dynamically allocated memory.  Once "_array" is set to the "newArray", begin() and end() will return iterators to the new,
-      // bigger array.
-      _array    = std::move( newArray );
-      _capacity = newCapacity;
+    // Release the old array and adopt the new array.  Once "_array" is set to the "newArray", begin() and end() will return
+    // iterators to the new array.
+    deallocate();
+    _array    = newArray;
+    _capacity = newCapacity;
+  }
+
+
+
+
+  // allocate()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr T *   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::allocate( std::size_t capacity )
+  {
+    if( capacity <= INLINE_CAPACITY )   return inlineArray();             // Don't bother the allocator for nothing, or for what fits in the built-in array
+
+    if constexpr( POLICY == VectorPolicy::MAPPED )
+    {
+      _mapping = MappedFile( sizeof( MappedHeader ) + capacity * sizeof( T ) );   // Anonymous - only the file constructor attaches a file
+      ::new( static_cast<void *>( _mapping.data() ) ) MappedHeader{};
+      return mappedArray();
     }
+    return AllocatorTraits::allocate( _allocator, capacity );             // Uninitialized memory for capacity objects, no zero filling
   }
 
 
 
 
+  // deallocate()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr void   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::deallocate() noexcept
+  {
+    // The allocator must be told the same size it was asked for, so this must be called before _capacity changes
+    if constexpr( POLICY == VectorPolicy::MAPPED )   _mapping = MappedFile{};   // Unmap, a file keeps what's been written to it
+    else if( _array != nullptr  &&  !isInline() )   AllocatorTraits::deallocate( _allocator, _array, _capacity );
+  }
+
+
+
+
+  // inlineArray()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr T *   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::inlineArray() noexcept
+  {
+    if constexpr( POLICY == VectorPolicy::INLINE )   return reinterpret_cast<T *>( _inline.data() );
+    else                                             return nullptr;
+  }
+
+
+
+
+  // isInline()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr bool   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::isInline() const noexcept
+  {
+    if constexpr( POLICY == VectorPolicy::INLINE )   return _array == const_cast<Vector *>( this )->inlineArray();
+    else                                             return false;
+  }
+
+
+
+
+  // mappedArray()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr T *   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::mappedArray() noexcept
+  {
+    if constexpr( POLICY == VectorPolicy::MAPPED )   return _mapping.data() == nullptr  ?  nullptr  :  reinterpret_cast<T *>( _mapping.data() + sizeof( MappedHeader ) );
+    else                                             return nullptr;
+  }
+
+
+
+
+  // recordSize()
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr void   Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::recordSize() noexcept
+  {
+    if constexpr( POLICY == VectorPolicy::MAPPED )
+    {
+      if( _mapping.data() != nullptr )   reinterpret_cast<MappedHeader *>( _mapping.data() )->size = _size;
+    }
+  }
 
 
 
@@ -846,13 +1990,29 @@ namespace CSUF::CPSC131
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
   // operator<=>
-  template<typename T, VectorPolicy POLICY>
-  std::weak_ordering Vector<T, POLICY>::operator<=>( Vector const & rhs ) const
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr std::weak_ordering Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::operator<=>( Vector const & rhs ) const
   {
     // Find the first element that's different and you have your answer.  If the Vectors are different sizes but all the leading
     // elements match, then the Vector with the smallest size is less than the other
     auto const extent = std::min( _size, rhs._size );
 
+    // Vectorizable elements let the SIMD kernels skip over the equal ones a register's worth at a time.  An element that isn't
+    // equal usually decides the answer, but not always:  a NaN isn't equal to anything, not even itself, yet orders equivalent to
+    // another NaN.  So keep looking past those.  (The kernels aren't available during constant evaluation.)
+    if constexpr( simd::Vectorizable<T> )
+    {
+      if !consteval
+      {
+        for( std::size_t i = 0;  (i += simd::mismatch( begin() + i, rhs.begin() + i, extent - i )) < extent;  ++i )
+        {
+          auto result = std::compare_weak_order_fallback( _array[i], rhs._array[i] );
+          if( result != 0 ) return result;
+        }
+        return  _size <=> rhs._size;
+      }
+    }
+
     for (auto p = begin(), end = p + extent, q = rhs.begin();   p != end;   ++p, ++q)
     {
       auto result = std::compare_weak_order_fallback( *p, *q );                // Uses operator== and operator< if operator<=> is unavailable
@@ -866,11 +2026,16 @@ namespace CSUF::CPSC131
 
 
   // operator==
-  template<typename T, VectorPolicy POLICY>
-  bool Vector<T, POLICY>::operator==( Vector const & rhs ) const
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr bool Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY>::operator==( Vector const & rhs ) const
   {
     if( _size != rhs._size )   return false;
 
+    if constexpr( simd::Vectorizable<T> )
+    {
+      if !consteval { return simd::mismatch( begin(), rhs.begin(), _size ) == _size; }
+    }
+
     for( auto p = begin(), end = this->end(), q = rhs.begin();  p != end;  ++p, ++q )
     {
       if( *p != *q ) return false;
@@ -893,9 +2058,21 @@ namespace CSUF::CPSC131
   ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
   // swap()
-  template<typename T, VectorPolicy POLICY>
-  void swap( Vector<T, POLICY> & lhs, Vector<T, POLICY> & rhs ) noexcept
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY>
+  constexpr void swap( Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY> & lhs, Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY> & rhs ) noexcept( POLICY != VectorPolicy::INLINE )
   {
+    // Elements living in an array built into a vector can't trade places by exchanging pointers, they have to actually move
+    if constexpr( POLICY == VectorPolicy::INLINE )
+    {
+      if( lhs.isInline()  ||  rhs.isInline() )
+      {
+        auto temp = std::move( lhs );
+        lhs       = std::move( rhs );
+        rhs       = std::move( temp );
+        return;
+      }
+    }
+
     // Note that all std::swap() overload candidates are added to the overload resolution scope. This allows user defined versions
     // of swap() to be called instead of std::swap() for object types that define their own versions of swap.
     //    [[ Lippman Lajoie Moo, C++ Primer 5e, 2013, Section 13.3, Swap ]]
@@ -904,6 +2081,45 @@ namespace CSUF::CPSC131
     swap( lhs._size,     rhs._size );
     swap( lhs._capacity, rhs._capacity );
     swap( lhs._array,    rhs._array );
+    if constexpr( POLICY == VectorPolicy::MAPPED )   swap( lhs._mapping, rhs._mapping );
+
+    // Allocators are swapped only if they say so.  Otherwise they had better be equal (swapping vectors with unequal allocators is
+    // undefined behavior, just like it is for the standard containers), or the arrays would be released by the wrong allocator.
+    if constexpr( std::allocator_traits<ALLOCATOR>::propagate_on_container_swap::value )   swap( lhs._allocator, rhs._allocator );
+  }
+
+
+
+
+  // erase( vector, value )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY, typename U>
+  constexpr std::size_t erase( Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY> & vector,  U const & value )
+  { return erase_if( vector, [&value]( T const & element ) { return element == value; } ); }   // Delegate to erase_if() - erase what compares equal
+
+
+
+
+  // erase_if( vector, predicate )
+  template<typename T, VectorPolicy POLICY, VectorGrowthPolicy GROWTH, typename ALLOCATOR, std::size_t INLINE_CAPACITY, typename Predicate>
+  constexpr std::size_t erase_if( Vector<T, POLICY, GROWTH, ALLOCATOR, INLINE_CAPACITY> & vector,  Predicate predicate )
+  {
+    // Erasing each match as it's found shifts the tail once per match, quadratic when many elements go.  Instead, walk the vector
+    // once moving each element to keep down over the gaps left so far (std::remove_if), and then erase the leftover moved-from
+    // elements at the end all at once.  Each element is examined once and moved at most once - linear time.
+    //
+    //           +------+------+------+------+------+
+    //  BEFORE   |  e1  |  x2  |  e3  |  x4  |  e5  |          x = predicate returns true
+    //           +------+------+------+------+------+
+    //           +------+------+------+------+------+
+    //  COMPACT  |  e1  |  e3  |  e5  |  ?   |  ?   |          ? = moved-from, about to be erased
+    //           +------+------+------+------+------+
+    //                                ^             ^
+    //                              newEnd        end()
+    auto const newEnd = std::remove_if( vector.begin(), vector.end(), std::ref( predicate ) );
+    auto const count  = static_cast<std::size_t>( vector.end() - newEnd );
+
+    vector.erase( newEnd, vector.end() );
+    return count;
   }
 }    // namespace CSUF::CPSC131
 
@@ -1,6 +1,10 @@
 import std;
 import CSUF.CPSC131.Student;
 import CSUF.CPSC131.Vector;
+import CSUF.CPSC131.CountingResource;
+import CSUF.CPSC131.ParallelChunks;
+import CSUF.CPSC131.ConcurrentVector;
+import CSUF.CPSC131.SoAVector;
 
 
 namespace    // anonymous
@@ -46,14 +50,22 @@ namespace    // anonymous
 
 
 
+    // construct students in place, and insert a whole range of them at once
+    vector.emplace_back( "Edward", 4 );
+    Student transfers[] = { { "Frank" }, { "Gina", 6 } };
+    vector.insert( vector.begin() + 3, std::begin( transfers ), std::end( transfers ) );
+    std::print( std::cout, "\n {:n:}\n\n", vector );                                  // Should be:  "", "", "", Frank, Gina, Adam, Bob, Dolores, Edward
+
+
+
     // copy construction
     auto aCopy = vector;
-    std::print( std::cout, "\n {:n:}\n\n", aCopy );                                   // Should be:  "", "", "", Adam, Bob, Dolores
+    std::print( std::cout, "\n {:n:}\n\n", aCopy );                                   // Should be:  "", "", "", Frank, Gina, Adam, Bob, Dolores, Edward
 
 
 
     vector.clear();
-    std::print( std::cout, "\n {:n:}\n\n", aCopy );                                   // Should be:  "", "", "", Adam, Bob, Dolores
+    std::print( std::cout, "\n {:n:}\n\n", aCopy );                                   // Should be:  "", "", "", Frank, Gina, Adam, Bob, Dolores, Edward
 
 
 
@@ -75,6 +87,26 @@ namespace    // anonymous
     vector = aCopy;
     std::print( std::cout, "\nVectors are equal:  {}\n\n", vector == aCopy );         // Should be:  true
   }
+
+
+
+  // Lookup tables computed at compile time.  The vector itself can't outlive constant evaluation (its memory was allocated then
+  // and must be released then), so the primes are copied into a std::array that's embedded in the program - nothing to build when
+  // the program starts and nothing on the heap.
+  constexpr auto primes = []
+  {
+    Vector<int> found;
+    for( int candidate = 2;  candidate < 100;  ++candidate )
+    {
+      if( std::ranges::none_of( found, [candidate]( int prime ) { return candidate % prime == 0; } ) )   found.push_back( candidate );
+    }
+
+    std::array<int, 25> table{};                                          // There are 25 primes less than 100
+    std::ranges::copy( found, table.begin() );
+    return table;
+  }();
+
+  static_assert( primes.back() == 97 );                                   // Checked by the compiler, not when the program runs
 }    // anonymous namespace
 
 
@@ -102,11 +134,158 @@ int main()
     Student s{ "Barbara" };
     Vector  myVector{ s, s, s, { "Tom" } };
 
+    // Room for a few students built right in, the heap is used only after that
+    CSUF::CPSC131::InlineVector<Student, 4>             inlineStudentVector(3);
+
     test( fixedStudentVector          );
     test( extendableStudentVector     );
     test( standardStudentVector       );
     test( initializedExtendableVector );
     test( myVector                    );
+    test( inlineStudentVector         );
+
+
+
+    // Capacity management and growth policies.  Reserving up front costs one allocation, while growing one element at a time
+    // costs one reallocation each time the GROWTH policy's capacity is exhausted.
+    Vector<int>                                                               doubling;
+    Vector<int, VectorPolicy::EXTENDABLE, CSUF::CPSC131::GrowByOneAndAHalf>   oneAndAHalf;
+    Vector<int, VectorPolicy::EXTENDABLE, CSUF::CPSC131::GrowByIncrement<16>> byIncrement;
+    Vector<int>                                                               reserved;
+    reserved.reserve( 100 );
+
+    for( int i = 0;  i < 100;  ++i )
+    {
+      doubling   .push_back( i );
+      oneAndAHalf.push_back( i );
+      byIncrement.push_back( i );
+      reserved   .push_back( i );
+    }
+    std::print( std::cout, "\nCapacities after 100 push_backs:  doubling = {}, one and a half = {}, increment = {}, reserved = {}\n",     // Should be:  128, 135, 112, 100
+                doubling.capacity(), oneAndAHalf.capacity(), byIncrement.capacity(), reserved.capacity() );
+
+    doubling.resize( 10 );
+    doubling.shrink_to_fit();
+    std::print( std::cout, "After resize(10) and shrink_to_fit():  size = {}, capacity = {}\n\n", doubling.size(), doubling.capacity() );  // Should be:  10, 10
+
+
+
+    // Bulk removal.  Both erase_if() and erasing a range compact the vector in a single pass, no matter how many elements go
+    auto removed = erase_if( oneAndAHalf, []( int i ) { return i % 3 != 0; } );      // Keep only the multiples of 3
+    oneAndAHalf.erase( oneAndAHalf.begin() + 5, oneAndAHalf.end() - 25 );            // and then drop a few from the middle
+    std::print( std::cout, "Removed {} non-multiples of 3, leaving {}\n\n", removed, oneAndAHalf );     // Should be:  66, [0, 3, 6, 9, 12, 27, 30, ..., 99]
+
+
+
+    // Searching and comparing.  Vectors of integers, floating point numbers, and bytes are scanned a whole SIMD register's worth
+    // of elements at a time
+    Vector<int> ids;
+    for( int i = 0;  i < 1'000'000;  ++i )   ids.push_back( i % 1000 );
+
+    std::print( std::cout, "count(7) = {}, contains(1000) = {}, find(999) at index {}, smallest = {}, largest = {}\n",   // Should be:  1000, false, 999, 0, 999
+                ids.count( 7 ), ids.contains( 1000 ), ids.find( 999 ) - ids.begin(), *ids.min_element(), *ids.max_element() );
+
+    auto idsCopy = ids;
+    idsCopy.back() = -1;
+    std::print( std::cout, "Equal after changing the last id:  {},  greater:  {}\n\n", ids == idsCopy, ids > idsCopy );   // Should be:  false, true
+
+
+
+    // Compile time construction.  The table of primes was built by a Vector while compiling
+    std::print( std::cout, "Primes computed at compile time:  {}\n\n", primes );  // Should be:  [2, 3, 5, 7, 11, ..., 89, 97]
+
+
+
+    // Parallel bulk operations.  Big vectors are copied, filled, transformed, and sorted a contiguous chunk per thread
+    {
+      namespace parallel = CSUF::CPSC131::parallel;
+      parallel::Execution fourWays{ .threads = 4 };
+
+      Vector<int> snapshot( ids, fourWays );                                          // Parallel copy construction
+      parallel::transform( snapshot, []( int id ) { return 999 - id; }, fourWays );
+      parallel::sort     ( snapshot, fourWays );
+      snapshot.resize( 1'500'000, 1000, fourWays );                                  // Parallel fill of the new elements
+
+      std::atomic<std::size_t> chunks = 0;                                           // Shared by all the threads, so it must be atomic
+      parallel::for_each_chunk( snapshot, fourWays, [&chunks]( std::span<int> ) { ++chunks; } );   // Each thread gets a std::span of its chunk
+      std::print( std::cout, "Sorted:  {},  first = {},  last = {},  chunks = {}\n\n",               // Should be:  true, 0, 1000, 4
+                  std::ranges::is_sorted( snapshot ), snapshot.front(), snapshot.back(), chunks.load() );
+    }
+
+
+
+    // Struct of arrays.  Each field of a record lives in its own column, so a scan over one field reads only that field's bytes.
+    // Rows are still there for code that wants whole records.
+    {
+      CSUF::CPSC131::SoAVector<std::string, std::size_t, unsigned> roster;            // name, id, semesters
+      for( unsigned i = 0;  i < 1000;  ++i )   roster.emplace_back( std::format( "Student {}", i ), 2021'02'01u + i, i % 12 );
+
+      for( auto [name, id, semesters] : roster )   if( semesters == 11 )   ++semesters;   // Proxy rows refer into the columns
+      std::print( std::cout, "Columns:  seniors = {},  most semesters = {},  row 11 = {}\n\n",                              // Should be:  83, 12, ("Student 11", 20210212, 12)
+                  roster.column<2>().count( 12 ), *roster.column<2>().max_element(), roster[11] );              // Vectorized scans over a single column
+    }
+
+
+
+    // Concurrent appends.  Several threads push_back() onto the same vector without a lock, and elements never move once added,
+    // so a reference taken early is still good after the vector has grown
+    {
+      CSUF::CPSC131::ConcurrentVector<int> events;
+      events.push_back( -1 );
+      int const & first = events.front();
+
+      {
+        std::vector<std::jthread> producers;
+        for( int t = 0;  t < 4;  ++t )   producers.emplace_back( [&events, t] { for( int i = 0;  i < 25'000;  ++i )   events.push_back( t ); } );
+      }                                                                               // Wait for the producers to finish
+
+      std::print( std::cout, "Concurrent appends:  size = {},  first still {},  from thread 2 = {}\n\n",              // Should be:  100001, -1, 25000
+                  events.size(), first, std::ranges::count( events, 2 ) );
+    }
+
+
+
+    // Memory mapped vectors.  Opened on a file, the elements are the file's contents and are still there the next time the file
+    // is opened - no reading, writing, or parsing.  Only trivially copyable element types (no pointers to the heap) qualify.
+    {
+      auto const file = std::filesystem::temp_directory_path() / "CSUF_CPSC131_readings.vec";
+      std::filesystem::remove( file );
+
+      {
+        CSUF::CPSC131::MappedVector<double> readings( file );                         // Creates the file
+        for( int i = 0;  i < 1000;  ++i )   readings.push_back( i * 0.5 );            // The file grows right along with the vector
+      }                                                                               // Size is recorded in the file when the vector goes away (or on sync())
+
+      CSUF::CPSC131::MappedVector<double> reopened( file, CSUF::CPSC131::MapMode::READ_ONLY );
+      std::print( std::cout, "Reopened {} readings, last = {}, file is {} bytes\n\n",                                  // Should be:  1000, 499.5, 8256 (header + capacity)
+                  reopened.size(), reopened.back(), std::filesystem::file_size( file ) );
+      std::filesystem::remove( file );
+
+      // Without a file, the mapping is anonymous memory.  Copies get mappings of their own, and growing carries the elements along
+      CSUF::CPSC131::MappedVector<double> scratch( 4 );                               // 4 zeros
+      scratch[3] = 3.5;
+      auto copy = scratch;
+      for( int i = 0;  i < 100;  ++i )   copy.push_back( i );                         // Grows the copy's mapping several times
+      std::print( std::cout, "Anonymous mapping:  size = {}, copy size = {}, copy[3] = {}, copy.back() = {}\n\n",    // Should be:  4, 104, 3.5, 99
+                  scratch.size(), copy.size(), copy[3], copy.back() );
+    }
+
+
+
+    // Allocators.  Vectors drawing memory from an arena don't each go to the global heap, and the arena releases everything at
+    // once when it goes away.  The counting resource in between lets us watch the requests go by.
+    {
+      std::pmr::monotonic_buffer_resource       arena;
+      CSUF::CPSC131::CountingResource           counter( &arena );
+      CSUF::CPSC131::pmr::Vector<Student>       arenaVector( &counter );
+
+      for( int i = 0;  i < 100;  ++i )   arenaVector.emplace_back( "Arena" );
+      std::print( std::cout, "Arena vector:  {} allocations, {} bytes in use\n", counter.allocations(), counter.bytesInUse() );   // Should be:  5 allocations
+
+      CSUF::CPSC131::pmr::Vector<Student>       arenaCopy( arenaVector, &counter );
+      arenaCopy.reserve( 500 );
+      std::print( std::cout, "With a copy:   {} allocations, {} bytes in use\n\n", counter.allocations(), counter.bytesInUse() );  // Should be:  7 allocations
+    }
   }
 
   catch( std::exception & ex )
@@ -126,3 +305,16 @@ template class CSUF::CPSC131::Vector<Student, VectorPolicy::FIXED>;
 
 template class CSUF::CPSC131::Vector<int, VectorPolicy::EXTENDABLE>;
 template class CSUF::CPSC131::Vector<int, VectorPolicy::FIXED>;
+template class CSUF::CPSC131::Vector<double,       VectorPolicy::EXTENDABLE>;     // Vectorized searches and comparisons
+template class CSUF::CPSC131::Vector<std::uint8_t, VectorPolicy::EXTENDABLE>;
+
+template class CSUF::CPSC131::Vector<int, VectorPolicy::EXTENDABLE, CSUF::CPSC131::GrowByOneAndAHalf>;
+template class CSUF::CPSC131::Vector<int, VectorPolicy::EXTENDABLE, CSUF::CPSC131::GrowByIncrement<16>>;
+template class CSUF::CPSC131::Vector<int, VectorPolicy::MAPPED>;
+
+template class CSUF::CPSC131::ConcurrentVector<Student>;
+template class CSUF::CPSC131::SoAVector<std::string, std::size_t, unsigned>;
+
+template class CSUF::CPSC131::Vector<Student, VectorPolicy::INLINE,     CSUF::CPSC131::GrowByDoubling, std::allocator<Student>, 4>;
+template class CSUF::CPSC131::Vector<Student, VectorPolicy::EXTENDABLE, CSUF::CPSC131::GrowByDoubling, std::pmr::polymorphic_allocator<Student>>;
+template class CSUF::CPSC131::Vector<Student, VectorPolicy::FIXED,      CSUF::CPSC131::GrowByDoubling, std::pmr::polymorphic_allocator<Student>>;